@@ -291,7 +291,7 @@ function(tbx_codegen_generate_material_instance_header)
 endfunction()
 
 function(tbx_codegen_generate_plugin_artifacts)
-    set(options)
+    set(options CONCURRENT_UPDATE THREAD_SAFE_MESSAGES)
     set(one_value_args
         TARGET
         BASE_DIR
@@ -308,7 +308,7 @@ function(tbx_codegen_generate_plugin_artifacts)
         PLUGIN_ABI_VERSION
         PLUGIN_ASSET_PATH
     )
-    set(multi_value_args DEPENDENCIES)
+    set(multi_value_args DEPENDENCIES UPDATE_READS UPDATE_WRITES UPDATE_AFTER)
     cmake_parse_arguments(TBX_CODEGEN "${options}" "${one_value_args}" "${multi_value_args}" ${ARGN})
 
     if(NOT TBX_CODEGEN_TARGET)
@@ -365,6 +365,29 @@ function(tbx_codegen_generate_plugin_artifacts)
         set(PLUGIN_RESOURCES_BLOCK "    \"resources\": [],\n")
     endif()
 
+    if(TBX_CODEGEN_CONCURRENT_UPDATE)
+        set(PLUGIN_UPDATE_ACCESS_BLOCK "    \"concurrent_update\": true,\n")
+    else()
+        set(PLUGIN_UPDATE_ACCESS_BLOCK "    \"concurrent_update\": false,\n")
+    endif()
+    foreach(access_key IN ITEMS UPDATE_READS UPDATE_WRITES UPDATE_AFTER)
+        set(access_json "")
+        foreach(access_name IN LISTS TBX_CODEGEN_${access_key})
+            if(access_json STREQUAL "")
+                string(APPEND access_json "\"${access_name}\"")
+            else()
+                string(APPEND access_json ", \"${access_name}\"")
+            endif()
+        endforeach()
+        string(TOLOWER "${access_key}" access_json_key)
+        string(APPEND PLUGIN_UPDATE_ACCESS_BLOCK "    \"${access_json_key}\": [${access_json}],\n")
+    endforeach()
+    if(TBX_CODEGEN_THREAD_SAFE_MESSAGES)
+        string(APPEND PLUGIN_UPDATE_ACCESS_BLOCK "    \"thread_safe_messages\": true,\n")
+    else()
+        string(APPEND PLUGIN_UPDATE_ACCESS_BLOCK "    \"thread_safe_messages\": false,\n")
+    endif()
+
     set(PLUGIN_CATEGORY "${TBX_CODEGEN_PLUGIN_CATEGORY}")
     set(PLUGIN_PRIORITY "${TBX_CODEGEN_PLUGIN_PRIORITY}")
     set(PLUGIN_ABI_VERSION ${TBX_CODEGEN_PLUGIN_ABI_VERSION})
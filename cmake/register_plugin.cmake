@@ -98,10 +98,15 @@ endfunction()
 #                   `assets/` and sibling `../assets` conventions are auto-detected.
 #   CATEGORY      - Optional update category (default, logging, input, audio, physics, rendering, gameplay).
 #   PRIORITY      - Optional update priority integer (lower updates first).
+#   CONCURRENT_UPDATE - Lets the plugin update on a job worker alongside other opted-in plugins.
+#   UPDATE_READS  - Services/resources the plugin reads during updates.
+#   UPDATE_WRITES - Services/resources the plugin mutates during updates.
+#   UPDATE_AFTER  - Plugin identifiers that must finish updating before this plugin updates.
+#   THREAD_SAFE_MESSAGES - Lets the plugin receive thread-safe messages, which may be handled on job workers.
 function(tbx_register_plugin)
-    set(options)
+    set(options CONCURRENT_UPDATE THREAD_SAFE_MESSAGES)
     set(one_value_args TARGET CLASS HEADER NAME VERSION DESCRIPTION MODULE CATEGORY PRIORITY ASSET_PATH)
-    set(multi_value_args DEPENDENCIES)
+    set(multi_value_args DEPENDENCIES UPDATE_READS UPDATE_WRITES UPDATE_AFTER)
     cmake_parse_arguments(TBX_PLUGIN "${options}" "${one_value_args}" "${multi_value_args}" ${ARGN})
 
     if(NOT TBX_PLUGIN_TARGET)
@@ -280,7 +285,20 @@ function(tbx_register_plugin)
         )
     endif()
 
+    if(TBX_PLUGIN_CONCURRENT_UPDATE)
+        set(concurrent_update_flag CONCURRENT_UPDATE)
+    else()
+        set(concurrent_update_flag "")
+    endif()
+    if(TBX_PLUGIN_THREAD_SAFE_MESSAGES)
+        set(thread_safe_messages_flag THREAD_SAFE_MESSAGES)
+    else()
+        set(thread_safe_messages_flag "")
+    endif()
+
     tbx_codegen_generate_plugin_artifacts(
+        ${concurrent_update_flag}
+        ${thread_safe_messages_flag}
         TARGET ${TBX_PLUGIN_TARGET}
         BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}"
         GENERATED_DIR "${generated_dir}"
@@ -296,6 +314,9 @@ function(tbx_register_plugin)
         PLUGIN_ABI_VERSION "${TBX_PLUGIN_ABI_VERSION}"
         PLUGIN_ASSET_PATH "${plugin_asset_path}"
         DEPENDENCIES ${dependencies}
+        UPDATE_READS ${TBX_PLUGIN_UPDATE_READS}
+        UPDATE_WRITES ${TBX_PLUGIN_UPDATE_WRITES}
+        UPDATE_AFTER ${TBX_PLUGIN_UPDATE_AFTER}
     )
 
     tbx_enable_release_asset_bundling(TARGET ${TBX_PLUGIN_TARGET})
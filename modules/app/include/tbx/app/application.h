@@ -1,6 +1,8 @@
 #pragma once
 #include "tbx/app/description.h"
+#include "tbx/app/frame_telemetry.h"
 #include "tbx/app/message_coordinator.h"
+#include "tbx/app/session_recording.h"
 #include "tbx/app/settings.h"
 #include "tbx/async/job_system.h"
 #include "tbx/async/thread_manager.h"
@@ -13,6 +15,7 @@
 #include "tbx/plugin_api/plugin_manager.h"
 #include "tbx/plugin_api/service_provider.h"
 #include "tbx/time/delta_time.h"
+#include "tbx/time/frame_limiter.h"
 #include <string>
 #include <vector>
 
@@ -42,6 +45,55 @@ namespace tbx
         ServiceProvider& get_service_provider();
         const ServiceProvider& get_service_provider() const;
 
+        /// @brief
+        /// Purpose: Returns per-frame phase timings, sliding window percentiles, and stalls.
+        /// @details
+        /// Ownership: Returns a reference owned by the application.
+        /// Thread Safety: Not thread-safe; call from the main thread.
+        FrameTelemetry& get_frame_telemetry();
+        const FrameTelemetry& get_frame_telemetry() const;
+
+        /// @brief
+        /// Purpose: Returns the limiter that paces the main loop to the target frame rate.
+        /// @details
+        /// Ownership: Returns a reference owned by the application.
+        /// Thread Safety: Not thread-safe; call from the main thread.
+        FrameLimiter& get_frame_limiter();
+        const FrameLimiter& get_frame_limiter() const;
+
+        /// @brief
+        /// Purpose: Returns what the incremental asset collector did during the last frame.
+        /// @details
+        /// Ownership: Returns a reference owned by the application.
+        /// Thread Safety: Not thread-safe; call from the main thread.
+        const AssetCollectionStats& get_last_asset_collection_stats() const;
+
+        /// @brief
+        /// Purpose: Returns the controller that trades graphics quality for frame time.
+        /// @details
+        /// Ownership: Returns a reference owned by the application.
+        /// Thread Safety: Not thread-safe; call from the main thread.
+        QualityController& get_quality_controller();
+        const QualityController& get_quality_controller() const;
+
+        /// @brief
+        /// Purpose: Returns the recorder that writes frames to `RunSettings::record_session_path`.
+        /// Register codecs here for messages that should be captured.
+        /// @details
+        /// Ownership: Returns a reference owned by the application.
+        /// Thread Safety: Adding codecs is thread-safe; frames are written from the main thread.
+        SessionRecorder& get_session_recorder();
+        const SessionRecorder& get_session_recorder() const;
+
+        /// @brief
+        /// Purpose: Returns the player that feeds frames from `RunSettings::replay_session_path`.
+        /// Register the same codecs used while recording so messages can be rebuilt.
+        /// @details
+        /// Ownership: Returns a reference owned by the application.
+        /// Thread Safety: Not thread-safe; call from the main thread.
+        SessionPlayer& get_session_player();
+        const SessionPlayer& get_session_player() const;
+
       private:
         void setup_filesystem_directories();
         void setup_main_window();
@@ -49,6 +101,8 @@ namespace tbx
         void initialize(const std::vector<std::string>& requested_plugins);
         void update(DeltaTimer& timer);
         void fixed_update(const DeltaTime& dt);
+        bool has_reached_run_limit(const RunSettings& run_settings) const;
+        void log_frame_stall(const FrameSample& frame) const;
 #if defined(TBX_DEBUG)
         void update_debug_main_window_title(const DeltaTime& dt);
 #endif
@@ -63,17 +117,24 @@ namespace tbx
         Window _main_window = {};
         std::string _main_window_base_title = {};
 
-        uint _update_count = 0;
+        uint64 _update_count = 0;
         double _time_running = 0;
 
         double _performance_sample_elapsed_seconds = 0.0;
         uint _performance_sample_frame_count = 0U;
-        double _performance_sample_min_frame_time_ms = 0.0;
-        double _performance_sample_max_frame_time_ms = 0.0;
-        bool _performance_sample_has_data = false;
+        FrameTelemetry _frame_telemetry = {};
+        bool _was_previous_frame_over_budget = false;
+        FrameLimiter _frame_limiter = {};
+        QualityController _quality_controller = {};
+        SessionRecorder _session_recorder = {};
+        SessionPlayer _session_player = {};
 
-        double _asset_unload_elapsed_seconds = 0.0;
+        AssetCollectionStats _last_asset_collection_stats = {};
+        AssetCollectionStats _asset_collection_sample = {};
+        uint _asset_collection_pass_count = 0U;
+        std::chrono::nanoseconds _max_asset_collection_time = {};
         double _fixed_update_accumulator_seconds = 0.0;
+        float _interpolation_alpha = 1.0F;
 
 #if defined(TBX_DEBUG)
         std::string _debug_main_window_title = {};
@@ -24,11 +24,24 @@ namespace tbx
         // May be empty to fall back to the working root.
         std::filesystem::path logs_directory = {};
 
+        // Directory where asset loaders cache decoded assets relative to working root.
+        // May be empty to fall back to 'cooked' under the working root.
+        std::filesystem::path cooked_assets_directory = {};
+
+        // Packed asset archives relative to working root, built with `TbxArchiveBuilder`.
+        // Each is mounted in place of the directory with the same name minus the extension.
+        // Later archives take precedence, and loose files fill in whatever no archive contains.
+        std::vector<std::filesystem::path> asset_archives = {};
+
         // Ordered list of plugin identifiers requested for loading.
         std::vector<std::string> requested_plugins = {};
 
         // Startup icon asset used for native window icons.
         // Defaults to the built-in box icon.
         Handle icon = ToyboxIcon::HANDLE;
+
+        // Main loop pacing, run limits, and headless mode.
+        // Command line args such as `--headless` override these values.
+        RunSettings run = {};
     };
 }
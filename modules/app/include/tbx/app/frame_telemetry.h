@@ -0,0 +1,159 @@
+#pragma once
+#include "tbx/common/result.h"
+#include "tbx/common/typedefs.h"
+#include "tbx/tbx_api.h"
+#include <array>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Identifies the main loop phases timed by frame telemetry.
+    /// @details
+    /// Ownership: Enum values are copied by value.
+    /// Thread Safety: Thread-safe as immutable enum constants.
+    enum class FramePhase
+    {
+        MESSAGES,
+        FIXED_UPDATE,
+        PLUGIN_UPDATE,
+        RENDER,
+        INPUT,
+        ASSET_UNLOAD,
+        // Frame time not covered by any other phase.
+        OTHER,
+    };
+
+    inline constexpr size FramePhaseCount = static_cast<size>(FramePhase::OTHER) + 1;
+
+    TBX_API std::string to_string(FramePhase phase);
+
+    /// @brief
+    /// Purpose: Timing for one completed frame.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API FrameSample
+    {
+        uint64 frame_index = 0;
+        std::chrono::nanoseconds frame_time = {};
+        std::array<std::chrono::nanoseconds, FramePhaseCount> phase_times = {};
+        bool is_over_budget = false;
+    };
+
+    /// @brief
+    /// Purpose: Distribution of one timing across the telemetry window.
+    /// @details
+    /// Ownership: Value type owned by the caller. Percentiles use the nearest-rank method.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API FrameTimeStats
+    {
+        std::chrono::nanoseconds average = {};
+        std::chrono::nanoseconds p50 = {};
+        std::chrono::nanoseconds p95 = {};
+        std::chrono::nanoseconds p99 = {};
+        std::chrono::nanoseconds max = {};
+    };
+
+    /// @brief
+    /// Purpose: Snapshot of frame telemetry over the most recent window of frames.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API FrameTelemetryStats
+    {
+        size frame_count = 0;
+        FrameTimeStats frame = {};
+        std::array<FrameTimeStats, FramePhaseCount> phases = {};
+        size over_budget_count = 0;
+    };
+
+    /// @brief
+    /// Purpose: Records per-frame phase timings in a fixed-size ring buffer and reports sliding
+    /// window percentiles and frames that exceed a budget.
+    /// @details
+    /// Ownership: Owns the sample ring and, when enabled, the CSV output stream.
+    /// Thread Safety: Not thread-safe; record and query from the main thread.
+    class TBX_API FrameTelemetry
+    {
+      public:
+        FrameTelemetry(
+            size window_frame_count = 600,
+            std::chrono::nanoseconds frame_budget = std::chrono::microseconds(33333));
+
+      public:
+        // Starts timing a new frame and clears the phase timings of the previous one.
+        void begin_frame();
+
+        // Adds `duration` to `phase` for the current frame.
+        void add_phase_time(FramePhase phase, std::chrono::nanoseconds duration);
+
+        // Closes the current frame, stores it in the window, and appends it to the CSV file.
+        // Returns the sample so callers can report budget overruns.
+        const FrameSample& end_frame();
+
+        // Closes the current frame with an explicit total time instead of the measured one.
+        const FrameSample& end_frame(std::chrono::nanoseconds frame_time);
+
+        // Computes statistics over the frames currently held in the window.
+        FrameTelemetryStats get_stats() const;
+
+        // Returns the window contents, oldest first.
+        std::vector<FrameSample> get_samples() const;
+
+        // Returns the most recent over-budget frames, oldest first.
+        const std::deque<FrameSample>& get_recent_stalls() const;
+
+        size get_window_frame_count() const;
+
+        // Budget a frame may take before it is flagged. Zero disables stall detection.
+        std::chrono::nanoseconds get_frame_budget() const;
+        void set_frame_budget(std::chrono::nanoseconds frame_budget);
+
+        // Appends one CSV row per frame to `path`, writing a header when the file is new.
+        Result enable_csv_output(const std::filesystem::path& path);
+        void disable_csv_output();
+
+        // Drops every recorded frame and stall; CSV output and budget are kept.
+        void reset();
+
+      private:
+        void write_csv_row(const FrameSample& sample);
+
+      private:
+        std::vector<FrameSample> _samples = {};
+        size _next_sample_index = 0;
+        size _sample_count = 0;
+        uint64 _frame_index = 0;
+        FrameSample _current = {};
+        std::chrono::steady_clock::time_point _frame_start = {};
+        std::chrono::nanoseconds _frame_budget = {};
+        std::deque<FrameSample> _recent_stalls = {};
+        std::ofstream _csv_stream = {};
+    };
+
+    /// @brief
+    /// Purpose: Adds the lifetime of the scope to one phase of the current telemetry frame.
+    /// @details
+    /// Ownership: Borrows the telemetry, which must outlive the scope.
+    /// Thread Safety: Not thread-safe; use on the thread recording the frame.
+    class TBX_API FramePhaseScope final
+    {
+      public:
+        FramePhaseScope(FrameTelemetry& telemetry, FramePhase phase);
+        ~FramePhaseScope() noexcept;
+
+        FramePhaseScope(const FramePhaseScope&) = delete;
+        FramePhaseScope& operator=(const FramePhaseScope&) = delete;
+
+      private:
+        FrameTelemetry& _telemetry;
+        FramePhase _phase = FramePhase::OTHER;
+        std::chrono::steady_clock::time_point _start = {};
+    };
+}
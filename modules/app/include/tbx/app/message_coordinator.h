@@ -1,11 +1,16 @@
 #pragma once
+#include "tbx/app/message_stats.h"
+#include "tbx/async/job_system.h"
 #include "tbx/common/uuid.h"
 #include "tbx/messages/dispatcher.h"
 #include "tbx/tbx_api.h"
 #include <atomic>
+#include <chrono>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <typeindex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -22,13 +27,22 @@ namespace tbx
         std::shared_ptr<MessageHandler> handler = nullptr;
     };
 
+    /// @brief
+    /// Purpose: Application message coordinator that dispatches sent messages immediately and
+    /// queues posted messages until the next flush.
+    /// @details
+    /// Ownership: Owns queued messages and copies of registered handlers. The optional job system
+    /// is non-owning and must outlive the coordinator or be cleared before it is destroyed.
+    /// Thread Safety: Registration, send, and post are thread-safe. Flush must be called from the
+    /// main thread. Posted messages whose dispatch policy is thread-safe may be handled on job
+    /// workers during flush; their completion callbacks always run on the flushing thread.
     class TBX_API AppMessageCoordinator final : public IMessageCoordinator
     {
       public:
         using IMessageDispatcher::post;
         using IMessageDispatcher::send;
 
-        AppMessageCoordinator();
+        AppMessageCoordinator(JobSystem* job_system = nullptr);
         ~AppMessageCoordinator() noexcept override;
 
         AppMessageCoordinator(const AppMessageCoordinator&) = delete;
@@ -40,13 +54,70 @@ namespace tbx
         void deregister_handler(const Uuid& token) override;
         void clear_handlers() override;
 
+        /// @brief
+        /// Purpose: Dispatches all queued messages.
+        /// @details
+        /// Ownership: Releases queued messages after dispatch.
+        /// Thread Safety: Call from the main thread. Thread-safe messages are handled on job
+        /// workers in parallel, in post order within a non-zero channel, while the remaining
+        /// messages are handled serially on the calling thread. Blocks until all workers finish,
+        /// then invokes completion callbacks on the calling thread in post order.
         void flush() override;
 
         Result send(Message& msg) const override;
         std::shared_future<Result> post(std::unique_ptr<Message> msg) const override;
 
+        /// @brief
+        /// Purpose: Returns how many posted messages were replaced by a newer message sharing
+        /// their coalescing key.
+        /// @details
+        /// Ownership: Returns a value copy.
+        /// Thread Safety: Thread-safe.
+        uint64 get_coalesced_count() const;
+
+        /// @brief
+        /// Purpose: Enables or disables dispatch timing and queue depth tracking.
+        /// @details
+        /// Ownership: Does not transfer ownership.
+        /// Thread Safety: Thread-safe. Disabled instrumentation costs one branch per dispatch.
+        void set_instrumentation_enabled(bool enabled);
+
+        /// @brief
+        /// Purpose: Returns whether instrumentation is currently recording.
+        /// @details
+        /// Ownership: Returns a value copy.
+        /// Thread Safety: Thread-safe.
+        bool is_instrumentation_enabled() const;
+
+        /// @brief
+        /// Purpose: Returns the statistics recorded while instrumentation was enabled.
+        /// @details
+        /// Ownership: Returns a snapshot owned by the caller.
+        /// Thread Safety: Thread-safe.
+        MessageCoordinatorStats get_stats() const;
+
+        /// @brief
+        /// Purpose: Clears all recorded statistics.
+        /// @details
+        /// Ownership: Does not transfer ownership.
+        /// Thread Safety: Thread-safe.
+        void reset_stats();
+
+        /// @brief
+        /// Purpose: Sets how often flush logs a statistics summary while instrumentation is on.
+        /// @details
+        /// Ownership: Does not transfer ownership.
+        /// Thread Safety: Call from the main thread. A zero interval disables the periodic log.
+        void set_stats_log_interval(std::chrono::steady_clock::duration interval);
+
       private:
         std::shared_ptr<const std::vector<RegisteredMessageHandler>> get_handlers_snapshot() const;
+        bool resolve(Message& msg) const;
+        bool resolve_handlers(Message& msg, bool is_instrumented) const;
+        void record_message_dispatch(const Message& msg, std::chrono::nanoseconds elapsed) const;
+        void record_handler_dispatch(const Uuid& handler, std::chrono::nanoseconds elapsed) const;
+        void record_flush(size queue_depth);
+        void log_stats_if_due();
         void dispatch(Message& msg) const;
 
         mutable std::mutex _handlers_write_mutex;
@@ -54,5 +125,16 @@ namespace tbx
             _handlers_snapshot;
         mutable std::mutex _pending_mutex;
         mutable std::vector<QueuedMessage> _pending;
+        mutable std::unordered_map<uint64, size> _pending_by_coalescing_key;
+        mutable std::atomic<uint64> _coalesced_count = 0;
+        JobSystem* _job_system = nullptr;
+
+        std::atomic<bool> _is_instrumented = false;
+        mutable std::mutex _stats_mutex;
+        mutable std::unordered_map<std::type_index, MessageTypeStats> _message_type_stats;
+        mutable std::unordered_map<Uuid, MessageHandlerStats> _handler_stats;
+        MessageQueueStats _queue_stats = {};
+        std::chrono::steady_clock::duration _stats_log_interval = {};
+        std::chrono::steady_clock::time_point _last_stats_log = {};
     };
 }
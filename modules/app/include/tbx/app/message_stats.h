@@ -0,0 +1,58 @@
+#pragma once
+#include "tbx/common/typedefs.h"
+#include "tbx/common/uuid.h"
+#include "tbx/messages/dispatch_stats.h"
+#include "tbx/tbx_api.h"
+#include <string>
+#include <vector>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Dispatch timing for one message type, measured across the full handler walk.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API MessageTypeStats
+    {
+        std::string type_name = {};
+        MessageDispatchStats dispatch = {};
+    };
+
+    /// @brief
+    /// Purpose: Timing for one registered handler, keyed by its registration token.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API MessageHandlerStats
+    {
+        Uuid handler = {};
+        MessageDispatchStats dispatch = {};
+    };
+
+    /// @brief
+    /// Purpose: Posted message queue depth observed at flush.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API MessageQueueStats
+    {
+        uint64 flush_count = 0;
+        size last_depth = 0;
+        size max_depth = 0;
+        uint64 total_depth = 0;
+    };
+
+    /// @brief
+    /// Purpose: Snapshot of message coordinator instrumentation.
+    /// @details
+    /// Ownership: Value type owned by the caller. Entries are sorted by total time, slowest first.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API MessageCoordinatorStats
+    {
+        std::vector<MessageTypeStats> message_types = {};
+        std::vector<MessageHandlerStats> handlers = {};
+        MessageQueueStats queue = {};
+        uint64 coalesced_count = 0;
+    };
+}
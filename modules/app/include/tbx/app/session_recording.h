@@ -0,0 +1,140 @@
+#pragma once
+#include "tbx/common/result.h"
+#include "tbx/common/typedefs.h"
+#include "tbx/input/manager.h"
+#include "tbx/messages/message.h"
+#include "tbx/tbx_api.h"
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Serializes one message type into and out of a recorded session.
+    /// @details
+    /// Ownership: Owns its name and callbacks.
+    /// Thread Safety: `encode` may be called from any thread that dispatches messages; `decode` is
+    /// called on the replaying thread.
+    struct TBX_API SessionMessageCodec
+    {
+        // Stable name written to the session file; must be unique per codec.
+        std::string type_name = {};
+
+        // Returns true and fills `out_payload` when `message` is of this codec's type.
+        std::function<bool(const Message& message, std::vector<uint8>& out_payload)> encode = {};
+
+        // Rebuilds a message from a payload written by `encode`. Returns null on malformed data.
+        std::function<std::unique_ptr<Message>(const std::vector<uint8>& payload)> decode = {};
+    };
+
+    /// @brief
+    /// Purpose: Stores one encoded message captured during a recorded frame.
+    /// @details
+    /// Ownership: Owns its copied name and payload bytes.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API SessionMessageRecord
+    {
+        std::string type_name = {};
+        std::vector<uint8> payload = {};
+    };
+
+    /// @brief
+    /// Purpose: Stores everything needed to replay one frame of a recorded session.
+    /// @details
+    /// Ownership: Owns its input snapshot and message records.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API SessionFrame
+    {
+        double delta_seconds = 0.0;
+
+        // Device state the frame's input actions were evaluated against. Empty when the session
+        // was recorded without an input manager.
+        std::optional<InputDeviceSnapshot> input = std::nullopt;
+
+        std::vector<SessionMessageRecord> messages = {};
+    };
+
+    /// @brief
+    /// Purpose: Streams per-frame delta times, input snapshots, and selected messages to a compact
+    /// binary session file.
+    /// @details
+    /// Ownership: Owns the output file stream and registered codecs.
+    /// Thread Safety: `capture_message` is safe to call from any thread; other members are expected
+    /// from the main loop thread.
+    /// Only messages claimed by a registered codec are recorded, so register codecs for messages
+    /// that originate outside the simulation, such as OS or network events. Input snapshots are
+    /// written only when they differ from the previous frame.
+    class TBX_API SessionRecorder
+    {
+      public:
+        SessionRecorder() = default;
+        ~SessionRecorder() noexcept;
+
+      public:
+        SessionRecorder(const SessionRecorder&) = delete;
+        SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+      public:
+        Result start(const std::filesystem::path& path);
+        void stop();
+        bool is_recording() const;
+
+        void add_codec(SessionMessageCodec codec);
+
+        // Encodes `message` when a codec claims it and queues it for the next recorded frame.
+        void capture_message(const Message& message);
+
+        // Writes one frame holding `delta_seconds`, `input` when given, and the queued messages.
+        void record_frame(double delta_seconds, const InputDeviceSnapshot* input = nullptr);
+
+        uint64 get_frame_count() const;
+
+      private:
+        mutable std::mutex _mutex = {};
+        std::ofstream _stream = {};
+        std::vector<SessionMessageCodec> _codecs = {};
+        std::vector<SessionMessageRecord> _pending_messages = {};
+        std::vector<uint8> _frame_buffer = {};
+        std::vector<uint8> _last_input_payload = {};
+        bool _has_last_input = false;
+        uint64 _frame_count = 0U;
+    };
+
+    /// @brief
+    /// Purpose: Reads a session file written by SessionRecorder and hands its frames back in order.
+    /// @details
+    /// Ownership: Owns the decoded frames and registered codecs.
+    /// Thread Safety: Not thread-safe; use from the main loop thread.
+    class TBX_API SessionPlayer
+    {
+      public:
+        Result load(const std::filesystem::path& path);
+        bool is_loaded() const;
+
+        void add_codec(SessionMessageCodec codec);
+
+        bool has_next_frame() const;
+
+        // Returns the next frame, or nothing once every frame has been played.
+        std::optional<SessionFrame> next_frame();
+
+        // Rebuilds the frame's messages; records without a matching codec are skipped.
+        std::vector<std::unique_ptr<Message>> decode_messages(const SessionFrame& frame) const;
+
+        uint64 get_frame_count() const;
+        uint64 get_frame_index() const;
+        void rewind();
+
+      private:
+        std::vector<SessionFrame> _frames = {};
+        std::vector<SessionMessageCodec> _codecs = {};
+        size _next_frame_index = 0U;
+        bool _is_loaded = false;
+    };
+}
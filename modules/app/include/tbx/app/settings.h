@@ -1,5 +1,8 @@
 #pragma once
+#include "tbx/assets/settings.h"
 #include "tbx/async/settings.h"
+#include "tbx/graphics/quality_controller.h"
+#include "tbx/common/typedefs.h"
 #include "tbx/graphics/settings.h"
 #include "tbx/physics/settings.h"
 #include "tbx/tbx_api.h"
@@ -16,6 +19,42 @@ namespace tbx
     {
         std::filesystem::path working_directory = {};
         std::filesystem::path logs_directory = {};
+
+        // Where asset loaders keep decoded assets between runs. Empty disables the cooked cache.
+        std::filesystem::path cooked_assets_directory = {};
+    };
+
+    /// @brief
+    /// Purpose: Controls how the application main loop advances time and when it stops on its own.
+    /// @details
+    /// Ownership: Owns all stored values.
+    /// Thread Safety: Not thread-safe; synchronize access externally.
+    struct TBX_API RunSettings
+    {
+        // Runs without a main window or rendering, e.g. on simulation servers or in CI.
+        bool is_headless = false;
+
+        // Simulated seconds advanced per frame. Zero advances by measured wall-clock time.
+        // A fixed step makes fixed and variable updates reproducible between runs.
+        double fixed_frame_seconds = 0.0;
+
+        // Requests exit after this many frames. Zero runs until exit is requested.
+        uint64 max_frame_count = 0;
+
+        // Requests exit once this much simulated time has passed. Zero disables the limit.
+        double max_run_seconds = 0.0;
+
+        // Frames per second the main loop is capped at. Zero runs uncapped.
+        double target_frame_rate = 0.0;
+
+        // Tunes the frame limiter's sleep/spin split from measured sleep overshoot.
+        bool is_frame_limiter_adaptive = true;
+
+        // Writes each frame's delta time, input, and codec-registered messages to this file.
+        std::filesystem::path record_session_path = {};
+
+        // Plays back a recorded session instead of live timing and input, then exits.
+        std::filesystem::path replay_session_path = {};
     };
 
     /// @brief
@@ -36,5 +75,8 @@ namespace tbx
         PhysicsSettings physics;
         AsyncSettings async = {};
         PathSettings paths = {};
+        RunSettings run = {};
+        AssetCollectionSettings asset_collection = {};
+        QualityControllerSettings quality = {};
     };
 }
@@ -1,10 +1,16 @@
 #include "tbx/app/message_coordinator.h"
 #include "tbx/debugging/macros.h"
+#include "tbx/profiling/macros.h"
 #include <algorithm>
+#include <chrono>
 #include <exception>
+#include <functional>
 #include <mutex>
 #include <string>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace tbx
 {
@@ -75,47 +81,101 @@ namespace tbx
             msg.callbacks.on_processed(msg);
     }
 
-    static void apply_state(Message& msg, MessageState state, const std::string& reason)
+    static void resolve_state(Message& msg, MessageState state, const std::string& reason)
     {
         msg.state = state;
         update_result_for_state(msg, state, reason);
-        dispatch_state_callbacks(msg, state);
     }
 
-    static void handle_state_change(const Message& msg, const MessageState& previous_state)
+    static void complete_message(Message& msg)
     {
-        if (msg.state == previous_state)
-            return;
+        try
+        {
+            dispatch_state_callbacks(msg, msg.state);
+        }
+        catch (const std::exception& ex)
+        {
+            resolve_state(msg, MessageState::ERROR, ex.what());
+            TBX_ASSERT(false, "Exception during message completion callback: %s", ex.what());
+        }
+        catch (...)
+        {
+            resolve_state(
+                msg,
+                MessageState::ERROR,
+                "Unknown exception during message completion callback.");
+            TBX_ASSERT(false, "Unknown exception during message completion callback.");
+        }
+    }
 
-        update_result_for_state(msg, msg.state, std::string());
-        dispatch_state_callbacks(msg, msg.state);
+    static bool is_cancellation_requested(const Message& msg)
+    {
+        return msg.cancellation_token && msg.cancellation_token.is_cancelled();
     }
 
-    static bool cancel_if_requested(Message& msg, const std::string& reason = std::string())
+    // Returns true when the cancellation changed the message state and callbacks should run.
+    static bool resolve_cancellation(Message& msg)
     {
-        if (!msg.cancellation_token || !msg.cancellation_token.is_cancelled())
+        if (msg.state == MessageState::CANCELLED)
             return false;
 
-        if (msg.state == MessageState::CANCELLED)
-            return true;
+        resolve_state(msg, MessageState::CANCELLED, "Message was cancelled.");
+        return true;
+    }
 
-        std::string resolved = reason.empty() ? std::string("Message was cancelled.") : reason;
-        apply_state(msg, MessageState::CANCELLED, resolved);
+    static std::function<void(const Message&)> chain_callback(
+        std::function<void(const Message&)> newer,
+        std::function<void(const Message&)> older)
+    {
+        if (!older)
+            return newer;
+        if (!newer)
+            return older;
 
-        return true;
+        return [newer = std::move(newer), older = std::move(older)](const Message& msg)
+        {
+            newer(msg);
+            older(msg);
+        };
+    }
+
+    // Keeps a superseded message's observers notified when its replacement completes.
+    static void chain_callbacks(MessageCallbacks& newer, MessageCallbacks older)
+    {
+        newer.on_error = chain_callback(std::move(newer.on_error), std::move(older.on_error));
+        newer.on_cancelled =
+            chain_callback(std::move(newer.on_cancelled), std::move(older.on_cancelled));
+        newer.on_processed =
+            chain_callback(std::move(newer.on_processed), std::move(older.on_processed));
+        newer.on_timeout = chain_callback(std::move(newer.on_timeout), std::move(older.on_timeout));
+    }
+
+    static uint64 get_pending_coalescing_key(const Message& msg)
+    {
+        auto seed = static_cast<uint64>(msg.dispatch_policy.coalescing_key);
+        seed ^= typeid(msg).hash_code() + 0x9e3779b9U + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+
+    static double to_milliseconds(std::chrono::nanoseconds elapsed)
+    {
+        return std::chrono::duration<double, std::milli>(elapsed).count();
     }
 
     // ----------------------
     // AppMessageCoordinator
     // ----------------------
 
-    AppMessageCoordinator::AppMessageCoordinator()
+    AppMessageCoordinator::AppMessageCoordinator(JobSystem* job_system)
         : _handlers_snapshot(std::make_shared<const std::vector<RegisteredMessageHandler>>())
+        , _job_system(job_system)
     {
     }
 
     AppMessageCoordinator::~AppMessageCoordinator() noexcept
     {
+        // The job system may already be gone when services are torn down, so drain inline.
+        _job_system = nullptr;
         flush();
         clear_handlers();
     }
@@ -166,16 +226,28 @@ namespace tbx
         return _handlers_snapshot.load(std::memory_order_acquire);
     }
 
-    void AppMessageCoordinator::dispatch(Message& msg) const
+    bool AppMessageCoordinator::resolve(Message& msg) const
+    {
+        if (!_is_instrumented.load(std::memory_order_relaxed))
+            return resolve_handlers(msg, false);
+
+        const auto dispatch_begin = std::chrono::steady_clock::now();
+        const bool should_complete = resolve_handlers(msg, true);
+        record_message_dispatch(msg, std::chrono::steady_clock::now() - dispatch_begin);
+        return should_complete;
+    }
+
+    bool AppMessageCoordinator::resolve_handlers(Message& msg, bool is_instrumented) const
     {
         try
         {
             auto handlers_snapshot = get_handlers_snapshot();
 
-            if (cancel_if_requested(msg))
-                return;
+            if (is_cancellation_requested(msg))
+                return resolve_cancellation(msg);
 
             MessageState previous_state = msg.state;
+            bool state_changed = false;
             for (const auto& entry : *handlers_snapshot)
             {
                 if (!entry.handler || !(*entry.handler))
@@ -188,85 +260,100 @@ namespace tbx
                     continue;
                 }
 
-                (*entry.handler)(msg);
+                if (is_instrumented)
+                {
+                    const auto handler_begin = std::chrono::steady_clock::now();
+                    (*entry.handler)(msg);
+                    record_handler_dispatch(
+                        entry.id,
+                        std::chrono::steady_clock::now() - handler_begin);
+                }
+                else
+                    (*entry.handler)(msg);
 
                 if (msg.state != previous_state)
                 {
-                    handle_state_change(msg, previous_state);
+                    update_result_for_state(msg, msg.state, std::string());
                     previous_state = msg.state;
+                    state_changed = true;
                 }
 
                 if (msg.state == MessageState::HANDLED)
-                    break;
+                    return state_changed;
                 if (msg.state == MessageState::CANCELLED)
-                    return;
+                    return state_changed;
                 if (msg.state == MessageState::ERROR)
-                    return;
-                if (cancel_if_requested(msg))
-                    return;
+                    return state_changed;
+                if (is_cancellation_requested(msg))
+                    return resolve_cancellation(msg);
+            }
+
+            if (msg.state != MessageState::UN_HANDLED)
+                return state_changed;
+
+            auto* request = dynamic_cast<RequestBase*>(&msg);
+            if (!request)
+            {
+                resolve_state(msg, MessageState::UN_HANDLED, std::string());
+                return true;
             }
 
-            if (msg.state == MessageState::UN_HANDLED)
+            switch (request->not_handled_behavior)
             {
-                auto* request = dynamic_cast<RequestBase*>(&msg);
-                if (!request)
+                case MessageNotHandledBehavior::DO_NOTHING:
                 {
-                    apply_state(msg, MessageState::UN_HANDLED, std::string());
-                    return;
+                    resolve_state(msg, MessageState::UN_HANDLED, std::string());
+                    break;
                 }
-
-                switch (request->not_handled_behavior)
+                case MessageNotHandledBehavior::WARN:
                 {
-                    case MessageNotHandledBehavior::DO_NOTHING:
-                    {
-                        apply_state(msg, MessageState::UN_HANDLED, std::string());
-                        break;
-                    }
-                    case MessageNotHandledBehavior::WARN:
-                    {
-                        TBX_TRACE_WARNING(
-                            "Request was not handled (type: %s).",
-                            typeid(msg).name());
-                        apply_state(
-                            msg,
-                            MessageState::ERROR,
-                            "Request was not handled by any handlers.");
-                        break;
-                    }
-                    case MessageNotHandledBehavior::ASSERT:
-                    {
-                        TBX_ASSERT(
-                            false,
-                            "Request required handling but was not handled (type: %s).",
-                            typeid(msg).name());
-                        apply_state(
-                            msg,
-                            MessageState::ERROR,
-                            "Request required handling but was not handled by any handlers.");
-                        break;
-                    }
-                    default:
-                    {
-                        TBX_ASSERT(false, "Unknown MessageNotHandledBehavior.");
-                        apply_state(
-                            msg,
-                            MessageState::ERROR,
-                            "Unknown request not-handled behavior.");
-                        break;
-                    }
+                    TBX_TRACE_WARNING("Request was not handled (type: %s).", typeid(msg).name());
+                    resolve_state(
+                        msg,
+                        MessageState::ERROR,
+                        "Request was not handled by any handlers.");
+                    break;
+                }
+                case MessageNotHandledBehavior::ASSERT:
+                {
+                    TBX_ASSERT(
+                        false,
+                        "Request required handling but was not handled (type: %s).",
+                        typeid(msg).name());
+                    resolve_state(
+                        msg,
+                        MessageState::ERROR,
+                        "Request required handling but was not handled by any handlers.");
+                    break;
+                }
+                default:
+                {
+                    TBX_ASSERT(false, "Unknown MessageNotHandledBehavior.");
+                    resolve_state(msg, MessageState::ERROR, "Unknown request not-handled behavior.");
+                    break;
                 }
             }
+
+            return true;
         }
         catch (const std::exception& ex)
         {
-            apply_state(msg, MessageState::ERROR, ex.what());
+            resolve_state(msg, MessageState::ERROR, ex.what());
             TBX_ASSERT(false, "Exception during message dispatch: %s", ex.what());
         }
         catch (...)
         {
-            apply_state(msg, MessageState::ERROR, "Unknown exception during message dispatch.");
+            resolve_state(msg, MessageState::ERROR, "Unknown exception during message dispatch.");
             TBX_ASSERT(false, "Unknown exception during message dispatch.");
         }
+
+        return true;
+    }
+
+    void AppMessageCoordinator::dispatch(Message& msg) const
+    {
+        if (resolve(msg))
+            complete_message(msg);
     }
 
     Result AppMessageCoordinator::send(Message& msg) const
@@ -295,37 +382,275 @@ namespace tbx
 
         {
             std::lock_guard<std::mutex> lock(_pending_mutex);
+
+            if (msg->dispatch_policy.coalescing_key != 0)
+            {
+                const auto pending_key = get_pending_coalescing_key(*msg);
+                auto existing = _pending_by_coalescing_key.find(pending_key);
+                if (existing != _pending_by_coalescing_key.end())
+                {
+                    auto& superseded = _pending[existing->second].message;
+                    if (superseded
+                        && superseded->dispatch_policy.coalescing_key
+                               == msg->dispatch_policy.coalescing_key
+                        && typeid(*superseded) == typeid(*msg))
+                    {
+                        chain_callbacks(msg->callbacks, std::move(superseded->callbacks));
+                        superseded.reset();
+                        _coalesced_count.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+
+                // The newer message queues at the back so it stays ordered after anything
+                // posted between the two.
+                _pending_by_coalescing_key[pending_key] = _pending.size();
+            }
+
             _pending.emplace_back(QueuedMessage {std::move(msg)});
         }
 
         return future;
     }
 
+    uint64 AppMessageCoordinator::get_coalesced_count() const
+    {
+        return _coalesced_count.load(std::memory_order_relaxed);
+    }
+
+    void AppMessageCoordinator::set_instrumentation_enabled(bool enabled)
+    {
+        _is_instrumented.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool AppMessageCoordinator::is_instrumentation_enabled() const
+    {
+        return _is_instrumented.load(std::memory_order_relaxed);
+    }
+
+    MessageCoordinatorStats AppMessageCoordinator::get_stats() const
+    {
+        auto stats = MessageCoordinatorStats();
+        {
+            std::lock_guard<std::mutex> lock(_stats_mutex);
+
+            stats.message_types.reserve(_message_type_stats.size());
+            for (const auto& [type, type_stats] : _message_type_stats)
+                stats.message_types.push_back(type_stats);
+
+            stats.handlers.reserve(_handler_stats.size());
+            for (const auto& [handler, handler_stats] : _handler_stats)
+                stats.handlers.push_back(handler_stats);
+
+            stats.queue = _queue_stats;
+        }
+        stats.coalesced_count = get_coalesced_count();
+
+        std::ranges::sort(
+            stats.message_types,
+            [](const MessageTypeStats& left, const MessageTypeStats& right)
+            {
+                return left.dispatch.total_time > right.dispatch.total_time;
+            });
+        std::ranges::sort(
+            stats.handlers,
+            [](const MessageHandlerStats& left, const MessageHandlerStats& right)
+            {
+                return left.dispatch.total_time > right.dispatch.total_time;
+            });
+
+        return stats;
+    }
+
+    void AppMessageCoordinator::reset_stats()
+    {
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+        _message_type_stats.clear();
+        _handler_stats.clear();
+        _queue_stats = {};
+    }
+
+    void AppMessageCoordinator::set_stats_log_interval(
+        std::chrono::steady_clock::duration interval)
+    {
+        _stats_log_interval = interval;
+        _last_stats_log = std::chrono::steady_clock::now();
+    }
+
+    void AppMessageCoordinator::record_message_dispatch(
+        const Message& msg,
+        std::chrono::nanoseconds elapsed) const
+    {
+        const auto type = std::type_index(typeid(msg));
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+
+        auto [entry, inserted] = _message_type_stats.try_emplace(type);
+        if (inserted)
+            entry->second.type_name = type.name();
+        record_dispatch_time(entry->second.dispatch, elapsed);
+    }
+
+    void AppMessageCoordinator::record_handler_dispatch(
+        const Uuid& handler,
+        std::chrono::nanoseconds elapsed) const
+    {
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+
+        auto [entry, inserted] = _handler_stats.try_emplace(handler);
+        if (inserted)
+            entry->second.handler = handler;
+        record_dispatch_time(entry->second.dispatch, elapsed);
+    }
+
+    void AppMessageCoordinator::record_flush(size queue_depth)
+    {
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+
+        _queue_stats.flush_count += 1;
+        _queue_stats.last_depth = queue_depth;
+        _queue_stats.max_depth = std::max(_queue_stats.max_depth, queue_depth);
+        _queue_stats.total_depth += queue_depth;
+    }
+
+    void AppMessageCoordinator::log_stats_if_due()
+    {
+        if (_stats_log_interval <= std::chrono::steady_clock::duration::zero())
+            return;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - _last_stats_log < _stats_log_interval)
+            return;
+        _last_stats_log = now;
+
+        // Logging dispatches through this coordinator, so only log from a snapshot.
+        const auto stats = get_stats();
+        const auto average_depth =
+            stats.queue.flush_count == 0
+                ? 0.0
+                : static_cast<double>(stats.queue.total_depth)
+                      / static_cast<double>(stats.queue.flush_count);
+        TBX_TRACE_INFO(
+            "Message stats: {} flushes, queue depth avg {:.1f} max {}, {} coalesced.",
+            stats.queue.flush_count,
+            average_depth,
+            stats.queue.max_depth,
+            stats.coalesced_count);
+
+        constexpr size max_logged_entries = 5;
+        for (size index = 0; index < std::min(max_logged_entries, stats.message_types.size());
+             ++index)
+        {
+            const auto& entry = stats.message_types[index];
+            TBX_TRACE_INFO(
+                "  {}: {} dispatches, total {:.3f} ms, max {:.3f} ms",
+                entry.type_name,
+                entry.dispatch.dispatch_count,
+                to_milliseconds(entry.dispatch.total_time),
+                to_milliseconds(entry.dispatch.max_time));
+        }
+        for (size index = 0; index < std::min(max_logged_entries, stats.handlers.size()); ++index)
+        {
+            const auto& entry = stats.handlers[index];
+            TBX_TRACE_INFO(
+                "  handler {}: {} dispatches, total {:.3f} ms, max {:.3f} ms",
+                to_string(entry.handler),
+                entry.dispatch.dispatch_count,
+                to_milliseconds(entry.dispatch.total_time),
+                to_milliseconds(entry.dispatch.max_time));
+        }
+    }
+
     void AppMessageCoordinator::flush()
     {
+        TBX_PROFILE_SCOPE("AppMessageCoordinator::flush");
         std::vector<QueuedMessage> processing;
         {
             std::lock_guard<std::mutex> lock(_pending_mutex);
             processing.swap(_pending);
+            _pending_by_coalescing_key.clear();
         }
 
-        for (auto& entry : processing)
+        // Coalesced messages leave an empty slot behind.
+        std::erase_if(
+            processing,
+            [](const QueuedMessage& entry)
+            {
+                return !entry.message;
+            });
+
+        if (_is_instrumented.load(std::memory_order_relaxed))
         {
-            try
+            record_flush(processing.size());
+            log_stats_if_due();
+        }
+
+        if (processing.empty())
+            return;
+
+        // Group thread-safe messages into worker batches. Messages sharing a non-zero channel
+        // form one batch so they resolve in post order; channel 0 messages each get their own.
+        auto worker_batches = std::vector<std::vector<size>>();
+        auto batch_by_channel = std::unordered_map<uint64, size>();
+        auto resolve_on_worker = std::vector<bool>(processing.size(), false);
+        if (_job_system)
+        {
+            for (size index = 0; index < processing.size(); ++index)
             {
-                dispatch(*entry.message);
+                const auto& policy = processing[index].message->dispatch_policy;
+                if (!policy.is_thread_safe)
+                    continue;
+
+                resolve_on_worker[index] = true;
+                if (policy.channel == 0)
+                {
+                    worker_batches.push_back({index});
+                    continue;
+                }
+
+                auto [it, inserted] =
+                    batch_by_channel.try_emplace(policy.channel, worker_batches.size());
+                if (inserted)
+                    worker_batches.emplace_back();
+                worker_batches[it->second].push_back(index);
             }
-            catch (const std::exception& ex)
+        }
+
+        // One byte per message so workers never share a written element.
+        auto should_complete = std::vector<uint8>(processing.size(), 0);
+        auto worker_jobs = std::vector<std::future<void>>();
+        worker_jobs.reserve(worker_batches.size());
+        for (const auto& batch : worker_batches)
+        {
+            auto resolve_batch = [this, &batch, &processing, &should_complete]()
             {
-                apply_state(*entry.message, MessageState::ERROR, ex.what());
+                for (const auto index : batch)
+                    should_complete[index] = resolve(*processing[index].message) ? 1 : 0;
+            };
+
+            try
+            {
+                worker_jobs.push_back(_job_system->schedule_with_future(resolve_batch));
             }
             catch (...)
             {
-                apply_state(
-                    *entry.message,
-                    MessageState::ERROR,
-                    "Unknown exception during message dispatch.");
+                // The job system no longer accepts work, so resolve this batch on the caller.
+                resolve_batch();
             }
         }
+
+        // Main-thread messages resolve while workers run; there is no ordering between the two.
+        for (size index = 0; index < processing.size(); ++index)
+        {
+            if (!resolve_on_worker[index])
+                should_complete[index] = resolve(*processing[index].message) ? 1 : 0;
+        }
+
+        for (auto& job : worker_jobs)
+            job.get();
+
+        for (size index = 0; index < processing.size(); ++index)
+        {
+            if (should_complete[index])
+                complete_message(*processing[index].message);
+        }
     }
 }
@@ -2,15 +2,21 @@
 #include "tbx/app/events.h"
 #include "tbx/app/requests.h"
 #include "tbx/debugging/macros.h"
+#include "tbx/ecs/transform_interpolation.h"
+#include "tbx/files/archive.h"
 #include "tbx/files/ops.h"
 #include "tbx/graphics/events.h"
 #include "tbx/graphics/render_pipeline.h"
 #include "tbx/messages/dispatcher.h"
+#include "tbx/profiling/macros.h"
 #include "tbx/time/delta_time.h"
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <cmath>
+#include <format>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 
 namespace tbx
@@ -26,6 +32,46 @@ namespace tbx
 #endif
     }
 
+    constexpr auto FrameBudgetArgPrefix = std::string_view("--frame-budget-ms=");
+    constexpr auto FixedFrameArgPrefix = std::string_view("--fixed-frame-ms=");
+    constexpr auto MaxFramesArgPrefix = std::string_view("--max-frames=");
+    constexpr auto MaxSecondsArgPrefix = std::string_view("--max-seconds=");
+    constexpr auto TargetFpsArgPrefix = std::string_view("--target-fps=");
+    constexpr auto TargetFrameArgPrefix = std::string_view("--target-frame-ms=");
+    constexpr auto RecordSessionArgPrefix = std::string_view("--record-session=");
+    constexpr auto ReplaySessionArgPrefix = std::string_view("--replay-session=");
+    constexpr auto TextureBudgetArgPrefix = std::string_view("--texture-budget-mb=");
+    constexpr auto ModelBudgetArgPrefix = std::string_view("--model-budget-mb=");
+    constexpr auto AudioBudgetArgPrefix = std::string_view("--audio-budget-mb=");
+    constexpr size BytesPerMegabyte = 1024U * 1024U;
+    constexpr auto RegistryIndexFileName = std::string_view("asset_registry.index");
+
+    // Parses the non-negative number following `prefix` in `arg`.
+    // Leaves `out_value` untouched and returns false when the arg does not match or is malformed.
+    template <typename TValue>
+    static bool try_parse_arg_value(std::string_view arg, std::string_view prefix, TValue& out_value)
+    {
+        if (!arg.starts_with(prefix))
+            return false;
+
+        const auto text = arg.substr(prefix.size());
+        auto value = TValue {};
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc() || end != text.data() + text.size() || value < TValue {})
+        {
+            TBX_TRACE_WARNING("Ignoring malformed argument '{}'.", arg);
+            return false;
+        }
+
+        out_value = value;
+        return true;
+    }
+
+    static double to_milliseconds(std::chrono::nanoseconds duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
 #if defined(TBX_DEBUG)
     static std::string build_debug_window_title(
         const std::string& base_title,
@@ -42,23 +88,56 @@ namespace tbx
     }
 #endif
 
+    // Each archive stands in for the directory of the same name, so `resources.tbxa` serves
+    // `resources/`. Files missing from every archive still load from disk.
+    static std::shared_ptr<IFileOps> create_asset_file_ops(const AppDescription& desc)
+    {
+        if (desc.asset_archives.empty())
+            return {};
+
+        auto file_ops = std::make_shared<ArchiveFileOps>(desc.working_root);
+        for (const auto& archive_path : desc.asset_archives)
+        {
+            auto mount_directory = archive_path;
+            mount_directory.replace_extension();
+            if (const auto mount_result = file_ops->mount(archive_path, mount_directory);
+                !mount_result)
+            {
+                TBX_TRACE_WARNING("{}", mount_result.get_report());
+            }
+        }
+        return file_ops;
+    }
+
     static ServiceProvider create_service_provider(const AppDescription& desc)
     {
         auto service_provider = ServiceProvider {};
 
         service_provider.register_service<Handle>(std::make_unique<Handle>(desc.icon));
-        service_provider.register_service<IMessageCoordinator>(
-            std::make_unique<AppMessageCoordinator>());
+        service_provider.register_service<JobSystem>(std::make_unique<JobSystem>());
+        auto message_coordinator =
+            std::make_unique<AppMessageCoordinator>(&service_provider.get_service<JobSystem>());
+        if (std::ranges::find(desc.args, "--message-stats") != desc.args.end())
+        {
+            message_coordinator->set_instrumentation_enabled(true);
+            message_coordinator->set_stats_log_interval(std::chrono::seconds(5));
+        }
+        service_provider.register_service<IMessageCoordinator>(std::move(message_coordinator));
         service_provider.register_service<EntityRegistry>(std::make_unique<EntityRegistry>());
         service_provider.register_service<AssetManager>(std::make_unique<AssetManager>(
             &service_provider.get_service<IMessageCoordinator>(),
-            desc.working_root));
+            desc.working_root,
+            std::vector<std::filesystem::path> {},
+            HandleSource {},
+            std::unique_ptr<IAssetHandleSerializer> {},
+            create_asset_file_ops(desc)));
+        service_provider.get_service<AssetManager>().set_job_system(
+            &service_provider.get_service<JobSystem>());
         service_provider.register_service<AppSettings>(std::make_unique<AppSettings>(
             service_provider.get_service<IMessageCoordinator>(),
             false,
             GraphicsApi::OPEN_GL,
             Size {0, 0}));
-        service_provider.register_service<JobSystem>(std::make_unique<JobSystem>());
         service_provider.register_service<ThreadManager>(std::make_unique<ThreadManager>());
 
         return service_provider;
@@ -76,16 +155,83 @@ namespace tbx
             settings.paths.logs_directory = file_operator.resolve("logs");
         else
             settings.paths.logs_directory = file_operator.resolve(desc.logs_directory);
+        if (desc.cooked_assets_directory.empty())
+            settings.paths.cooked_assets_directory = file_operator.resolve("cooked");
+        else
+            settings.paths.cooked_assets_directory =
+                file_operator.resolve(desc.cooked_assets_directory);
 
+        settings.run = desc.run;
         for (auto& arg : desc.args)
         {
+            if (arg == "--pipelined-rendering")
+                settings.graphics.pipelined_rendering_enabled = true;
+
+            if (arg == "--message-stats")
+                _plugin_manager.set_message_instrumentation_enabled(true);
+
+            if (arg == "--frame-telemetry-csv")
+            {
+                const auto csv_path = settings.paths.logs_directory / "frame_telemetry.csv";
+                if (const auto csv_result = _frame_telemetry.enable_csv_output(csv_path); !csv_result)
+                    TBX_TRACE_WARNING("{}", csv_result.get_report());
+            }
+
+            auto budget_ms = 0.0;
+            if (try_parse_arg_value(arg, FrameBudgetArgPrefix, budget_ms))
+            {
+                _frame_telemetry.set_frame_budget(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::duration<double, std::milli>(budget_ms)));
+            }
+
+            if (arg == "--headless")
+                settings.run.is_headless = true;
+
+            auto fixed_frame_ms = 0.0;
+            if (try_parse_arg_value(arg, FixedFrameArgPrefix, fixed_frame_ms))
+                settings.run.fixed_frame_seconds = fixed_frame_ms / 1000.0;
+
+            try_parse_arg_value(arg, MaxFramesArgPrefix, settings.run.max_frame_count);
+            try_parse_arg_value(arg, MaxSecondsArgPrefix, settings.run.max_run_seconds);
+            try_parse_arg_value(arg, TargetFpsArgPrefix, settings.run.target_frame_rate);
+
+            if (arg == "--adaptive-quality")
+                settings.quality.is_enabled = true;
+
+            auto target_frame_ms = 0.0;
+            if (try_parse_arg_value(arg, TargetFrameArgPrefix, target_frame_ms)
+                && target_frame_ms > 0.0)
+            {
+                settings.quality.target_frame_time =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::duration<double, std::milli>(target_frame_ms));
+            }
+
+            if (arg.starts_with(RecordSessionArgPrefix))
+                settings.run.record_session_path = arg.substr(RecordSessionArgPrefix.size());
+            if (arg.starts_with(ReplaySessionArgPrefix))
+                settings.run.replay_session_path = arg.substr(ReplaySessionArgPrefix.size());
+
+            if (arg == "--no-cooked-assets")
+                settings.paths.cooked_assets_directory.clear();
+
+            auto& collection = settings.asset_collection;
+            auto budget_mb = size(0U);
+            if (try_parse_arg_value(arg, TextureBudgetArgPrefix, budget_mb))
+                collection.set_memory_budget<Texture>(budget_mb * BytesPerMegabyte);
+            if (try_parse_arg_value(arg, ModelBudgetArgPrefix, budget_mb))
+                collection.set_memory_budget<Model>(budget_mb * BytesPerMegabyte);
+            if (try_parse_arg_value(arg, AudioBudgetArgPrefix, budget_mb))
+                collection.set_memory_budget<AudioClip>(budget_mb * BytesPerMegabyte);
+
             // TODO:
-            // -- headless
             // -- screenshot count seconds-between
-            // -- close-after time-in-milliseconds
-            // -- benchmark
         }
 
+        if (settings.run.is_headless)
+            settings.graphics.graphics_api = GraphicsApi::NONE;
+
         initialize(desc.requested_plugins);
     }
 
@@ -101,6 +247,7 @@ namespace tbx
             auto& msg_coordinator = _service_provider.get_service<IMessageCoordinator>();
             GlobalDispatcherScope scope(msg_coordinator);
 
+            TBX_PROFILE_THREAD("main");
             auto timer = DeltaTimer();
             auto* window_manager = _service_provider.try_get_service<IWindowManager>();
             if (window_manager && _main_window.is_valid() && !window_manager->open(_main_window))
@@ -109,9 +256,15 @@ namespace tbx
                 return -1;
             }
 
+            const auto& run_settings = _service_provider.get_service<AppSettings>().run;
             while (!_should_exit)
             {
                 update(timer);
+
+                // Pace outside the telemetry frame so frame times keep measuring work only.
+                _frame_limiter.set_target_frame_rate(run_settings.target_frame_rate);
+                _frame_limiter.set_adaptive(run_settings.is_frame_limiter_adaptive);
+                _frame_limiter.wait_for_next_frame();
             }
 
             return 0;
@@ -143,16 +296,86 @@ namespace tbx
         return _service_provider;
     }
 
+    FrameTelemetry& Application::get_frame_telemetry()
+    {
+        return _frame_telemetry;
+    }
+
+    const FrameTelemetry& Application::get_frame_telemetry() const
+    {
+        return _frame_telemetry;
+    }
+
+    FrameLimiter& Application::get_frame_limiter()
+    {
+        return _frame_limiter;
+    }
+
+    const FrameLimiter& Application::get_frame_limiter() const
+    {
+        return _frame_limiter;
+    }
+
+    SessionRecorder& Application::get_session_recorder()
+    {
+        return _session_recorder;
+    }
+
+    const SessionRecorder& Application::get_session_recorder() const
+    {
+        return _session_recorder;
+    }
+
+    SessionPlayer& Application::get_session_player()
+    {
+        return _session_player;
+    }
+
+    const SessionPlayer& Application::get_session_player() const
+    {
+        return _session_player;
+    }
+
+    const AssetCollectionStats& Application::get_last_asset_collection_stats() const
+    {
+        return _last_asset_collection_stats;
+    }
+
+    QualityController& Application::get_quality_controller()
+    {
+        return _quality_controller;
+    }
+
+    const QualityController& Application::get_quality_controller() const
+    {
+        return _quality_controller;
+    }
+
     void Application::setup_filesystem_directories()
     {
         auto& settings = _service_provider.get_service<AppSettings>();
         auto& asset_manager = _service_provider.get_service<AssetManager>();
+
+        // Load the registry index before scanning so unchanged .meta files are not re-parsed.
+        if (!settings.paths.cooked_assets_directory.empty())
+        {
+            auto error = std::error_code();
+            std::filesystem::create_directories(settings.paths.cooked_assets_directory, error);
+            const auto index_result = asset_manager.load_registry_index(
+                settings.paths.cooked_assets_directory / RegistryIndexFileName);
+            if (!index_result)
+                TBX_TRACE_WARNING("{}", index_result.get_report());
+        }
+
         const auto resource_directory = get_default_asset_directory();
         if (!resource_directory.empty())
             asset_manager.add_directory(resource_directory);
 
         TBX_TRACE_INFO("Working Directory: '{}'", settings.paths.working_directory.string());
         TBX_TRACE_INFO("Logs Directory: '{}'", settings.paths.logs_directory.string());
+        TBX_TRACE_INFO(
+            "Cooked Assets Directory: '{}'",
+            settings.paths.cooked_assets_directory.string());
         auto asset_roots = asset_manager.get_directories();
         if (asset_roots.size() > 1)
         {
@@ -275,8 +498,43 @@ namespace tbx
                 requested_plugins,
                 settings.paths.working_directory);
 
-            setup_main_window();
-            compose_rendering_service();
+            if (settings.run.is_headless)
+                TBX_TRACE_INFO("Running headless. Main window and rendering are disabled.");
+            else
+            {
+                setup_main_window();
+                compose_rendering_service();
+
+                _quality_controller.set_settings(settings.quality);
+                _quality_controller.set_dispatcher(&msg_coordinator);
+                add_graphics_quality_knobs(_quality_controller, settings.graphics);
+            }
+
+            if (!settings.run.replay_session_path.empty())
+            {
+                const auto replay_path =
+                    FileOperator(settings.paths.working_directory)
+                        .resolve(settings.run.replay_session_path);
+                if (const auto load_result = _session_player.load(replay_path); load_result)
+                {
+                    TBX_TRACE_INFO(
+                        "Replaying {} recorded frames from {}.",
+                        _session_player.get_frame_count(),
+                        replay_path.string());
+                }
+                else
+                    TBX_TRACE_WARNING("{}", load_result.get_report());
+            }
+            if (!settings.run.record_session_path.empty())
+            {
+                const auto record_path =
+                    FileOperator(settings.paths.working_directory)
+                        .resolve(settings.run.record_session_path);
+                if (const auto start_result = _session_recorder.start(record_path); start_result)
+                    TBX_TRACE_INFO("Recording session to {}.", record_path.string());
+                else
+                    TBX_TRACE_WARNING("{}", start_result.get_report());
+            }
 
             // Tell everyone we're initialized
             msg_coordinator.send<ApplicationInitializedEvent>(this);
@@ -311,64 +569,155 @@ namespace tbx
 
     void Application::update(DeltaTimer& timer)
     {
+        TBX_PROFILE_SCOPE("Application::update");
         auto& msg_coordinator = _service_provider.get_service<IMessageCoordinator>();
         auto& asset_manager = _service_provider.get_service<AssetManager>();
 
-        // Process messages posted in previous frame
-        msg_coordinator.flush();
+        _frame_telemetry.begin_frame();
+
+        // Process messages posted in previous frame and publish assets decoded since then
+        {
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::MESSAGES);
+            msg_coordinator.flush();
+            asset_manager.publish_decoded_assets();
+            asset_manager.advance_preloads();
+        }
+
+        // Take the next recorded frame when replaying a session
+        auto replay_frame = std::optional<SessionFrame>();
+        if (_session_player.is_loaded())
+        {
+            replay_frame = _session_player.next_frame();
+            if (!replay_frame && !_should_exit)
+            {
+                TBX_TRACE_INFO(
+                    "Session replay finished after {} frames.",
+                    _session_player.get_frame_index());
+                _should_exit = true;
+            }
+        }
 
         // Update delta time
-        DeltaTime dt = timer.tick();
+        const auto& run_settings = _service_provider.get_service<AppSettings>().run;
+        const DeltaTime measured_dt = timer.tick();
+        DeltaTime dt = measured_dt;
+        if (run_settings.fixed_frame_seconds > 0.0)
+        {
+            dt = DeltaTime {
+                .seconds = run_settings.fixed_frame_seconds,
+                .milliseconds = run_settings.fixed_frame_seconds * 1000.0,
+            };
+        }
+        else if (replay_frame)
+        {
+            dt = DeltaTime {
+                .seconds = replay_frame->delta_seconds,
+                .milliseconds = replay_frame->delta_seconds * 1000.0,
+            };
+        }
         _time_running += dt.seconds;
-        _asset_unload_elapsed_seconds += dt.seconds;
+
+        // Re-send the messages captured during the recorded frame
+        if (replay_frame)
+        {
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::MESSAGES);
+            for (auto& message : _session_player.decode_messages(*replay_frame))
+                msg_coordinator.send<Message>(*message);
+        }
 
         // Begin update
-        msg_coordinator.send<ApplicationUpdateBeginEvent>(this, dt);
+        {
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::MESSAGES);
+            msg_coordinator.send<ApplicationUpdateBeginEvent>(this, dt);
+        }
 
         // Run fixed update logic
-        fixed_update(dt);
+        {
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::FIXED_UPDATE);
+            fixed_update(dt);
+        }
 
         // Update all loaded plugins
-        _plugin_manager.update(dt);
+        {
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::PLUGIN_UPDATE);
+            _plugin_manager.update(dt);
+        }
 
         if (auto* rendering = _service_provider.try_get_service<IRendering>())
-            rendering->render();
+        {
+            TBX_PROFILE_SCOPE("Rendering::render");
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::RENDER);
+            rendering->render(_interpolation_alpha);
+        }
 
+        auto recorded_input = std::optional<InputDeviceSnapshot>();
         if (auto* input_manager = _service_provider.try_get_service<IInputManager>())
+        {
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::INPUT);
+            if (replay_frame && replay_frame->input)
+                input_manager->set_device_snapshot_override(replay_frame->input);
+            if (_session_recorder.is_recording())
+                recorded_input = input_manager->get_device_snapshot();
             input_manager->update(dt);
+        }
 
 #if defined(TBX_DEBUG)
         update_debug_main_window_title(dt);
 #endif
 
         // End update
-        msg_coordinator.send<ApplicationUpdateEndEvent>(this, dt);
+        {
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::MESSAGES);
+            msg_coordinator.send<ApplicationUpdateEndEvent>(this, dt);
+        }
+
+        _session_recorder.record_frame(dt.seconds, recorded_input ? &*recorded_input : nullptr);
 
         // Gather metrics
         ++_update_count;
-        if (_asset_unload_elapsed_seconds >= 1.0)
         {
-            asset_manager.unload_unreferenced();
-            _asset_unload_elapsed_seconds = 0.0;
+            // A bounded slice per frame instead of a periodic full sweep avoids a hitch that grows
+            // with the number of loaded assets.
+            auto phase = FramePhaseScope(_frame_telemetry, FramePhase::ASSET_UNLOAD);
+            _last_asset_collection_stats = asset_manager.collect_unreferenced(
+                _service_provider.get_service<AppSettings>().asset_collection);
+            _asset_collection_sample.examined_count += _last_asset_collection_stats.examined_count;
+            _asset_collection_sample.unloaded_count += _last_asset_collection_stats.unloaded_count;
+            _asset_collection_sample.evicted_count += _last_asset_collection_stats.evicted_count;
+            _asset_collection_sample.elapsed += _last_asset_collection_stats.elapsed;
+            _max_asset_collection_time =
+                std::max(_max_asset_collection_time, _last_asset_collection_stats.elapsed);
+            if (_last_asset_collection_stats.has_completed_pass)
+                ++_asset_collection_pass_count;
         }
 
-        ++_performance_sample_frame_count;
-        _performance_sample_elapsed_seconds += dt.seconds;
-
-        if (!_performance_sample_has_data)
+        const auto& frame = _frame_telemetry.end_frame();
+        if (const auto decision = _quality_controller.record_frame(frame.frame_time))
         {
-            _performance_sample_min_frame_time_ms = dt.milliseconds;
-            _performance_sample_max_frame_time_ms = dt.milliseconds;
-            _performance_sample_has_data = true;
+            TBX_TRACE_INFO(
+                "Adaptive quality: '{}' level {} -> {} (frame time avg {:.2f}ms, target {:.2f}ms).",
+                decision->knob,
+                decision->previous_level,
+                decision->current_level,
+                to_milliseconds(decision->average_frame_time),
+                to_milliseconds(_quality_controller.get_settings().target_frame_time));
         }
-        else
+        if (frame.is_over_budget && !_was_previous_frame_over_budget)
+            log_frame_stall(frame);
+        _was_previous_frame_over_budget = frame.is_over_budget;
+
+        if (!_should_exit && has_reached_run_limit(run_settings))
         {
-            _performance_sample_min_frame_time_ms =
-                std::min(_performance_sample_min_frame_time_ms, dt.milliseconds);
-            _performance_sample_max_frame_time_ms =
-                std::max(_performance_sample_max_frame_time_ms, dt.milliseconds);
+            TBX_TRACE_INFO(
+                "Run limit reached after {} frames and {:.2f}s of simulated time.",
+                _update_count,
+                _time_running);
+            _should_exit = true;
         }
 
+        ++_performance_sample_frame_count;
+        _performance_sample_elapsed_seconds += measured_dt.seconds;
+
         // Log performance metrics
 #ifdef TBX_DEBUG
         constexpr double performance_log_interval_seconds = 10.0;
@@ -388,18 +737,102 @@ namespace tbx
                                         / static_cast<double>(_performance_sample_frame_count);
             }
 
+            const auto frame_stats = _frame_telemetry.get_stats();
             TBX_TRACE_INFO(
-                "FPS(avg): {:.2f}, Frame Time(avg): {:.2f}ms, Frame Time(min/max): {:.2f}/{:.2f}ms",
+                "FPS(avg): {:.2f}, Frame Time(avg): {:.2f}ms, Frame Time(p50/p95/p99/max over last "
+                "{} frames): {:.2f}/{:.2f}/{:.2f}/{:.2f}ms, Over Budget: {}",
                 average_fps,
                 average_frame_time_ms,
-                _performance_sample_min_frame_time_ms,
-                _performance_sample_max_frame_time_ms);
+                frame_stats.frame_count,
+                to_milliseconds(frame_stats.frame.p50),
+                to_milliseconds(frame_stats.frame.p95),
+                to_milliseconds(frame_stats.frame.p99),
+                to_milliseconds(frame_stats.frame.max),
+                frame_stats.over_budget_count);
+
+            if (_frame_limiter.get_target_frame_rate() > 0.0)
+            {
+                const auto pacing_stats = _frame_limiter.get_stats();
+                TBX_TRACE_INFO(
+                    "Frame Pacing(target {:.1f} FPS): Jitter(avg/max): {:.3f}/{:.3f}ms, Sleep "
+                    "Overshoot(avg): {:.3f}ms, Spin Threshold: {:.3f}ms, Late Frames: {}",
+                    _frame_limiter.get_target_frame_rate(),
+                    to_milliseconds(pacing_stats.average_jitter),
+                    to_milliseconds(pacing_stats.max_jitter),
+                    to_milliseconds(pacing_stats.average_sleep_overshoot),
+                    to_milliseconds(_frame_limiter.get_spin_threshold()),
+                    pacing_stats.late_frame_count);
+                _frame_limiter.reset_stats();
+            }
+
+            if (_quality_controller.get_settings().is_enabled)
+            {
+                const auto& quality_stats = _quality_controller.get_stats();
+                TBX_TRACE_INFO(
+                    "Adaptive Quality(target {:.2f}ms): Frame Time(window avg): {:.2f}ms, "
+                    "Downgrades: {}, Upgrades: {}",
+                    to_milliseconds(_quality_controller.get_settings().target_frame_time),
+                    to_milliseconds(quality_stats.last_average_frame_time),
+                    quality_stats.downgrade_count,
+                    quality_stats.upgrade_count);
+            }
+
+            if (_plugin_manager.is_message_instrumentation_enabled())
+            {
+                constexpr size max_logged_plugins = 5;
+                const auto plugin_stats = _plugin_manager.get_message_stats();
+                for (size index = 0; index < std::min(max_logged_plugins, plugin_stats.size());
+                     ++index)
+                {
+                    const auto& entry = plugin_stats[index];
+                    TBX_TRACE_INFO(
+                        "Plugin Messages({}): {} dispatches, total {:.3f}ms, max {:.3f}ms",
+                        entry.plugin_name,
+                        entry.dispatch.dispatch_count,
+                        to_milliseconds(entry.dispatch.total_time),
+                        to_milliseconds(entry.dispatch.max_time));
+                }
+                _plugin_manager.reset_message_stats();
+            }
+
+            const auto average_asset_collection_ms =
+                _performance_sample_frame_count > 0U
+                    ? to_milliseconds(_asset_collection_sample.elapsed)
+                          / static_cast<double>(_performance_sample_frame_count)
+                    : 0.0;
+            TBX_TRACE_INFO(
+                "Asset Collection: Examined: {}, Unloaded: {}, Evicted: {}, Full Sweeps: {}, Step "
+                "Time(avg/max): {:.3f}/{:.3f}ms",
+                _asset_collection_sample.examined_count,
+                _asset_collection_sample.unloaded_count,
+                _asset_collection_sample.evicted_count,
+                _asset_collection_pass_count,
+                average_asset_collection_ms,
+                to_milliseconds(_max_asset_collection_time));
+            for (const auto& usage : asset_manager.get_memory_usage())
+            {
+                if (usage.budget_bytes == 0U)
+                {
+                    TBX_TRACE_INFO(
+                        "Asset Memory({}): {:.2f}MB",
+                        usage.type_name,
+                        static_cast<double>(usage.resident_bytes) / BytesPerMegabyte);
+                    continue;
+                }
+
+                TBX_TRACE_INFO(
+                    "Asset Memory({}): {:.2f}/{:.2f}MB, Evicted: {}",
+                    usage.type_name,
+                    static_cast<double>(usage.resident_bytes) / BytesPerMegabyte,
+                    static_cast<double>(usage.budget_bytes) / BytesPerMegabyte,
+                    usage.evicted_count);
+            }
+            _asset_collection_sample = {};
+            _asset_collection_pass_count = 0U;
+            _max_asset_collection_time = {};
 
             _performance_sample_elapsed_seconds = 0.0;
             _performance_sample_frame_count = 0U;
-            _performance_sample_min_frame_time_ms = 0.0;
-            _performance_sample_max_frame_time_ms = 0.0;
-            _performance_sample_has_data = false;
 
             // Warn if average FPS is below 30
             if (average_fps < 30.0)
@@ -411,6 +844,35 @@ namespace tbx
         }
     }
 
+    bool Application::has_reached_run_limit(const RunSettings& run_settings) const
+    {
+        if (run_settings.max_frame_count > 0 && _update_count >= run_settings.max_frame_count)
+            return true;
+
+        return run_settings.max_run_seconds > 0.0 && _time_running >= run_settings.max_run_seconds;
+    }
+
+    void Application::log_frame_stall(const FrameSample& frame) const
+    {
+        auto breakdown = std::string();
+        for (size phase = 0; phase < FramePhaseCount; ++phase)
+        {
+            if (!breakdown.empty())
+                breakdown += ", ";
+            breakdown += std::format(
+                "{}: {:.2f}ms",
+                to_string(static_cast<FramePhase>(phase)),
+                to_milliseconds(frame.phase_times[phase]));
+        }
+
+        TBX_TRACE_WARNING(
+            "Frame {} took {:.2f}ms, over the {:.2f}ms budget ({}).",
+            frame.frame_index,
+            to_milliseconds(frame.frame_time),
+            to_milliseconds(_frame_telemetry.get_frame_budget()),
+            breakdown);
+    }
+
 #if defined(TBX_DEBUG)
     void Application::update_debug_main_window_title(const DeltaTime& dt)
     {
@@ -455,15 +917,15 @@ namespace tbx
 
     void Application::fixed_update(const DeltaTime& dt)
     {
+        TBX_PROFILE_SCOPE("Application::fixed_update");
         auto& physics_settings = _service_provider.get_service<AppSettings>().physics;
         double fixed_step_seconds =
             std::max(0.0001, static_cast<double>(physics_settings.fixed_time_step_seconds.value));
         int max_sub_steps = std::max(1, static_cast<int>(physics_settings.max_sub_steps.value));
 
         _fixed_update_accumulator_seconds += dt.seconds;
-        if (_fixed_update_accumulator_seconds < fixed_step_seconds)
-            return;
 
+        auto& entity_registry = _service_provider.get_service<EntityRegistry>();
         int sub_step_count = 0;
         while (_fixed_update_accumulator_seconds >= fixed_step_seconds
                && sub_step_count < max_sub_steps)
@@ -473,7 +935,9 @@ namespace tbx
                 .milliseconds = fixed_step_seconds * 1000.0,
             };
 
+            capture_previous_transforms(entity_registry);
             _plugin_manager.fixed_update(fixed_dt);
+            capture_current_transforms(entity_registry);
 
             _fixed_update_accumulator_seconds -= fixed_step_seconds;
             ++sub_step_count;
@@ -483,6 +947,10 @@ namespace tbx
             static_cast<double>(fixed_step_seconds) * static_cast<double>(max_sub_steps);
         if (_fixed_update_accumulator_seconds > max_accumulator_seconds)
             _fixed_update_accumulator_seconds = max_accumulator_seconds;
+
+        // How far rendering sits between the last two fixed steps.
+        _interpolation_alpha = static_cast<float>(
+            std::clamp(_fixed_update_accumulator_seconds / fixed_step_seconds, 0.0, 1.0));
     }
 
     void Application::shutdown()
@@ -516,12 +984,16 @@ namespace tbx
             _main_window = {};
             _should_exit = true;
 
-            // 3. Detach and unload plugins using dependency-aware unload ordering.
+            // 3. Let in-flight asset decodes leave their loader plugins, then detach and unload
+            // plugins using dependency-aware unload ordering.
+            _service_provider.get_service<JobSystem>().wait_for_idle();
             _plugin_manager.unload_all();
 
             // 4. Unregister all entities and unload assets after plugin teardown.
             entity_registry.clear();
             asset_manager.unload_all();
+            if (const auto index_result = asset_manager.save_registry_index(); !index_result)
+                TBX_TRACE_WARNING("{}", index_result.get_report());
 
             // 5. Stop dedicated thread lanes after plugin teardown.
             thread_manager.stop_all();
@@ -529,6 +1001,23 @@ namespace tbx
             // 6. Process any remaining posted messages and clear handlers
             msg_coordinator.flush();
             msg_coordinator.clear_handlers();
+
+            // 7. Finish the session recording
+            if (_session_recorder.is_recording())
+            {
+                TBX_TRACE_INFO("Recorded {} session frames.", _session_recorder.get_frame_count());
+                _session_recorder.stop();
+            }
+
+#if defined(TBX_PROFILING_ENABLED)
+            // 8. Export the CPU profile captured over the whole run
+            const auto trace_path = _service_provider.get_service<AppSettings>().paths.logs_directory
+                                    / "profile_trace.json";
+            if (const auto trace_result = Profiler::write_chrome_trace(trace_path); trace_result)
+                TBX_TRACE_INFO("CPU profile written to {}.", trace_path.string());
+            else
+                TBX_TRACE_WARNING("CPU profile export failed: {}", trace_result.get_report());
+#endif
         }
         catch (const std::exception& ex)
         {
@@ -552,7 +1041,7 @@ namespace tbx
             TBX_ASSERT(false, "Unknown exception during application shutdown.");
         }
 
-        // 7. Log shutdown metrics
+        // 9. Log shutdown metrics
         auto shutdown_elapsed_ms = std::chrono::duration<double, std::milli>(
                                        std::chrono::steady_clock::now() - shutdown_begin)
                                        .count();
@@ -562,6 +1051,8 @@ namespace tbx
 
     void Application::recieve_message(Message& msg)
     {
+        _session_recorder.capture_message(msg);
+
         if (auto* exit_request = handle_message<ExitApplicationRequest>(msg))
         {
             _should_exit = true;
@@ -575,6 +1066,15 @@ namespace tbx
                 _should_exit = true;
         }
 
+        // Plugins release windows and backends on these, and a pipelined frame may still be
+        // drawing to them. The render pipeline's handler runs after this one, so drain here.
+        if (handle_message<WindowNativeHandleReleasingEvent>(msg)
+            || handle_property_changed<&GraphicsSettings::graphics_api>(msg))
+        {
+            if (auto* rendering = _service_provider.try_get_service<IRendering>())
+                rendering->wait_for_frames_in_flight();
+        }
+
         _plugin_manager.receive_message(msg);
     }
 }
@@ -0,0 +1,249 @@
+#include "tbx/app/frame_telemetry.h"
+#include <algorithm>
+#include <cmath>
+
+namespace tbx
+{
+    namespace
+    {
+        constexpr size MaxRecentStallCount = 32;
+
+        // Nearest-rank percentile over an ascending list.
+        std::chrono::nanoseconds get_percentile(
+            const std::vector<std::chrono::nanoseconds>& sorted_values,
+            double percentile)
+        {
+            if (sorted_values.empty())
+                return {};
+
+            const auto rank = static_cast<size>(
+                std::ceil(percentile / 100.0 * static_cast<double>(sorted_values.size())));
+            return sorted_values[std::clamp<size>(rank, 1, sorted_values.size()) - 1];
+        }
+
+        FrameTimeStats build_time_stats(std::vector<std::chrono::nanoseconds>& values)
+        {
+            if (values.empty())
+                return {};
+
+            std::ranges::sort(values);
+            auto total = std::chrono::nanoseconds {};
+            for (const auto value : values)
+                total += value;
+
+            return FrameTimeStats {
+                .average = total / static_cast<int64>(values.size()),
+                .p50 = get_percentile(values, 50.0),
+                .p95 = get_percentile(values, 95.0),
+                .p99 = get_percentile(values, 99.0),
+                .max = values.back(),
+            };
+        }
+
+        void write_milliseconds(std::ofstream& stream, std::chrono::nanoseconds duration)
+        {
+            stream << std::chrono::duration<double, std::milli>(duration).count();
+        }
+    }
+
+    std::string to_string(FramePhase phase)
+    {
+        switch (phase)
+        {
+            case FramePhase::MESSAGES:
+                return "messages";
+            case FramePhase::FIXED_UPDATE:
+                return "fixed_update";
+            case FramePhase::PLUGIN_UPDATE:
+                return "plugin_update";
+            case FramePhase::RENDER:
+                return "render";
+            case FramePhase::INPUT:
+                return "input";
+            case FramePhase::ASSET_UNLOAD:
+                return "asset_unload";
+            case FramePhase::OTHER:
+                return "other";
+            default:
+                return "unknown";
+        }
+    }
+
+    FrameTelemetry::FrameTelemetry(size window_frame_count, std::chrono::nanoseconds frame_budget)
+        : _samples(std::max<size>(window_frame_count, 1))
+        , _frame_budget(frame_budget)
+    {
+    }
+
+    void FrameTelemetry::begin_frame()
+    {
+        _current = FrameSample {.frame_index = _frame_index};
+        _frame_start = std::chrono::steady_clock::now();
+    }
+
+    void FrameTelemetry::add_phase_time(FramePhase phase, std::chrono::nanoseconds duration)
+    {
+        _current.phase_times[static_cast<size>(phase)] += duration;
+    }
+
+    const FrameSample& FrameTelemetry::end_frame()
+    {
+        return end_frame(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - _frame_start));
+    }
+
+    const FrameSample& FrameTelemetry::end_frame(std::chrono::nanoseconds frame_time)
+    {
+        auto tracked_time = std::chrono::nanoseconds {};
+        for (size index = 0; index < FramePhaseCount - 1; ++index)
+            tracked_time += _current.phase_times[index];
+
+        _current.frame_time = frame_time;
+        _current.phase_times[static_cast<size>(FramePhase::OTHER)] =
+            std::max(frame_time - tracked_time, std::chrono::nanoseconds {});
+        _current.is_over_budget = _frame_budget.count() > 0 && frame_time > _frame_budget;
+
+        auto& sample = _samples[_next_sample_index];
+        sample = _current;
+        _next_sample_index = (_next_sample_index + 1) % _samples.size();
+        _sample_count = std::min(_sample_count + 1, _samples.size());
+        ++_frame_index;
+
+        if (sample.is_over_budget)
+        {
+            if (_recent_stalls.size() == MaxRecentStallCount)
+                _recent_stalls.pop_front();
+            _recent_stalls.push_back(sample);
+        }
+
+        if (_csv_stream.is_open())
+            write_csv_row(sample);
+
+        return sample;
+    }
+
+    FrameTelemetryStats FrameTelemetry::get_stats() const
+    {
+        auto stats = FrameTelemetryStats {.frame_count = _sample_count};
+        if (_sample_count == 0)
+            return stats;
+
+        const auto samples = get_samples();
+        auto values = std::vector<std::chrono::nanoseconds>();
+        values.reserve(samples.size());
+
+        for (const auto& sample : samples)
+        {
+            values.push_back(sample.frame_time);
+            if (sample.is_over_budget)
+                ++stats.over_budget_count;
+        }
+        stats.frame = build_time_stats(values);
+
+        for (size phase = 0; phase < FramePhaseCount; ++phase)
+        {
+            values.clear();
+            for (const auto& sample : samples)
+                values.push_back(sample.phase_times[phase]);
+            stats.phases[phase] = build_time_stats(values);
+        }
+
+        return stats;
+    }
+
+    std::vector<FrameSample> FrameTelemetry::get_samples() const
+    {
+        auto samples = std::vector<FrameSample>();
+        samples.reserve(_sample_count);
+
+        const auto first_index = (_next_sample_index + _samples.size() - _sample_count) % _samples.size();
+        for (size offset = 0; offset < _sample_count; ++offset)
+            samples.push_back(_samples[(first_index + offset) % _samples.size()]);
+
+        return samples;
+    }
+
+    const std::deque<FrameSample>& FrameTelemetry::get_recent_stalls() const
+    {
+        return _recent_stalls;
+    }
+
+    size FrameTelemetry::get_window_frame_count() const
+    {
+        return _samples.size();
+    }
+
+    std::chrono::nanoseconds FrameTelemetry::get_frame_budget() const
+    {
+        return _frame_budget;
+    }
+
+    void FrameTelemetry::set_frame_budget(std::chrono::nanoseconds frame_budget)
+    {
+        _frame_budget = frame_budget;
+    }
+
+    Result FrameTelemetry::enable_csv_output(const std::filesystem::path& path)
+    {
+        disable_csv_output();
+
+        auto error = std::error_code();
+        const auto has_existing_rows = std::filesystem::file_size(path, error) > 0 && !error;
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path(), error);
+
+        _csv_stream.open(path, std::ios::out | std::ios::app);
+        if (!_csv_stream)
+            return Result(false, "Failed to open frame telemetry CSV: " + path.string());
+
+        if (!has_existing_rows)
+        {
+            _csv_stream << "frame,frame_ms";
+            for (size phase = 0; phase < FramePhaseCount; ++phase)
+                _csv_stream << ',' << to_string(static_cast<FramePhase>(phase)) << "_ms";
+            _csv_stream << ",over_budget\n";
+        }
+
+        return {};
+    }
+
+    void FrameTelemetry::disable_csv_output()
+    {
+        if (_csv_stream.is_open())
+            _csv_stream.close();
+    }
+
+    void FrameTelemetry::reset()
+    {
+        _next_sample_index = 0;
+        _sample_count = 0;
+        _recent_stalls.clear();
+    }
+
+    void FrameTelemetry::write_csv_row(const FrameSample& sample)
+    {
+        _csv_stream << sample.frame_index << ',';
+        write_milliseconds(_csv_stream, sample.frame_time);
+        for (const auto phase_time : sample.phase_times)
+        {
+            _csv_stream << ',';
+            write_milliseconds(_csv_stream, phase_time);
+        }
+        _csv_stream << ',' << (sample.is_over_budget ? 1 : 0) << '\n';
+    }
+
+    FramePhaseScope::FramePhaseScope(FrameTelemetry& telemetry, FramePhase phase)
+        : _telemetry(telemetry)
+        , _phase(phase)
+        , _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    FramePhaseScope::~FramePhaseScope() noexcept
+    {
+        _telemetry.add_phase_time(
+            _phase,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - _start));
+    }
+}
@@ -0,0 +1,477 @@
+#include "tbx/app/session_recording.h"
+#include "tbx/debugging/macros.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <utility>
+
+namespace tbx
+{
+    namespace
+    {
+        constexpr auto SessionMagic = std::array<char, 4> {'T', 'B', 'X', 'S'};
+        constexpr uint32 SessionVersion = 1U;
+
+        // Frame flag bits. An input snapshot is only written when it differs from the last one,
+        // so a frame may carry input without a payload and reuse the previous snapshot.
+        constexpr uint8 FrameHasInput = 1U << 0U;
+        constexpr uint8 FrameInputChanged = 1U << 1U;
+
+        template <typename TValue>
+        void write_value(std::vector<uint8>& out, const TValue& value)
+        {
+            const auto* bytes = reinterpret_cast<const uint8*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(TValue));
+        }
+
+        void write_bytes(std::vector<uint8>& out, const std::vector<uint8>& bytes)
+        {
+            write_value(out, static_cast<uint32>(bytes.size()));
+            out.insert(out.end(), bytes.begin(), bytes.end());
+        }
+
+        void write_string(std::vector<uint8>& out, const std::string& text)
+        {
+            write_value(out, static_cast<uint32>(text.size()));
+            out.insert(out.end(), text.begin(), text.end());
+        }
+
+        // Sets and maps are written sorted so equal snapshots always produce equal bytes.
+        void write_int_set(std::vector<uint8>& out, const std::unordered_set<int>& values)
+        {
+            auto sorted = std::vector<int>(values.begin(), values.end());
+            std::sort(sorted.begin(), sorted.end());
+            write_value(out, static_cast<uint32>(sorted.size()));
+            for (const int value : sorted)
+                write_value(out, value);
+        }
+
+        void write_snapshot(std::vector<uint8>& out, const InputDeviceSnapshot& snapshot)
+        {
+            write_int_set(out, snapshot.keyboard.pressed_keys);
+
+            write_int_set(out, snapshot.mouse.pressed_buttons);
+            write_value(out, snapshot.mouse.position.x);
+            write_value(out, snapshot.mouse.position.y);
+            write_value(out, snapshot.mouse.delta.x);
+            write_value(out, snapshot.mouse.delta.y);
+            write_value(out, snapshot.mouse.wheel_delta);
+
+            auto controller_indices = std::vector<int>();
+            controller_indices.reserve(snapshot.controllers.size());
+            for (const auto& [controller_index, _] : snapshot.controllers)
+                controller_indices.push_back(controller_index);
+            std::sort(controller_indices.begin(), controller_indices.end());
+
+            write_value(out, static_cast<uint32>(controller_indices.size()));
+            for (const int controller_index : controller_indices)
+            {
+                const auto& controller = snapshot.controllers.at(controller_index);
+                write_value(out, controller_index);
+                write_value(out, static_cast<uint8>(controller.is_connected ? 1U : 0U));
+                write_value(out, controller.controller_index);
+                write_int_set(out, controller.pressed_buttons);
+
+                auto axes = std::vector<std::pair<int, float>>(
+                    controller.axis_values.begin(),
+                    controller.axis_values.end());
+                std::sort(axes.begin(), axes.end());
+                write_value(out, static_cast<uint32>(axes.size()));
+                for (const auto& [axis, value] : axes)
+                {
+                    write_value(out, axis);
+                    write_value(out, value);
+                }
+            }
+        }
+
+        /// @brief
+        /// Purpose: Reads values back out of a session buffer with bounds checking.
+        /// @details
+        /// Ownership: Borrows the buffer; it must outlive the reader.
+        /// Thread Safety: Not thread-safe.
+        class SessionReader
+        {
+          public:
+            SessionReader(const std::vector<uint8>& data, size offset = 0U)
+                : _data(data)
+                , _offset(offset)
+            {
+            }
+
+          public:
+            bool is_at_end() const
+            {
+                return _offset >= _data.size();
+            }
+
+            template <typename TValue>
+            bool read_value(TValue& out_value)
+            {
+                if (_data.size() - _offset < sizeof(TValue))
+                    return false;
+
+                std::memcpy(&out_value, _data.data() + _offset, sizeof(TValue));
+                _offset += sizeof(TValue);
+                return true;
+            }
+
+            bool read_bytes(std::vector<uint8>& out_bytes)
+            {
+                auto byte_count = uint32 {};
+                if (!read_value(byte_count) || _data.size() - _offset < byte_count)
+                    return false;
+
+                const auto begin = _data.begin() + static_cast<std::ptrdiff_t>(_offset);
+                out_bytes.assign(begin, begin + byte_count);
+                _offset += byte_count;
+                return true;
+            }
+
+            bool read_string(std::string& out_text)
+            {
+                auto byte_count = uint32 {};
+                if (!read_value(byte_count) || _data.size() - _offset < byte_count)
+                    return false;
+
+                out_text.assign(
+                    reinterpret_cast<const char*>(_data.data() + _offset),
+                    byte_count);
+                _offset += byte_count;
+                return true;
+            }
+
+            bool read_int_set(std::unordered_set<int>& out_values)
+            {
+                auto count = uint32 {};
+                if (!read_value(count))
+                    return false;
+
+                out_values.clear();
+                for (uint32 index = 0U; index < count; ++index)
+                {
+                    auto value = 0;
+                    if (!read_value(value))
+                        return false;
+                    out_values.insert(value);
+                }
+                return true;
+            }
+
+            bool read_snapshot(InputDeviceSnapshot& out_snapshot)
+            {
+                out_snapshot = {};
+                if (!read_int_set(out_snapshot.keyboard.pressed_keys)
+                    || !read_int_set(out_snapshot.mouse.pressed_buttons)
+                    || !read_value(out_snapshot.mouse.position.x)
+                    || !read_value(out_snapshot.mouse.position.y)
+                    || !read_value(out_snapshot.mouse.delta.x)
+                    || !read_value(out_snapshot.mouse.delta.y)
+                    || !read_value(out_snapshot.mouse.wheel_delta))
+                    return false;
+
+                auto controller_count = uint32 {};
+                if (!read_value(controller_count))
+                    return false;
+
+                for (uint32 index = 0U; index < controller_count; ++index)
+                {
+                    auto key = 0;
+                    auto is_connected = uint8 {};
+                    auto controller = ControllerState();
+                    auto axis_count = uint32 {};
+                    if (!read_value(key) || !read_value(is_connected)
+                        || !read_value(controller.controller_index)
+                        || !read_int_set(controller.pressed_buttons) || !read_value(axis_count))
+                        return false;
+
+                    controller.is_connected = is_connected != 0U;
+                    for (uint32 axis_index = 0U; axis_index < axis_count; ++axis_index)
+                    {
+                        auto axis = 0;
+                        auto value = 0.0F;
+                        if (!read_value(axis) || !read_value(value))
+                            return false;
+                        controller.axis_values[axis] = value;
+                    }
+
+                    out_snapshot.controllers[key] = std::move(controller);
+                }
+                return true;
+            }
+
+          private:
+            const std::vector<uint8>& _data;
+            size _offset = 0U;
+        };
+    }
+
+    SessionRecorder::~SessionRecorder() noexcept
+    {
+        stop();
+    }
+
+    Result SessionRecorder::start(const std::filesystem::path& path)
+    {
+        stop();
+
+        auto lock = std::lock_guard(_mutex);
+        auto error = std::error_code();
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path(), error);
+
+        _stream.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!_stream)
+            return Result(false, "Failed to open session recording: " + path.string());
+
+        _stream.write(SessionMagic.data(), static_cast<std::streamsize>(SessionMagic.size()));
+        _stream.write(reinterpret_cast<const char*>(&SessionVersion), sizeof(SessionVersion));
+        _pending_messages.clear();
+        _last_input_payload.clear();
+        _has_last_input = false;
+        _frame_count = 0U;
+        return {};
+    }
+
+    void SessionRecorder::stop()
+    {
+        auto lock = std::lock_guard(_mutex);
+        if (_stream.is_open())
+            _stream.close();
+        _pending_messages.clear();
+    }
+
+    bool SessionRecorder::is_recording() const
+    {
+        auto lock = std::lock_guard(_mutex);
+        return _stream.is_open();
+    }
+
+    void SessionRecorder::add_codec(SessionMessageCodec codec)
+    {
+        auto lock = std::lock_guard(_mutex);
+        _codecs.push_back(std::move(codec));
+    }
+
+    void SessionRecorder::capture_message(const Message& message)
+    {
+        auto lock = std::lock_guard(_mutex);
+        if (!_stream.is_open())
+            return;
+
+        for (const auto& codec : _codecs)
+        {
+            auto payload = std::vector<uint8>();
+            if (!codec.encode || !codec.encode(message, payload))
+                continue;
+
+            _pending_messages.push_back(
+                SessionMessageRecord {
+                    .type_name = codec.type_name,
+                    .payload = std::move(payload),
+                });
+            return;
+        }
+    }
+
+    void SessionRecorder::record_frame(double delta_seconds, const InputDeviceSnapshot* input)
+    {
+        auto lock = std::lock_guard(_mutex);
+        if (!_stream.is_open())
+            return;
+
+        _frame_buffer.clear();
+        write_value(_frame_buffer, delta_seconds);
+
+        auto flags = uint8 {};
+        auto input_payload = std::vector<uint8>();
+        if (input)
+        {
+            flags |= FrameHasInput;
+            write_snapshot(input_payload, *input);
+            if (!_has_last_input || input_payload != _last_input_payload)
+                flags |= FrameInputChanged;
+        }
+
+        write_value(_frame_buffer, flags);
+        if ((flags & FrameInputChanged) != 0U)
+        {
+            write_bytes(_frame_buffer, input_payload);
+            _last_input_payload = std::move(input_payload);
+            _has_last_input = true;
+        }
+
+        write_value(_frame_buffer, static_cast<uint32>(_pending_messages.size()));
+        for (const auto& record : _pending_messages)
+        {
+            write_string(_frame_buffer, record.type_name);
+            write_bytes(_frame_buffer, record.payload);
+        }
+        _pending_messages.clear();
+
+        _stream.write(
+            reinterpret_cast<const char*>(_frame_buffer.data()),
+            static_cast<std::streamsize>(_frame_buffer.size()));
+        ++_frame_count;
+    }
+
+    uint64 SessionRecorder::get_frame_count() const
+    {
+        auto lock = std::lock_guard(_mutex);
+        return _frame_count;
+    }
+
+    Result SessionPlayer::load(const std::filesystem::path& path)
+    {
+        _frames.clear();
+        _next_frame_index = 0U;
+        _is_loaded = false;
+
+        auto stream = std::ifstream(path, std::ios::in | std::ios::binary);
+        if (!stream)
+            return Result(false, "Failed to open session recording: " + path.string());
+
+        const auto data = std::vector<uint8>(
+            std::istreambuf_iterator<char>(stream),
+            std::istreambuf_iterator<char>());
+        auto reader = SessionReader(data);
+
+        auto magic = std::array<char, 4> {};
+        auto version = uint32 {};
+        if (!reader.read_value(magic) || magic != SessionMagic || !reader.read_value(version))
+            return Result(false, "Not a session recording: " + path.string());
+        if (version != SessionVersion)
+        {
+            return Result(
+                false,
+                std::format(
+                    "Unsupported session recording version {} (expected {}): {}",
+                    version,
+                    SessionVersion,
+                    path.string()));
+        }
+
+        auto current_input = std::optional<InputDeviceSnapshot>();
+        while (!reader.is_at_end())
+        {
+            auto frame = SessionFrame();
+            auto flags = uint8 {};
+            auto message_count = uint32 {};
+            auto is_valid = reader.read_value(frame.delta_seconds) && reader.read_value(flags);
+
+            if (is_valid && (flags & FrameInputChanged) != 0U)
+            {
+                auto input_payload = std::vector<uint8>();
+                auto snapshot = InputDeviceSnapshot();
+                is_valid = reader.read_bytes(input_payload)
+                           && SessionReader(input_payload).read_snapshot(snapshot);
+                if (is_valid)
+                    current_input = std::move(snapshot);
+            }
+            if (is_valid && (flags & FrameHasInput) != 0U)
+            {
+                is_valid = current_input.has_value();
+                frame.input = current_input;
+            }
+
+            is_valid = is_valid && reader.read_value(message_count);
+            for (uint32 index = 0U; is_valid && index < message_count; ++index)
+            {
+                auto record = SessionMessageRecord();
+                is_valid = reader.read_string(record.type_name) && reader.read_bytes(record.payload);
+                if (is_valid)
+                    frame.messages.push_back(std::move(record));
+            }
+
+            if (!is_valid)
+            {
+                _frames.clear();
+                return Result(
+                    false,
+                    std::format(
+                        "Session recording is corrupt at frame {}: {}",
+                        _frames.size(),
+                        path.string()));
+            }
+
+            _frames.push_back(std::move(frame));
+        }
+
+        _is_loaded = true;
+        return {};
+    }
+
+    bool SessionPlayer::is_loaded() const
+    {
+        return _is_loaded;
+    }
+
+    void SessionPlayer::add_codec(SessionMessageCodec codec)
+    {
+        _codecs.push_back(std::move(codec));
+    }
+
+    bool SessionPlayer::has_next_frame() const
+    {
+        return _next_frame_index < _frames.size();
+    }
+
+    std::optional<SessionFrame> SessionPlayer::next_frame()
+    {
+        if (!has_next_frame())
+            return std::nullopt;
+
+        return _frames[_next_frame_index++];
+    }
+
+    std::vector<std::unique_ptr<Message>> SessionPlayer::decode_messages(
+        const SessionFrame& frame) const
+    {
+        auto messages = std::vector<std::unique_ptr<Message>>();
+        messages.reserve(frame.messages.size());
+        for (const auto& record : frame.messages)
+        {
+            const auto codec = std::find_if(
+                _codecs.begin(),
+                _codecs.end(),
+                [&record](const SessionMessageCodec& candidate)
+                {
+                    return candidate.type_name == record.type_name;
+                });
+            if (codec == _codecs.end() || !codec->decode)
+            {
+                TBX_TRACE_WARNING(
+                    "Skipping recorded message '{}': no codec is registered for it.",
+                    record.type_name);
+                continue;
+            }
+
+            auto message = codec->decode(record.payload);
+            if (!message)
+            {
+                TBX_TRACE_WARNING("Skipping malformed recorded message '{}'.", record.type_name);
+                continue;
+            }
+
+            messages.push_back(std::move(message));
+        }
+        return messages;
+    }
+
+    uint64 SessionPlayer::get_frame_count() const
+    {
+        return static_cast<uint64>(_frames.size());
+    }
+
+    uint64 SessionPlayer::get_frame_index() const
+    {
+        return static_cast<uint64>(_next_frame_index);
+    }
+
+    void SessionPlayer::rewind()
+    {
+        _next_frame_index = 0U;
+    }
+}
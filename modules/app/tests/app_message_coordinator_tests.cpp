@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "tbx/app/message_coordinator.h"
+#include "tbx/async/job_system.h"
 #include "tbx/async/cancellation_token.h"
 #include "tbx/messages/message.h"
 #include "tbx/time/span.h"
@@ -7,8 +8,11 @@
 #include <atomic>
 #include <chrono>
 #include <future>
+#include <mutex>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace tbx::tests::app
@@ -22,6 +26,11 @@ namespace tbx::tests::app
     {
     };
 
+    struct TestEvent : public Event
+    {
+        int value = 0;
+    };
+
     TEST(dispatcher_send, invokes_and_stops_on_handled)
     {
         AppMessageCoordinator d;
@@ -470,4 +479,323 @@ namespace tbx::tests::app
         EXPECT_EQ(call_order[0], 2);
     }
 
+    TEST(dispatcher_post_thread_safe, resolves_on_workers_and_completes_on_flushing_thread)
+    {
+        // Arrange
+        JobSystem job_system(JobSystemConfiguration {.worker_count = 2});
+        AppMessageCoordinator d(&job_system);
+        GlobalDispatcherScope dispatcher_scope(d);
+        const auto flushing_thread = std::this_thread::get_id();
+        std::atomic<int> worker_handled {0};
+        std::atomic<int> main_handled {0};
+        std::vector<std::thread::id> completion_threads = {};
+
+        d.register_handler(
+            [&](Message& msg)
+            {
+                if (std::this_thread::get_id() == flushing_thread)
+                    main_handled.fetch_add(1);
+                else
+                    worker_handled.fetch_add(1);
+                msg.state = MessageState::HANDLED;
+            });
+
+        std::vector<std::shared_future<Result>> futures = {};
+        for (int index = 0; index < 4; ++index)
+        {
+            TestMessage msg;
+            msg.dispatch_policy.is_thread_safe = index % 2 == 0;
+            msg.callbacks.on_processed = [&](const Message&)
+            {
+                completion_threads.push_back(std::this_thread::get_id());
+            };
+            futures.push_back(d.post(msg));
+        }
+
+        // Act
+        d.flush();
+
+        // Assert
+        EXPECT_EQ(worker_handled.load(), 2);
+        EXPECT_EQ(main_handled.load(), 2);
+        ASSERT_EQ(completion_threads.size(), 4U);
+        for (const auto& thread_id : completion_threads)
+            EXPECT_EQ(thread_id, flushing_thread);
+        for (auto& future : futures)
+            EXPECT_TRUE(future.get().succeeded());
+    }
+
+    TEST(dispatcher_post_thread_safe, preserves_post_order_within_channel)
+    {
+        // Arrange
+        JobSystem job_system(JobSystemConfiguration {.worker_count = 4});
+        AppMessageCoordinator d(&job_system);
+        GlobalDispatcherScope dispatcher_scope(d);
+        std::mutex order_mutex;
+        std::vector<int> channel_order = {};
+        std::vector<int> completion_order = {};
+
+        d.register_handler(
+            [&](Message& msg)
+            {
+                auto* typed = handle_message<TestMessage>(msg);
+                if (!typed)
+                    return;
+
+                if (typed->dispatch_policy.channel == 7)
+                {
+                    std::lock_guard<std::mutex> lock(order_mutex);
+                    channel_order.push_back(typed->value);
+                }
+                typed->state = MessageState::HANDLED;
+            });
+
+        for (int index = 0; index < 16; ++index)
+        {
+            TestMessage msg;
+            msg.value = index;
+            msg.dispatch_policy.is_thread_safe = true;
+            msg.dispatch_policy.channel = index % 2 == 0 ? 7 : 0;
+            msg.callbacks.on_processed = [&completion_order, index](const Message&)
+            {
+                completion_order.push_back(index);
+            };
+            d.post(msg);
+        }
+
+        // Act
+        d.flush();
+
+        // Assert
+        ASSERT_EQ(channel_order.size(), 8U);
+        for (size index = 0; index < channel_order.size(); ++index)
+            EXPECT_EQ(channel_order[index], static_cast<int>(index * 2));
+        ASSERT_EQ(completion_order.size(), 16U);
+        for (size index = 0; index < completion_order.size(); ++index)
+            EXPECT_EQ(completion_order[index], static_cast<int>(index));
+    }
+
+    TEST(dispatcher_post_coalescing, replaces_queued_message_with_same_key)
+    {
+        // Arrange
+        AppMessageCoordinator d;
+        GlobalDispatcherScope dispatcher_scope(d);
+        std::vector<int> handled_values = {};
+        int superseded_callbacks = 0;
+
+        d.register_handler(
+            [&](Message& msg)
+            {
+                if (auto* typed = handle_message<TestMessage>(msg))
+                {
+                    handled_values.push_back(typed->value);
+                    typed->state = MessageState::HANDLED;
+                }
+            });
+
+        std::vector<std::shared_future<Result>> futures = {};
+        for (int index = 0; index < 3; ++index)
+        {
+            TestMessage msg;
+            msg.value = index;
+            msg.dispatch_policy.coalescing_key = 42;
+            if (index < 2)
+            {
+                msg.callbacks.on_processed = [&superseded_callbacks](const Message&)
+                {
+                    ++superseded_callbacks;
+                };
+            }
+            futures.push_back(d.post(msg));
+        }
+
+        // Act
+        d.flush();
+
+        // Assert
+        ASSERT_EQ(handled_values.size(), 1U);
+        EXPECT_EQ(handled_values[0], 2);
+        EXPECT_EQ(superseded_callbacks, 2);
+        EXPECT_EQ(d.get_coalesced_count(), 2U);
+        for (auto& future : futures)
+        {
+            ASSERT_EQ(
+                future.wait_for(std::chrono::steady_clock::duration::zero()),
+                std::future_status::ready);
+            EXPECT_TRUE(future.get().succeeded());
+        }
+    }
+
+    TEST(dispatcher_post_coalescing, keeps_messages_with_different_keys_or_types)
+    {
+        // Arrange
+        AppMessageCoordinator d;
+        GlobalDispatcherScope dispatcher_scope(d);
+        std::vector<int> handled_values = {};
+
+        d.register_handler(
+            [&](Message& msg)
+            {
+                if (auto* typed = handle_message<TestMessage>(msg))
+                    handled_values.push_back(typed->value);
+                else
+                    handled_values.push_back(-1);
+                msg.state = MessageState::HANDLED;
+            });
+
+        TestMessage first;
+        first.value = 1;
+        first.dispatch_policy.coalescing_key = 1;
+        TestMessage second;
+        second.value = 2;
+        second.dispatch_policy.coalescing_key = 2;
+        Message other_type;
+        other_type.dispatch_policy.coalescing_key = 1;
+
+        // Act
+        d.post(first);
+        d.post(second);
+        d.post(other_type);
+        d.flush();
+
+        // Assert
+        ASSERT_EQ(handled_values.size(), 3U);
+        EXPECT_EQ(handled_values[0], 1);
+        EXPECT_EQ(handled_values[1], 2);
+        EXPECT_EQ(handled_values[2], -1);
+        EXPECT_EQ(d.get_coalesced_count(), 0U);
+    }
+
+    TEST(dispatcher_send_batch, routes_whole_batch_once)
+    {
+        // Arrange
+        AppMessageCoordinator d;
+        GlobalDispatcherScope dispatcher_scope(d);
+        int generic_calls = 0;
+        std::vector<int> batch_sizes = {};
+        std::vector<int> received_values = {};
+
+        d.register_handler(
+            [&](Message&)
+            {
+                ++generic_calls;
+            });
+        d.register_batch_handler<TestEvent>(
+            [&](std::span<TestEvent> events)
+            {
+                batch_sizes.push_back(static_cast<int>(events.size()));
+                for (auto& event : events)
+                {
+                    received_values.push_back(event.value);
+                    event.value *= 10;
+                }
+            });
+
+        std::vector<TestEvent> events(3);
+        for (int index = 0; index < 3; ++index)
+            events[index].value = index + 1;
+
+        // Act
+        auto result = d.send_batch(std::span<TestEvent>(events));
+
+        // Assert
+        EXPECT_TRUE(result.succeeded());
+        EXPECT_EQ(generic_calls, 1);
+        ASSERT_EQ(batch_sizes.size(), 1U);
+        EXPECT_EQ(batch_sizes[0], 3);
+        EXPECT_EQ(received_values, (std::vector<int> {1, 2, 3}));
+        EXPECT_EQ(events[2].value, 30);
+    }
+
+    TEST(dispatcher_send_batch, skips_dispatch_for_empty_batch)
+    {
+        // Arrange
+        AppMessageCoordinator d;
+        GlobalDispatcherScope dispatcher_scope(d);
+        int calls = 0;
+
+        d.register_handler(
+            [&](Message&)
+            {
+                ++calls;
+            });
+
+        // Act
+        auto result = d.send_batch(std::span<TestEvent>());
+
+        // Assert
+        EXPECT_TRUE(result.succeeded());
+        EXPECT_EQ(calls, 0);
+    }
+
+    TEST(dispatcher_instrumentation, records_type_handler_and_queue_stats)
+    {
+        // Arrange
+        AppMessageCoordinator d;
+        GlobalDispatcherScope dispatcher_scope(d);
+        d.set_instrumentation_enabled(true);
+
+        Uuid first_handler = d.register_handler([](Message&) {});
+        Uuid second_handler = d.register_handler(
+            [](Message& msg)
+            {
+                msg.state = MessageState::HANDLED;
+            });
+
+        // Act
+        TestMessage sent;
+        d.send(sent);
+        d.post(TestMessage());
+        d.post(TestEvent());
+        d.flush();
+
+        // Assert
+        auto stats = d.get_stats();
+        ASSERT_EQ(stats.message_types.size(), 2U);
+        uint64 test_message_dispatches = 0;
+        for (const auto& entry : stats.message_types)
+        {
+            if (entry.type_name == typeid(TestMessage).name())
+                test_message_dispatches = entry.dispatch.dispatch_count;
+
+            uint64 histogram_total = 0;
+            for (const auto bucket : entry.dispatch.latency_histogram)
+                histogram_total += bucket;
+            EXPECT_EQ(histogram_total, entry.dispatch.dispatch_count);
+            EXPECT_GE(entry.dispatch.total_time, entry.dispatch.max_time);
+        }
+        EXPECT_EQ(test_message_dispatches, 2U);
+
+        ASSERT_EQ(stats.handlers.size(), 2U);
+        for (const auto& entry : stats.handlers)
+        {
+            EXPECT_TRUE(entry.handler == first_handler || entry.handler == second_handler);
+            EXPECT_EQ(entry.dispatch.dispatch_count, 3U);
+        }
+
+        EXPECT_EQ(stats.queue.flush_count, 1U);
+        EXPECT_EQ(stats.queue.last_depth, 2U);
+        EXPECT_EQ(stats.queue.max_depth, 2U);
+    }
+
+    TEST(dispatcher_instrumentation, records_nothing_when_disabled)
+    {
+        // Arrange
+        AppMessageCoordinator d;
+        GlobalDispatcherScope dispatcher_scope(d);
+        d.register_handler([](Message&) {});
+
+        // Act
+        TestMessage sent;
+        d.send(sent);
+        d.post(TestMessage());
+        d.flush();
+
+        // Assert
+        auto stats = d.get_stats();
+        EXPECT_FALSE(d.is_instrumentation_enabled());
+        EXPECT_TRUE(stats.message_types.empty());
+        EXPECT_TRUE(stats.handlers.empty());
+        EXPECT_EQ(stats.queue.flush_count, 0U);
+    }
 }
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "tbx/app/application.h"
+#include "tbx/graphics/render_pipeline.h"
+#include "tbx/graphics/window.h"
+#include "tbx/input/manager.h"
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace tbx::tests::app
+{
+    static AppDescription make_run_limits_description(const std::string& name)
+    {
+        auto description = AppDescription();
+        description.name = name;
+        description.working_root = std::filesystem::temp_directory_path() / "tbx_app_run_limits";
+        return description;
+    }
+
+    TEST(application_run_limits, headless_run_exits_after_max_frame_count)
+    {
+        // Arrange
+        auto description = make_run_limits_description("Headless Frame Limit");
+        description.run.is_headless = true;
+        description.run.fixed_frame_seconds = 0.01;
+        description.run.max_frame_count = 5U;
+        auto application = Application(description);
+
+        // Act
+        const auto exit_code = application.run();
+
+        // Assert
+        EXPECT_EQ(exit_code, 0);
+        EXPECT_EQ(application.get_frame_telemetry().get_stats().frame_count, 5U);
+        EXPECT_FALSE(application.get_service_provider().has_service<IRendering>());
+    }
+
+    TEST(application_run_limits, headless_run_exits_after_max_simulated_seconds)
+    {
+        // Arrange
+        auto description = make_run_limits_description("Headless Time Limit");
+        description.args = {"--headless", "--fixed-frame-ms=250", "--max-seconds=1"};
+        auto application = Application(description);
+
+        // Act
+        const auto exit_code = application.run();
+
+        // Assert
+        EXPECT_EQ(exit_code, 0);
+        EXPECT_EQ(application.get_frame_telemetry().get_stats().frame_count, 4U);
+        EXPECT_FALSE(application.get_service_provider().has_service<IRendering>());
+    }
+
+#if defined(TBX_TEST_PLUGIN_DIRECTORY)
+    TEST(application_run_limits, headless_run_loads_default_plugins_without_display_services)
+    {
+        // Arrange
+        const auto plugin_directory = std::filesystem::path(TBX_TEST_PLUGIN_DIRECTORY);
+        if (!std::filesystem::exists(plugin_directory))
+            GTEST_SKIP() << "Plugins were not built at " << plugin_directory.string();
+
+        auto description = make_run_limits_description("Headless Default Plugins");
+        description.working_root = plugin_directory;
+        description.requested_plugins = {
+            "SdlInputPlugin",
+            "JoltPhysicsPlugin",
+            "SdlWindowingPlugin",
+            "OpenGlRenderingPlugin",
+            "StbImageLoaderPlugin",
+            "AssimpModelLoaderPlugin",
+            "GlslShaderLoaderPlugin",
+            "MatMaterialLoaderPlugin",
+            "SdlOpenGlAdapterPlugin",
+        };
+        description.args = {"--headless", "--fixed-frame-ms=10", "--max-frames=3"};
+        auto application = Application(description);
+
+        // Act
+        const auto exit_code = application.run();
+
+        // Assert
+        const auto& services = application.get_service_provider();
+        EXPECT_EQ(exit_code, 0);
+        EXPECT_EQ(application.get_frame_telemetry().get_stats().frame_count, 3U);
+        EXPECT_TRUE(services.has_service<IInputManager>());
+        EXPECT_FALSE(services.has_service<IWindowManager>());
+        EXPECT_FALSE(services.has_service<IGraphicsContextManager>());
+        EXPECT_FALSE(services.has_service<IGraphicsBackend>());
+        EXPECT_FALSE(services.has_service<IRendering>());
+    }
+#endif
+}
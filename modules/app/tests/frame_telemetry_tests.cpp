@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "tbx/app/frame_telemetry.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace tbx::tests::app
+{
+    using namespace std::chrono_literals;
+
+    TEST(frame_telemetry_stats, reports_percentiles_over_window)
+    {
+        // Arrange
+        auto telemetry = FrameTelemetry(100, 0ns);
+
+        // Act
+        for (int frame = 1; frame <= 100; ++frame)
+        {
+            telemetry.begin_frame();
+            telemetry.end_frame(std::chrono::milliseconds(frame));
+        }
+        const auto stats = telemetry.get_stats();
+
+        // Assert
+        EXPECT_EQ(stats.frame_count, 100U);
+        EXPECT_EQ(stats.frame.p50, 50ms);
+        EXPECT_EQ(stats.frame.p95, 95ms);
+        EXPECT_EQ(stats.frame.p99, 99ms);
+        EXPECT_EQ(stats.frame.max, 100ms);
+        EXPECT_EQ(stats.over_budget_count, 0U);
+    }
+
+    TEST(frame_telemetry_window, drops_frames_older_than_window)
+    {
+        // Arrange
+        auto telemetry = FrameTelemetry(4, 0ns);
+
+        // Act
+        for (const auto frame_time : {90ms, 1ms, 2ms, 3ms, 4ms})
+        {
+            telemetry.begin_frame();
+            telemetry.end_frame(frame_time);
+        }
+        const auto samples = telemetry.get_samples();
+
+        // Assert
+        ASSERT_EQ(samples.size(), 4U);
+        EXPECT_EQ(samples.front().frame_index, 1U);
+        EXPECT_EQ(samples.back().frame_index, 4U);
+        EXPECT_EQ(telemetry.get_stats().frame.max, 4ms);
+    }
+
+    TEST(frame_telemetry_budget, flags_stall_with_phase_breakdown)
+    {
+        // Arrange
+        auto telemetry = FrameTelemetry(8, 16ms);
+
+        // Act
+        telemetry.begin_frame();
+        telemetry.add_phase_time(FramePhase::PLUGIN_UPDATE, 5ms);
+        telemetry.end_frame(10ms);
+
+        telemetry.begin_frame();
+        telemetry.add_phase_time(FramePhase::RENDER, 4ms);
+        telemetry.add_phase_time(FramePhase::ASSET_UNLOAD, 20ms);
+        const auto stall = telemetry.end_frame(30ms);
+
+        // Assert
+        EXPECT_TRUE(stall.is_over_budget);
+        EXPECT_EQ(stall.phase_times[static_cast<size>(FramePhase::ASSET_UNLOAD)], 20ms);
+        EXPECT_EQ(stall.phase_times[static_cast<size>(FramePhase::OTHER)], 6ms);
+        EXPECT_EQ(stall.phase_times[static_cast<size>(FramePhase::PLUGIN_UPDATE)], 0ms);
+        ASSERT_EQ(telemetry.get_recent_stalls().size(), 1U);
+        EXPECT_EQ(telemetry.get_recent_stalls().front().frame_index, 1U);
+        EXPECT_EQ(telemetry.get_stats().over_budget_count, 1U);
+    }
+
+    TEST(frame_telemetry_csv, appends_one_row_per_frame)
+    {
+        // Arrange
+        const auto csv_path =
+            std::filesystem::temp_directory_path() / "tbx_frame_telemetry_tests.csv";
+        std::filesystem::remove(csv_path);
+        auto telemetry = FrameTelemetry(8, 16ms);
+        ASSERT_TRUE(telemetry.enable_csv_output(csv_path));
+
+        // Act
+        telemetry.begin_frame();
+        telemetry.end_frame(20ms);
+        telemetry.disable_csv_output();
+
+        // Assert
+        auto stream = std::ifstream(csv_path);
+        auto header = std::string();
+        auto row = std::string();
+        std::getline(stream, header);
+        std::getline(stream, row);
+        EXPECT_EQ(
+            header,
+            "frame,frame_ms,messages_ms,fixed_update_ms,plugin_update_ms,render_ms,input_ms,"
+            "asset_unload_ms,other_ms,over_budget");
+        EXPECT_EQ(row.substr(0, 5), "0,20,");
+        EXPECT_EQ(row.back(), '1');
+
+        stream.close();
+        std::filesystem::remove(csv_path);
+    }
+}
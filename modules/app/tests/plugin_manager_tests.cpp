@@ -43,6 +43,15 @@ namespace tbx::tests::app
         std::string source = {};
     };
 
+    struct ThreadSafePingMessage : public PluginPingMessage
+    {
+        ThreadSafePingMessage(std::string source_name)
+            : PluginPingMessage(std::move(source_name))
+        {
+            dispatch_policy.is_thread_safe = true;
+        }
+    };
+
     class TestPlugin final : public Plugin
     {
       public:
@@ -206,4 +215,83 @@ namespace tbx::tests::app
         EXPECT_EQ(plugin->received_sources[1], "Solo_detach");
         EXPECT_EQ(plugin->detach_count, 1);
     }
+
+    TEST(plugin_manager, routes_thread_safe_messages_only_to_opted_in_plugins)
+    {
+        // Arrange
+        const std::filesystem::path working_directory = "/virtual/plugin_manager";
+        auto service_provider = make_test_service_provider(working_directory);
+        auto file_ops =
+            std::make_shared<tbx::tests::file_system::InMemoryFileOps>(working_directory);
+        PluginManager manager = PluginManager(service_provider, file_ops);
+        auto& coordinator = service_provider.get_service<IMessageCoordinator>();
+        coordinator.register_handler(
+            [&manager](Message& msg)
+            {
+                manager.receive_message(msg);
+            });
+        std::shared_ptr<TestPluginState> loader = {};
+        std::shared_ptr<TestPluginState> other = {};
+        auto loader_plugin = make_loaded_plugin("Loader", loader);
+        loader_plugin.meta.is_thread_safe_messages = true;
+        manager.add(std::move(loader_plugin));
+        manager.add(make_loaded_plugin("Other", other));
+
+        // Act
+        coordinator.send<ThreadSafePingMessage>("worker");
+        coordinator.send<PluginPingMessage>("main");
+        EXPECT_TRUE(manager.unload("Loader"));
+        coordinator.send<ThreadSafePingMessage>("after_unload");
+
+        // Assert
+        ASSERT_NE(loader, nullptr);
+        ASSERT_NE(other, nullptr);
+        ASSERT_EQ(loader->received_sources.size(), 2U);
+        EXPECT_EQ(loader->received_sources[0], "worker");
+        EXPECT_EQ(loader->received_sources[1], "main");
+        ASSERT_EQ(other->received_sources.size(), 1U);
+        EXPECT_EQ(other->received_sources[0], "main");
+    }
+
+    TEST(plugin_manager, records_per_plugin_message_timing_only_while_instrumented)
+    {
+        // Arrange
+        const std::filesystem::path working_directory = "/virtual/plugin_manager";
+        auto service_provider = make_test_service_provider(working_directory);
+        auto file_ops =
+            std::make_shared<tbx::tests::file_system::InMemoryFileOps>(working_directory);
+        PluginManager manager = PluginManager(service_provider, file_ops);
+        auto& coordinator = service_provider.get_service<IMessageCoordinator>();
+        coordinator.register_handler(
+            [&manager](Message& msg)
+            {
+                manager.receive_message(msg);
+            });
+        std::shared_ptr<TestPluginState> alpha = {};
+        std::shared_ptr<TestPluginState> beta = {};
+        manager.add(make_loaded_plugin("Alpha", alpha));
+        manager.add(make_loaded_plugin("Beta", beta));
+
+        // Act
+        coordinator.send<PluginPingMessage>("untimed");
+        const auto untimed_stats = manager.get_message_stats();
+        manager.set_message_instrumentation_enabled(true);
+        coordinator.send<PluginPingMessage>("first");
+        coordinator.send<PluginPingMessage>("second");
+        const auto timed_stats = manager.get_message_stats();
+        manager.reset_message_stats();
+
+        // Assert
+        EXPECT_TRUE(untimed_stats.empty());
+        ASSERT_EQ(timed_stats.size(), 2U);
+        for (const auto& entry : timed_stats)
+        {
+            EXPECT_TRUE(entry.plugin_name == "Alpha" || entry.plugin_name == "Beta");
+            EXPECT_EQ(entry.dispatch.dispatch_count, 2U);
+        }
+        EXPECT_GE(timed_stats[0].dispatch.total_time, timed_stats[1].dispatch.total_time);
+        EXPECT_TRUE(manager.get_message_stats().empty());
+        EXPECT_EQ(alpha->receive_count, 3);
+        EXPECT_EQ(beta->receive_count, 3);
+    }
 }
@@ -0,0 +1,122 @@
+#include "pch.h"
+#include "tbx/app/session_recording.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace tbx::tests::app
+{
+    struct RecordedValueEvent : public Event
+    {
+        int value = 0;
+    };
+
+    static SessionMessageCodec make_value_codec()
+    {
+        return SessionMessageCodec {
+            .type_name = "RecordedValueEvent",
+            .encode =
+                [](const Message& message, std::vector<uint8>& out_payload)
+            {
+                const auto* event = handle_message<RecordedValueEvent>(message);
+                if (!event)
+                    return false;
+
+                out_payload.resize(sizeof(int));
+                std::memcpy(out_payload.data(), &event->value, sizeof(int));
+                return true;
+            },
+            .decode = [](const std::vector<uint8>& payload) -> std::unique_ptr<Message>
+            {
+                if (payload.size() != sizeof(int))
+                    return nullptr;
+
+                auto event = std::make_unique<RecordedValueEvent>();
+                std::memcpy(&event->value, payload.data(), sizeof(int));
+                return event;
+            },
+        };
+    }
+
+    TEST(session_recording_round_trip, replays_frames_input_and_messages)
+    {
+        // Arrange
+        const auto session_path =
+            std::filesystem::temp_directory_path() / "tbx_session_recording_tests.tbxs";
+        auto recorder = SessionRecorder();
+        recorder.add_codec(make_value_codec());
+        ASSERT_TRUE(recorder.start(session_path));
+
+        auto input = InputDeviceSnapshot();
+        input.keyboard.pressed_keys = {4, 7};
+        input.mouse.position = Vec2(10.0F, 20.0F);
+        input.controllers[0].axis_values[1] = 0.5F;
+
+        // Act
+        auto event = RecordedValueEvent();
+        event.value = 42;
+        recorder.capture_message(event);
+        recorder.capture_message(Event());
+        recorder.record_frame(0.016, &input);
+        recorder.record_frame(0.017, &input);
+        input.keyboard.pressed_keys.erase(4);
+        recorder.record_frame(0.018, &input);
+        recorder.stop();
+
+        auto player = SessionPlayer();
+        player.add_codec(make_value_codec());
+        const auto load_result = player.load(session_path);
+
+        // Assert
+        ASSERT_TRUE(load_result) << load_result.get_report();
+        ASSERT_EQ(player.get_frame_count(), 3U);
+
+        const auto first = player.next_frame();
+        ASSERT_TRUE(first.has_value());
+        EXPECT_DOUBLE_EQ(first->delta_seconds, 0.016);
+        ASSERT_TRUE(first->input.has_value());
+        EXPECT_TRUE(first->input->keyboard.pressed_keys.contains(4));
+        EXPECT_FLOAT_EQ(first->input->mouse.position.y, 20.0F);
+        EXPECT_FLOAT_EQ(first->input->controllers.at(0).axis_values.at(1), 0.5F);
+        const auto messages = player.decode_messages(*first);
+        ASSERT_EQ(messages.size(), 1U);
+        EXPECT_EQ(handle_message<RecordedValueEvent>(*messages.front())->value, 42);
+
+        const auto second = player.next_frame();
+        ASSERT_TRUE(second.has_value());
+        ASSERT_TRUE(second->input.has_value());
+        EXPECT_TRUE(second->input->keyboard.pressed_keys.contains(4));
+        EXPECT_TRUE(second->messages.empty());
+
+        const auto third = player.next_frame();
+        ASSERT_TRUE(third.has_value());
+        EXPECT_DOUBLE_EQ(third->delta_seconds, 0.018);
+        EXPECT_FALSE(third->input->keyboard.pressed_keys.contains(4));
+        EXPECT_FALSE(player.next_frame().has_value());
+
+        std::filesystem::remove(session_path);
+    }
+
+    TEST(session_recording_load, rejects_truncated_file)
+    {
+        // Arrange
+        const auto session_path =
+            std::filesystem::temp_directory_path() / "tbx_session_recording_truncated.tbxs";
+        auto recorder = SessionRecorder();
+        ASSERT_TRUE(recorder.start(session_path));
+        recorder.record_frame(0.016);
+        recorder.stop();
+        std::filesystem::resize_file(session_path, std::filesystem::file_size(session_path) - 2U);
+
+        // Act
+        auto player = SessionPlayer();
+        const auto load_result = player.load(session_path);
+
+        // Assert
+        EXPECT_FALSE(load_result);
+        EXPECT_FALSE(player.is_loaded());
+        EXPECT_EQ(player.get_frame_count(), 0U);
+
+        std::filesystem::remove(session_path);
+    }
+}
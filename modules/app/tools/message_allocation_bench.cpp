@@ -0,0 +1,129 @@
+#include "tbx/app/message_coordinator.h"
+#include "tbx/messages/message.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+// Measures the heap traffic and time of routing events through AppMessageCoordinator:
+//   TbxMessageAllocationBench [message-count]
+// Each event reaches two handlers, once through send and once through post followed by flush.
+// Allocations are counted by replacing the global operator new in this executable, so builds
+// that link the engine as shared libraries on Windows only see the allocations made here.
+namespace
+{
+    std::atomic<uint64> allocation_count = 0U;
+}
+
+void* operator new(std::size_t byte_count)
+{
+    allocation_count.fetch_add(1U, std::memory_order_relaxed);
+    if (auto* memory = std::malloc(byte_count == 0U ? 1U : byte_count))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace tbx
+{
+    struct MessageBenchEvent : public Event
+    {
+        MessageBenchEvent(uint payload_value)
+            : payload(payload_value)
+        {
+        }
+
+        uint payload = 0U;
+    };
+
+    struct MessageBenchSample
+    {
+        double allocations_per_message = 0.0;
+        double nanoseconds_per_message = 0.0;
+    };
+
+    // Runs `dispatch` once per message and reports the average allocations and wall time.
+    template <typename TDispatch>
+    static MessageBenchSample measure_dispatch(const uint message_count, TDispatch&& dispatch)
+    {
+        const auto allocations_before = allocation_count.load();
+        const auto start = std::chrono::steady_clock::now();
+        dispatch(message_count);
+        const auto elapsed = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start);
+        const auto allocations = allocation_count.load() - allocations_before;
+        return MessageBenchSample {
+            .allocations_per_message = static_cast<double>(allocations) / message_count,
+            .nanoseconds_per_message = elapsed.count() / message_count,
+        };
+    }
+
+    static void print_sample(const std::string& label, const MessageBenchSample& sample)
+    {
+        std::cout << label << ": " << sample.allocations_per_message << " allocations, "
+                  << sample.nanoseconds_per_message << " ns per message\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        std::cerr << "Usage: TbxMessageAllocationBench [message-count]\n";
+        return 2;
+    }
+
+    const auto message_count = argc > 1 ? static_cast<uint>(std::stoul(argv[1])) : 100000U;
+    if (message_count == 0U)
+    {
+        std::cerr << "Message count must be greater than zero.\n";
+        return 2;
+    }
+
+    auto coordinator = tbx::AppMessageCoordinator();
+    auto payload_sum = uint64(0U);
+    for (uint handler_index = 0U; handler_index < 2U; ++handler_index)
+    {
+        coordinator.register_handler(
+            [&payload_sum](tbx::Message& msg)
+            {
+                if (const auto* event = tbx::handle_message<tbx::MessageBenchEvent>(msg))
+                    payload_sum += event->payload;
+            });
+    }
+
+    const auto send = tbx::measure_dispatch(
+        message_count,
+        [&coordinator](const uint count)
+        {
+            for (uint message_index = 0U; message_index < count; ++message_index)
+            {
+                auto event = tbx::MessageBenchEvent(message_index);
+                coordinator.send(event);
+            }
+        });
+    const auto post = tbx::measure_dispatch(
+        message_count,
+        [&coordinator](const uint count)
+        {
+            for (uint message_index = 0U; message_index < count; ++message_index)
+                coordinator.post<tbx::MessageBenchEvent>(message_index);
+            coordinator.flush();
+        });
+
+    tbx::print_sample("send", send);
+    tbx::print_sample("post+flush", post);
+    std::cout << "Handled payload checksum: " << payload_sum << '\n';
+    return 0;
+}
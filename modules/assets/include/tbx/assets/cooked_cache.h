@@ -0,0 +1,77 @@
+#pragma once
+#include "tbx/common/result.h"
+#include "tbx/common/typedefs.h"
+#include "tbx/files/ops.h"
+#include "tbx/graphics/material.h"
+#include "tbx/graphics/model.h"
+#include "tbx/graphics/texture.h"
+#include "tbx/tbx_api.h"
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Identifies one cooked asset blob by the bytes it was decoded from and the settings
+    /// it was decoded with.
+    /// @details
+    /// Ownership: Value type.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API CookedAssetKey
+    {
+        uint64 source_hash = 0U;
+        uint64 parameter_hash = 0U;
+
+        bool operator==(const CookedAssetKey& other) const = default;
+    };
+
+    /// @brief
+    /// Purpose: Stores decoded textures, models, and materials as versioned binary blobs so later
+    /// runs can skip image decoding, model import, and JSON parsing.
+    /// @details
+    /// Ownership: Owns its cache directory path; blobs on disk are shared with other processes.
+    /// Blobs are read through a memory mapping and decoded in place, so only the decoded asset
+    /// data is copied.
+    /// Thread Safety: Safe to call concurrently. Blobs are written to a temporary file and renamed
+    /// into place, so readers never observe a partially written blob.
+    /// Blobs written by a different cache version or for a different asset kind are treated as
+    /// misses and overwritten by the next write.
+    class TBX_API CookedAssetCache final
+    {
+      public:
+        CookedAssetCache(std::filesystem::path cache_directory);
+
+      public:
+        // Hashes the source file contents together with a loader-defined encoding of the
+        // parameters that affect the decoded result.
+        static CookedAssetKey make_key(
+            std::string_view source_data,
+            std::string_view parameters = {});
+
+        const std::filesystem::path& get_directory() const;
+
+        bool try_read(const CookedAssetKey& key, Texture& out_texture) const;
+        bool try_read(const CookedAssetKey& key, Model& out_model) const;
+        bool try_read(const CookedAssetKey& key, Material& out_material) const;
+
+        Result write(const CookedAssetKey& key, const Texture& texture) const;
+        Result write(const CookedAssetKey& key, const Model& model) const;
+        Result write(const CookedAssetKey& key, const Material& material) const;
+
+      private:
+        std::filesystem::path get_blob_path(const CookedAssetKey& key, uint32 kind) const;
+        // Maps the blob and validates its header. `out_payload` views the bytes after the header
+        // and stays valid while `out_blob` is alive.
+        bool read_blob(
+            const CookedAssetKey& key,
+            uint32 kind,
+            FileView& out_blob,
+            std::string_view& out_payload) const;
+        Result write_blob(const CookedAssetKey& key, uint32 kind, const std::string& payload) const;
+
+      private:
+        std::filesystem::path _directory = {};
+        FileOperator _file_ops = {};
+    };
+}
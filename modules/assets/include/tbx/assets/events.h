@@ -2,6 +2,7 @@
 #include "tbx/common/handle.h"
 #include "tbx/messages/message.h"
 #include <filesystem>
+#include <functional>
 #include <utility>
 
 namespace tbx
@@ -16,6 +17,8 @@ namespace tbx
             , asset_path(std::move(changed_asset_path))
             , affected_asset(std::move(handle))
         {
+            // Editors emit bursts of writes per save; only the latest change per path matters.
+            dispatch_policy.coalescing_key = std::filesystem::hash_value(asset_path);
         }
 
         std::filesystem::path watched_asset_directory = {};
@@ -44,6 +47,7 @@ namespace tbx
             : affected_asset(std::move(handle))
             , succeeded(was_successful)
         {
+            dispatch_policy.coalescing_key = std::hash<Handle>()(affected_asset);
         }
 
         Handle affected_asset = {};
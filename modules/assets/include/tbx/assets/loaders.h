@@ -7,11 +7,13 @@
 #include "tbx/graphics/texture.h"
 #include "tbx/messages/dispatcher.h"
 #include "tbx/tbx_api.h"
+#include <concepts>
 #include <filesystem>
 #include <future>
 #include <memory>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 namespace tbx
 {
@@ -87,6 +89,18 @@ namespace tbx
         bool operator==(const AudioLoadParameters& other) const = default;
     };
 
+    /// @brief
+    /// Purpose: Lists the assets another asset refers to, grouped by the type each is loaded as.
+    /// @details
+    /// Ownership: Owns copies of the referenced handles.
+    /// Thread Safety: Safe to copy between threads.
+    struct AssetDependencies
+    {
+        std::vector<Handle> textures = {};
+        std::vector<Handle> shaders = {};
+        std::vector<Handle> materials = {};
+    };
+
     template <typename TAsset>
     struct AssetLoader;
 
@@ -211,6 +225,168 @@ namespace tbx
         const std::filesystem::path& asset_path,
         const MaterialLoadParameters& parameters = {});
 
+    /// @brief
+    /// Purpose: Creates the fallback model handed out while the real model is still loading.
+    /// @details
+    /// Ownership: Returns a new model owned by the caller.
+    /// Thread Safety: Safe to call concurrently.
+    TBX_API std::shared_ptr<Model> create_model_fallback(const ModelLoadParameters& parameters = {});
+
+    /// @brief
+    /// Purpose: Creates the fallback texture handed out while the real texture is still loading.
+    /// @details
+    /// Ownership: Returns a new texture owned by the caller.
+    /// Thread Safety: Safe to call concurrently.
+    TBX_API std::shared_ptr<Texture> create_texture_fallback(
+        const TextureLoadParameters& parameters = {});
+
+    /// @brief
+    /// Purpose: Creates the fallback shader handed out while the real shader is still loading.
+    /// @details
+    /// Ownership: Returns a new shader owned by the caller.
+    /// Thread Safety: Safe to call concurrently.
+    TBX_API std::shared_ptr<Shader> create_shader_fallback(
+        const ShaderLoadParameters& parameters = {});
+
+    /// @brief
+    /// Purpose: Creates the fallback material handed out while the real material is still loading.
+    /// @details
+    /// Ownership: Returns a new material owned by the caller.
+    /// Thread Safety: Safe to call concurrently.
+    TBX_API std::shared_ptr<Material> create_material_fallback(
+        const MaterialLoadParameters& parameters = {});
+
+    /// @brief
+    /// Purpose: Reads and decodes a model into `out_model` on the calling thread.
+    /// @details
+    /// Ownership: Writes into the caller-owned model through its load request.
+    /// Thread Safety: Safe to call from job workers. The load request is marked thread-safe, so the
+    /// plugin manager only routes it to loader plugins that opted in to thread-safe messages, under
+    /// a lock that hot reload takes before unloading them.
+    TBX_API Result decode_model(
+        const std::filesystem::path& asset_path,
+        const ModelLoadParameters& parameters,
+        Model& out_model);
+
+    /// @brief
+    /// Purpose: Reads and decodes a texture into `out_texture` on the calling thread.
+    /// @details
+    /// Ownership: Writes into the caller-owned texture through its load request.
+    /// Thread Safety: Safe to call from job workers. The load request is marked thread-safe, so the
+    /// plugin manager only routes it to loader plugins that opted in to thread-safe messages, under
+    /// a lock that hot reload takes before unloading them.
+    TBX_API Result decode_texture(
+        const std::filesystem::path& asset_path,
+        const TextureLoadParameters& parameters,
+        Texture& out_texture);
+
+    /// @brief
+    /// Purpose: Reads and preprocesses a shader into `out_shader` on the calling thread.
+    /// @details
+    /// Ownership: Writes into the caller-owned shader through its load request.
+    /// Thread Safety: Safe to call from job workers. The load request is marked thread-safe, so the
+    /// plugin manager only routes it to loader plugins that opted in to thread-safe messages, under
+    /// a lock that hot reload takes before unloading them.
+    TBX_API Result decode_shader(
+        const std::filesystem::path& asset_path,
+        const ShaderLoadParameters& parameters,
+        Shader& out_shader);
+
+    /// @brief
+    /// Purpose: Reads and parses a material into `out_material` on the calling thread.
+    /// @details
+    /// Ownership: Writes into the caller-owned material through its load request.
+    /// Thread Safety: Safe to call from job workers. The load request is marked thread-safe, so the
+    /// plugin manager only routes it to loader plugins that opted in to thread-safe messages, under
+    /// a lock that hot reload takes before unloading them.
+    TBX_API Result decode_material(
+        const std::filesystem::path& asset_path,
+        const MaterialLoadParameters& parameters,
+        Material& out_material);
+
+    /// @brief
+    /// Purpose: Returns the shader stages and textures a material refers to.
+    /// @details
+    /// Ownership: Returns handles owned by the caller.
+    /// Thread Safety: Safe to call concurrently for materials that are not being mutated.
+    TBX_API AssetDependencies get_material_dependencies(const Material& material);
+
+    /// @brief
+    /// Purpose: Returns the shader stages and textures referenced by a model's materials.
+    /// @details
+    /// Ownership: Returns handles owned by the caller.
+    /// Thread Safety: Safe to call concurrently for models that are not being mutated.
+    TBX_API AssetDependencies get_model_dependencies(const Model& model);
+
+    /// @brief
+    /// Purpose: Returns the bytes of pixel data a texture keeps resident.
+    /// @details
+    /// Ownership: Does not retain the texture.
+    /// Thread Safety: Safe to call concurrently for textures that are not being mutated.
+    TBX_API size get_texture_memory_size(const Texture& texture);
+
+    /// @brief
+    /// Purpose: Returns the bytes of vertex and index data a model keeps resident.
+    /// @details
+    /// Ownership: Does not retain the model.
+    /// Thread Safety: Safe to call concurrently for models that are not being mutated.
+    TBX_API size get_model_memory_size(const Model& model);
+
+    /// @brief
+    /// Purpose: Returns the bytes of sample data an audio clip keeps resident.
+    /// @details
+    /// Ownership: Does not retain the clip.
+    /// Thread Safety: Safe to call concurrently for clips that are not being mutated.
+    TBX_API size get_audio_memory_size(const AudioClip& clip);
+
+    /// @brief
+    /// Purpose: Returns the bytes of source text a shader keeps resident.
+    /// @details
+    /// Ownership: Does not retain the shader.
+    /// Thread Safety: Safe to call concurrently for shaders that are not being mutated.
+    TBX_API size get_shader_memory_size(const Shader& shader);
+
+    /// @brief
+    /// Purpose: Matches asset types whose loader can decode off the main thread into a separate
+    /// payload, so AssetManager::load_async can run the decode on a job worker.
+    /// @details
+    /// Ownership: Not applicable.
+    /// Thread Safety: Not applicable.
+    template <typename TAsset>
+    concept WorkerDecodableAsset = requires(
+        const std::filesystem::path& asset_path,
+        const AssetLoadParameters<TAsset>& parameters,
+        TAsset& out_asset) {
+        {
+            AssetLoader<TAsset>::create_fallback(parameters)
+        } -> std::same_as<std::shared_ptr<TAsset>>;
+        {
+            AssetLoader<TAsset>::decode(asset_path, parameters, out_asset)
+        } -> std::same_as<Result>;
+    };
+
+    /// @brief
+    /// Purpose: Matches asset types whose loader can list the other assets they reference, so
+    /// AssetManager::preload can follow them.
+    /// @details
+    /// Ownership: Not applicable.
+    /// Thread Safety: Not applicable.
+    template <typename TAsset>
+    concept DependentAsset = requires(const TAsset& asset) {
+        { AssetLoader<TAsset>::get_dependencies(asset) } -> std::same_as<AssetDependencies>;
+    };
+
+    /// @brief
+    /// Purpose: Matches asset types whose loader can report the bytes an instance keeps resident,
+    /// so AssetManager memory budgets account for their payloads.
+    /// @details
+    /// Ownership: Not applicable.
+    /// Thread Safety: Not applicable.
+    template <typename TAsset>
+    concept MeasurableAsset = requires(const TAsset& asset) {
+        { AssetLoader<TAsset>::get_memory_size(asset) } -> std::same_as<size>;
+    };
+
     /// @brief
     /// Purpose: Selects the loader endpoints for a given asset type.
     /// @details
@@ -49,6 +49,29 @@ namespace tbx
         {
             return load_model(asset_path, parameters);
         }
+
+        static std::shared_ptr<Model> create_fallback(const Parameters& parameters = {})
+        {
+            return create_model_fallback(parameters);
+        }
+
+        static Result decode(
+            const std::filesystem::path& asset_path,
+            const Parameters& parameters,
+            Model& out_asset)
+        {
+            return decode_model(asset_path, parameters, out_asset);
+        }
+
+        static AssetDependencies get_dependencies(const Model& asset)
+        {
+            return get_model_dependencies(asset);
+        }
+
+        static size get_memory_size(const Model& asset)
+        {
+            return get_model_memory_size(asset);
+        }
     };
 
     template <>
@@ -69,6 +92,24 @@ namespace tbx
         {
             return load_texture(asset_path, parameters);
         }
+
+        static std::shared_ptr<Texture> create_fallback(const Parameters& parameters = {})
+        {
+            return create_texture_fallback(parameters);
+        }
+
+        static Result decode(
+            const std::filesystem::path& asset_path,
+            const Parameters& parameters,
+            Texture& out_asset)
+        {
+            return decode_texture(asset_path, parameters, out_asset);
+        }
+
+        static size get_memory_size(const Texture& asset)
+        {
+            return get_texture_memory_size(asset);
+        }
     };
 
     template <>
@@ -89,6 +130,11 @@ namespace tbx
         {
             return load_audio(asset_path, parameters);
         }
+
+        static size get_memory_size(const AudioClip& asset)
+        {
+            return get_audio_memory_size(asset);
+        }
     };
 
     template <>
@@ -109,6 +155,24 @@ namespace tbx
         {
             return load_shader(asset_path, parameters);
         }
+
+        static std::shared_ptr<Shader> create_fallback(const Parameters& parameters = {})
+        {
+            return create_shader_fallback(parameters);
+        }
+
+        static Result decode(
+            const std::filesystem::path& asset_path,
+            const Parameters& parameters,
+            Shader& out_asset)
+        {
+            return decode_shader(asset_path, parameters, out_asset);
+        }
+
+        static size get_memory_size(const Shader& asset)
+        {
+            return get_shader_memory_size(asset);
+        }
     };
 
     template <>
@@ -129,5 +193,23 @@ namespace tbx
         {
             return load_material(asset_path, parameters);
         }
+
+        static std::shared_ptr<Material> create_fallback(const Parameters& parameters = {})
+        {
+            return create_material_fallback(parameters);
+        }
+
+        static Result decode(
+            const std::filesystem::path& asset_path,
+            const Parameters& parameters,
+            Material& out_asset)
+        {
+            return decode_material(asset_path, parameters, out_asset);
+        }
+
+        static AssetDependencies get_dependencies(const Material& asset)
+        {
+            return get_material_dependencies(asset);
+        }
     };
 }
@@ -1,16 +1,21 @@
 #pragma once
 #include "tbx/assets/handle_serializer.h"
 #include "tbx/assets/loaders.h"
+#include "tbx/assets/settings.h"
 #include "tbx/common/handle.h"
 #include "tbx/common/typedefs.h"
 #include "tbx/files/ops.h"
 #include "tbx/files/watcher.h"
 #include "tbx/tbx_api.h"
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <string>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
@@ -22,6 +27,9 @@ namespace tbx
     struct AssetRegistryEntry;
     class AssetRegistry;
     class IMessageDispatcher;
+    class JobSystem;
+    struct AssetDecodeQueue;
+    struct AssetPreloadState;
     struct IAssetStore;
 
     template <typename TAsset>
@@ -54,6 +62,82 @@ namespace tbx
         std::chrono::steady_clock::time_point last_access = {};
     };
 
+    /// @brief
+    /// Purpose: Reports the work done by one incremental asset collection step.
+    /// @details
+    /// Ownership: Does not own any resources.
+    /// Thread Safety: Safe to copy between threads.
+    struct AssetCollectionStats
+    {
+        uint examined_count = 0U;
+        uint unloaded_count = 0U;
+
+        // True when this step reached the end of a full sweep over every asset store.
+        bool has_completed_pass = false;
+
+        // Assets evicted because their type was over its memory budget.
+        uint evicted_count = 0U;
+
+        std::chrono::nanoseconds elapsed = {};
+    };
+
+    /// @brief
+    /// Purpose: Reports the bytes one asset type keeps resident against its memory budget.
+    /// @details
+    /// Ownership: Owns a copy of the type name.
+    /// Thread Safety: Safe to copy between threads.
+    /// Counts are refreshed as assets load synchronously, unload, and are swept by
+    /// `collect_unreferenced`, so async loads appear once the collector reaches them.
+    struct AssetMemoryUsage
+    {
+        std::string type_name = {};
+        size resident_bytes = 0U;
+
+        // Zero when the type has no budget.
+        size budget_bytes = 0U;
+
+        // Assets evicted to stay within the budget since the type was first loaded.
+        uint evicted_count = 0U;
+    };
+
+    /// @brief
+    /// Purpose: Reports how far a batch preload has walked its asset graph.
+    /// @details
+    /// Ownership: Does not own any resources.
+    /// Thread Safety: Safe to copy between threads.
+    struct AssetPreloadProgress
+    {
+        // Assets queued so far, including dependencies found after their owners finished loading.
+        uint discovered_count = 0U;
+
+        // Loads that have completed, counting failed ones.
+        uint finished_count = 0U;
+        uint failed_count = 0U;
+    };
+
+    /// @brief
+    /// Purpose: Observes a batch preload started with `AssetManager::preload`.
+    /// @details
+    /// Ownership: Shares ownership of the preload state with the manager.
+    /// Thread Safety: Safe to query from any thread.
+    class TBX_API AssetPreload
+    {
+      public:
+        AssetPreload() = default;
+        AssetPreload(std::shared_ptr<AssetPreloadState> state);
+
+      public:
+        AssetPreloadProgress get_progress() const;
+
+        // Resolves once every discovered asset has finished, failing when any of them failed.
+        std::shared_future<Result> get_completion() const;
+
+        bool is_complete() const;
+
+      private:
+        std::shared_ptr<AssetPreloadState> _state = nullptr;
+    };
+
     /// @brief
     /// Purpose: Tracks streamed assets by canonical asset id and maintains usage metadata.
     /// @details
@@ -82,7 +166,9 @@ namespace tbx
         /// Purpose: Loads an asset by handle synchronously and tracks usage.
         /// @details
         /// Ownership: Returns a shared asset instance owned jointly by the manager and caller.
-        /// Thread Safety: Safe to call concurrently; internal state is synchronized.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized. Notes: An
+        /// already loaded asset is returned under shared locks only, and concurrent loads of the
+        /// same handle wait for one load instead of each decoding the file.
         template <typename TAsset>
         std::shared_ptr<TAsset> load(
             const Handle& handle,
@@ -139,16 +225,85 @@ namespace tbx
         /// Thread Safety: Safe to call concurrently; internal state is synchronized.
         std::vector<std::filesystem::path> get_directories() const;
 
+        /// @brief
+        /// Purpose: Returns the file operations the manager discovers and reads assets through.
+        /// @details
+        /// Ownership: Returns shared ownership; loaders reading asset files should use the same
+        /// instance so archives mounted on it are visible to them as well.
+        /// Thread Safety: Safe to call concurrently; the instance is fixed at construction.
+        std::shared_ptr<IFileOps> get_file_ops() const;
+
+        /// @brief
+        /// Purpose: Loads a registry index written by `save_registry_index`, so directories added
+        /// afterwards reuse indexed asset ids for `.meta` files that have not changed.
+        /// @details
+        /// Ownership: Copies the index path into internal storage.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized. Notes: Call
+        /// before `add_directory` so the initial scans can use the index.
+        Result load_registry_index(const std::filesystem::path& index_path);
+
+        /// @brief
+        /// Purpose: Writes the asset ids read from `.meta` files since the index was loaded,
+        /// together with each sidecar's write time, back to the loaded index path.
+        /// @details
+        /// Ownership: Does not retain references after returning.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized.
+        Result save_registry_index();
+
         /// @brief
         /// Purpose: Loads an asset asynchronously and tracks usage metadata.
         /// @details
         /// Ownership: Returns an AssetPromise that shares ownership with the caller.
-        /// Thread Safety: Safe to call concurrently; internal state is synchronized.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized. Notes: With a
+        /// job system set, worker-decodable asset types are read and decoded on a job worker, and
+        /// `publish_decoded_assets` replaces the returned fallback in the manager with the decoded
+        /// instance. The fallback itself never changes; fetch the asset again once it completes.
         template <typename TAsset>
         AssetPromise<TAsset> load_async(
             const Handle& handle,
             const AssetLoadParameters<TAsset>& parameters = {});
 
+        /// @brief
+        /// Purpose: Sets the job system that `load_async` decodes assets on and that directory
+        /// scans spread file checks and `.meta` reads over.
+        /// @details
+        /// Ownership: Stores a non-owning pointer; the job system must outlive the manager. Null
+        /// leaves decoding to the posted load requests, which resolve during message flush, and
+        /// scans directories on the calling thread.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized.
+        void set_job_system(JobSystem* job_system);
+
+        /// @brief
+        /// Purpose: Swaps assets decoded on job workers in for the fallbacks handed out by
+        /// `load_async`, posts an AssetReloadedEvent for each so caches drop the fallback, and
+        /// completes their load promises. Returns how many loads were published.
+        /// @details
+        /// Ownership: Moves ownership of the decoded instances into the manager's records.
+        /// Thread Safety: Call once per frame from the main thread, so published assets only change
+        /// between the frame's systems and never while they read them.
+        uint publish_decoded_assets();
+
+        /// @brief
+        /// Purpose: Starts loading a batch of assets together with every texture, shader, and
+        /// material they reference.
+        /// @details
+        /// Ownership: Returns an AssetPreload that shares the batch state with the manager. The
+        /// batch holds a reference to every asset it loaded, so collection keeps them resident
+        /// until the last AssetPreload for the batch is released.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized. Notes:
+        /// Dependencies are discovered by `advance_preloads` once their owner has finished loading,
+        /// and each asset is queued at most once per batch.
+        template <typename TAsset>
+        AssetPreload preload(const std::vector<Handle>& handles);
+
+        /// @brief
+        /// Purpose: Queues the dependencies of preloaded assets that finished loading and completes
+        /// batches with nothing left in flight. Returns how many loads finished this call.
+        /// @details
+        /// Ownership: Releases finished batches; callers holding an AssetPreload keep its state.
+        /// Thread Safety: Call once per frame from the main thread after `publish_decoded_assets`.
+        uint advance_preloads();
+
         /// @brief
         /// Purpose: Streams an asset out if it is unreferenced or forced.
         /// @details
@@ -171,6 +326,24 @@ namespace tbx
         /// Thread Safety: Safe to call concurrently; internal state is synchronized.
         void unload_unreferenced();
 
+        /// @brief
+        /// Purpose: Streams out unreferenced, unpinned assets that have been idle long enough,
+        /// examining at most a bounded slice of records per call.
+        /// @details
+        /// Ownership: Releases manager-owned asset instances that are safe to evict.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized. Notes: A
+        /// cursor persists between calls, so repeated calls sweep every store over several
+        /// frames instead of walking all records at once. Types over their memory budget then
+        /// evict least recently used assets until they fit.
+        AssetCollectionStats collect_unreferenced(const AssetCollectionSettings& settings);
+
+        /// @brief
+        /// Purpose: Reports resident bytes and memory budgets for every loaded asset type.
+        /// @details
+        /// Ownership: Returns caller-owned usage values.
+        /// Thread Safety: Safe to call concurrently; internal state is synchronized.
+        std::vector<AssetMemoryUsage> get_memory_usage() const;
+
         /// @brief
         /// Purpose: Reloads a streamed asset and swaps the managed asset instance.
         /// @details
@@ -191,6 +364,26 @@ namespace tbx
             const std::filesystem::path& watched_path,
             const FileWatchChange& change);
         void watch_asset_directory(const std::filesystem::path& resolved_path);
+        void schedule_decode(std::move_only_function<void()> decode_job);
+
+        template <typename TAsset>
+        void queue_preload(AssetPreloadState& state, const Handle& handle);
+
+        void queue_dependencies(AssetPreloadState& state, const AssetDependencies& dependencies);
+
+        template <typename TAsset>
+        AssetPromise<TAsset> decode_on_worker(
+            const std::filesystem::path& asset_path,
+            const AssetLoadParameters<TAsset>& parameters,
+            const std::string& normalized_path,
+            const Uuid& asset_id);
+
+        template <typename TAsset>
+        void publish_decoded_asset(
+            const Uuid& asset_id,
+            const std::string& normalized_path,
+            const std::shared_ptr<TAsset>& fallback,
+            std::shared_ptr<TAsset> decoded);
 
       private:
         template <typename TAsset>
@@ -205,20 +398,37 @@ namespace tbx
             const AssetRegistryEntry& entry,
             bool create_if_missing = false);
 
-        template <typename TAsset>
-        AssetRecord<TAsset>* get_record(AssetStore<TAsset>& store, const Handle& handle);
+        // Returns the registered id for `handle`, or an invalid id when it is not registered yet.
+        // Only takes the registry lock shared.
+        Uuid find_asset_id(const Handle& handle) const;
 
-        template <typename TAsset>
-        const AssetRecord<TAsset>* get_record(const AssetStore<TAsset>& store, const Handle& handle)
-            const;
+        // Ensures `handle` has a registry entry and copies it, since the entry may be dropped
+        // once the registry lock is released.
+        bool ensure_asset_entry(const Handle& handle, AssetRegistryEntry& out_entry);
 
       private:
-        mutable std::mutex _mutex = {};
+        // Locks are taken in declaration order, and a store's own lock after all of them.
+        mutable std::shared_mutex _registry_mutex = {};
+        std::mutex _collection_mutex = {};
+        mutable std::shared_mutex _stores_mutex = {};
         IMessageDispatcher* _dispatcher = nullptr;
         std::shared_ptr<IFileOps> _file_ops = nullptr;
         std::unique_ptr<AssetRegistry> _registry;
+
+        // Asset ids of handles resolved by name, so repeated loads skip path resolution. Guarded
+        // by the registry lock and cleared whenever registered paths change.
+        std::unordered_map<std::string, Uuid> _asset_ids_by_name = {};
+
+        // Stores are created on first use and live as long as the manager, so store pointers stay
+        // valid after the store map lock is released.
         std::unordered_map<std::type_index, std::unique_ptr<IAssetStore>> _stores = {};
         std::vector<std::unique_ptr<FileWatcher>> _file_watchers = {};
+        // Guarded by `_collection_mutex`.
+        size _collection_store_index = 0U;
+        std::atomic<JobSystem*> _job_system = nullptr;
+        std::shared_ptr<AssetDecodeQueue> _decode_queue = nullptr;
+        std::mutex _preload_mutex = {};
+        std::vector<std::shared_ptr<AssetPreloadState>> _preloads = {};
     };
 }
 
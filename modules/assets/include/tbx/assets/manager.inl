@@ -1,4 +1,5 @@
 #pragma once
+#include "tbx/assets/events.h"
 #include "tbx/assets/registry.h"
 #include "tbx/debugging/macros.h"
 
@@ -10,75 +11,116 @@ namespace tbx
         const AssetLoadParameters<TAsset>& parameters)
     {
         auto now = std::chrono::steady_clock::now();
-        std::lock_guard lock(_mutex);
-        const AssetRegistryEntry* entry = nullptr;
-        const auto ensure_result = _registry->ensure_entry(handle, &entry);
-        if (!ensure_result.succeeded() || !entry)
+        auto* store = get_store<TAsset>(true);
+
+        // Hit path: an asset that is already loaded is shared out under reader locks only.
+        if (const auto asset_id = find_asset_id(handle); asset_id.is_valid())
         {
-            TBX_TRACE_WARNING(
-                "Failed to ensure asset entry for handle (name='{}', id={}): {}",
-                handle.get_name(),
-                to_string(handle.get_id()),
-                ensure_result.get_report());
-            return {};
+            std::shared_lock store_lock(store->mutex);
+            auto iterator = store->records.find(asset_id);
+            if (iterator != store->records.end())
+            {
+                auto& record = iterator->second;
+                if (record.asset && !record.in_flight_load.valid()
+                    && asset_load_parameters_match(record, parameters))
+                {
+                    touch_asset_record(record, now);
+                    return record.asset;
+                }
+            }
         }
-        if (!ensure_result.get_report().empty())
+
+        auto entry = AssetRegistryEntry {};
+        if (!ensure_asset_entry(handle, entry))
         {
-            TBX_TRACE_INFO("Asset registry: {}", ensure_result.get_report());
+            return {};
         }
 
-        auto* store = get_store<TAsset>(true);
-        auto* record = get_record(*store, *entry, true);
-        if (!record)
+        std::unique_lock store_lock(store->mutex);
+        auto* record = get_record(*store, entry, true);
+        while (record->in_flight_load.valid())
         {
-            return {};
+            auto in_flight_load = record->in_flight_load;
+            const auto is_same_load = asset_load_parameters_match(*record, parameters);
+            store_lock.unlock();
+            if (is_same_load)
+            {
+                return in_flight_load.get();
+            }
+
+            in_flight_load.wait();
+            store_lock.lock();
+            record = get_record(*store, entry, true);
         }
 
         record->last_access = now;
-        if (!record->asset || !asset_load_parameters_match(*record, parameters))
+        if (record->asset && asset_load_parameters_match(*record, parameters))
         {
-            TBX_TRACE_INFO(
-                "Loading asset: '{}' (id={}, type={})",
-                record->normalized_path,
-                to_string(record->asset_id),
+            return record->asset;
+        }
+
+        // Publish the load before running it unlocked, so other threads loading this asset wait
+        // for it and loads of unrelated assets of the same type are not held up.
+        auto completion = std::promise<std::shared_ptr<TAsset>>();
+        record->in_flight_load = completion.get_future().share();
+        record->stream_state = AssetStreamState::LOADING;
+        store_asset_load_parameters(*record, parameters);
+        store_lock.unlock();
+
+        TBX_TRACE_INFO(
+            "Loading asset: '{}' (id={}, type={})",
+            entry.normalized_path,
+            to_string(entry.asset_id),
+            typeid(TAsset).name());
+        auto asset = AssetLoader<TAsset>::load(entry.resolved_path, parameters);
+        if (!asset)
+        {
+            TBX_TRACE_WARNING(
+                "Failed to load asset: '{}' (id={}, type={})",
+                entry.normalized_path,
+                to_string(entry.asset_id),
                 typeid(TAsset).name());
-            record->stream_state = AssetStreamState::LOADING;
-            record->asset = AssetLoader<TAsset>::load(entry->resolved_path, parameters);
-            store_asset_load_parameters(*record, parameters);
+        }
+
+        store_lock.lock();
+
+        // The record is gone if the asset file was removed or everything was unloaded meanwhile.
+        auto iterator = store->records.find(entry.asset_id);
+        if (iterator != store->records.end())
+        {
+            record = &iterator->second;
+            record->asset = asset;
             record->pending_load = {};
-            record->stream_state =
-                record->asset ? AssetStreamState::LOADED : AssetStreamState::UNLOADED;
-            if (!record->asset)
-            {
-                TBX_TRACE_WARNING(
-                    "Failed to load asset: '{}' (id={}, type={})",
-                    record->normalized_path,
-                    to_string(record->asset_id),
-                    typeid(TAsset).name());
-            }
+            record->in_flight_load = {};
+            record->stream_state = asset ? AssetStreamState::LOADED : AssetStreamState::UNLOADED;
+            store->measure(*record);
         }
+        store_lock.unlock();
 
-        return record->asset;
+        completion.set_value(asset);
+        return asset;
     }
 
     template <typename TAsset>
     AssetUsage AssetManager::get_usage(const Handle& handle) const
     {
-        std::lock_guard lock(_mutex);
+        const auto asset_id = find_asset_id(handle);
         auto* store = get_store<TAsset>();
-        if (!store)
+        if (!store || !asset_id.is_valid())
         {
             return {};
         }
 
-        auto* record = const_cast<AssetRecord<TAsset>*>(get_record(*store, handle));
-        if (!record)
+        std::lock_guard store_lock(store->mutex);
+        auto iterator = store->records.find(asset_id);
+        if (iterator == store->records.end())
         {
             return {};
         }
 
-        update_asset_stream_state(*record);
-        return build_asset_usage(*record);
+        auto& record = const_cast<AssetRecord<TAsset>&>(iterator->second);
+        update_asset_stream_state(record);
+        return build_asset_usage(record);
     }
 
     template <typename TAsset>
@@ -87,29 +129,45 @@ namespace tbx
         const AssetLoadParameters<TAsset>& parameters)
     {
         auto now = std::chrono::steady_clock::now();
-        std::lock_guard lock(_mutex);
         AssetPromise<TAsset> result = {};
-        const AssetRegistryEntry* entry = nullptr;
-        const auto ensure_result = _registry->ensure_entry(handle, &entry);
-        if (!ensure_result.succeeded() || !entry)
+        auto* store = get_store<TAsset>(true);
+
+        // Already tracked assets only need the store lock, not the registry's exclusive one.
+        if (const auto asset_id = find_asset_id(handle); asset_id.is_valid())
         {
-            TBX_TRACE_WARNING(
-                "Failed to ensure asset entry for handle (name='{}', id={}): {}",
-                handle.get_name(),
-                to_string(handle.get_id()),
-                ensure_result.get_report());
-            return result;
+            std::lock_guard store_lock(store->mutex);
+            auto iterator = store->records.find(asset_id);
+            if (iterator != store->records.end())
+            {
+                auto& record = iterator->second;
+                if (record.asset && !record.in_flight_load.valid()
+                    && asset_load_parameters_match(record, parameters))
+                {
+                    record.last_access = now;
+                    update_asset_stream_state(record);
+                    result.asset = record.asset;
+                    result.promise = record.pending_load;
+                    return result;
+                }
+            }
         }
-        if (!ensure_result.get_report().empty())
+
+        auto entry = AssetRegistryEntry {};
+        if (!ensure_asset_entry(handle, entry))
         {
-            TBX_TRACE_INFO("Asset registry: {}", ensure_result.get_report());
+            return result;
         }
 
-        auto* store = get_store<TAsset>(true);
-        auto* record = get_record(*store, *entry, true);
-        if (!record)
+        std::unique_lock store_lock(store->mutex);
+        auto* record = get_record(*store, entry, true);
+        while (record->in_flight_load.valid())
         {
-            return result;
+            // A synchronous load of this asset is running; let it finish rather than racing it.
+            auto in_flight_load = record->in_flight_load;
+            store_lock.unlock();
+            in_flight_load.wait();
+            store_lock.lock();
+            record = get_record(*store, entry, true);
         }
 
         record->last_access = now;
@@ -126,34 +184,52 @@ namespace tbx
             record->normalized_path,
             to_string(record->asset_id),
             typeid(TAsset).name());
-        auto promise = AssetLoader<TAsset>::load_async(entry->resolved_path, parameters);
+        auto promise = AssetPromise<TAsset>();
+        if constexpr (WorkerDecodableAsset<TAsset>)
+        {
+            if (_job_system)
+            {
+                promise = decode_on_worker<TAsset>(
+                    entry.resolved_path,
+                    parameters,
+                    record->normalized_path,
+                    entry.asset_id);
+            }
+        }
+        if (!promise.asset)
+            promise = AssetLoader<TAsset>::load_async(entry.resolved_path, parameters);
         record->asset = std::move(promise.asset);
         record->pending_load = promise.promise;
         store_asset_load_parameters(*record, parameters);
         record->stream_state =
             record->asset ? AssetStreamState::LOADING : AssetStreamState::UNLOADED;
-        update_asset_stream_state(*record);
+        store->measure(*record);
         result.asset = record->asset;
-        result.promise = record->pending_load;
+
+        // Hand back the load's own future; the record drops it once it completes, and callers of a
+        // load that finished immediately still need its result.
+        result.promise = std::move(promise.promise);
         return result;
     }
 
     template <typename TAsset>
     bool AssetManager::unload(const Handle& handle, bool force)
     {
-        std::lock_guard lock(_mutex);
+        const auto asset_id = find_asset_id(handle);
         auto* store = get_store<TAsset>();
-        if (!store)
+        if (!store || !asset_id.is_valid())
         {
             return false;
         }
 
-        auto* record = get_record(*store, handle);
-        if (!record)
+        std::lock_guard store_lock(store->mutex);
+        auto iterator = store->records.find(asset_id);
+        if (iterator == store->records.end())
         {
             return false;
         }
 
+        auto* record = &iterator->second;
         if (!force && (record->is_pinned || is_asset_record_referenced(*record)))
         {
             return false;
@@ -166,79 +242,210 @@ namespace tbx
             typeid(TAsset).name());
         record->asset.reset();
         record->stream_state = AssetStreamState::UNLOADED;
+        store->measure(*record);
         return true;
     }
 
     template <typename TAsset>
     bool AssetManager::reload(const Handle& handle)
     {
-        std::lock_guard lock(_mutex);
-        const AssetRegistryEntry* entry = nullptr;
-        const auto ensure_result = _registry->ensure_entry(handle, &entry);
-        if (!ensure_result.succeeded() || !entry)
+        auto entry = AssetRegistryEntry {};
+        if (!ensure_asset_entry(handle, entry))
         {
-            TBX_TRACE_WARNING(
-                "Failed to ensure asset entry for reload handle (name='{}', id={}): {}",
-                handle.get_name(),
-                to_string(handle.get_id()),
-                ensure_result.get_report());
             return false;
         }
-        if (!ensure_result.get_report().empty())
-        {
-            TBX_TRACE_INFO("Asset registry: {}", ensure_result.get_report());
-        }
 
         auto* store = get_store<TAsset>(true);
-        if (!store)
-        {
-            return false;
-        }
-
-        const auto reload_result = store->reload(*entry, std::chrono::steady_clock::now());
+        std::unique_lock store_lock(store->mutex);
+        const auto reload_result = store->reload(entry, std::chrono::steady_clock::now());
+        store_lock.unlock();
         if (reload_result.attempted)
         {
             TBX_TRACE_INFO(
                 "Reloading asset: '{}' (id={}, type={})",
-                entry->normalized_path,
-                to_string(entry->asset_id),
+                entry.normalized_path,
+                to_string(entry.asset_id),
                 typeid(TAsset).name());
             if (!reload_result.succeeded)
             {
                 TBX_TRACE_WARNING(
                     "Failed to reload asset: '{}' (id={}, type={})",
-                    entry->normalized_path,
-                    to_string(entry->asset_id),
+                    entry.normalized_path,
+                    to_string(entry.asset_id),
                     typeid(TAsset).name());
             }
         }
         return reload_result.attempted && reload_result.succeeded;
     }
 
+    template <typename TAsset>
+    AssetPromise<TAsset> AssetManager::decode_on_worker(
+        const std::filesystem::path& asset_path,
+        const AssetLoadParameters<TAsset>& parameters,
+        const std::string& normalized_path,
+        const Uuid& asset_id)
+    {
+        auto completion = std::make_shared<std::promise<Result>>();
+        auto result = AssetPromise<TAsset> {
+            .asset = AssetLoader<TAsset>::create_fallback(parameters),
+            .promise = completion->get_future().share(),
+        };
+
+        // The worker decodes into its own instance and the publish step swaps that instance into
+        // the record, so nothing ever writes to an asset another thread may be reading. Callers
+        // that kept the fallback keep seeing it; the reload event tells them to fetch it again.
+        schedule_decode(
+            [this,
+             asset_path,
+             parameters,
+             normalized_path,
+             asset_id,
+             published = result.asset,
+             completion,
+             decode_queue = _decode_queue]()
+            {
+                auto decoded = AssetLoader<TAsset>::create_fallback(parameters);
+                auto load_result = AssetLoader<TAsset>::decode(asset_path, parameters, *decoded);
+
+                std::lock_guard lock(decode_queue->mutex);
+                decode_queue->publishers.push_back(
+                    [this, normalized_path, asset_id, published, decoded, completion, load_result]()
+                    {
+                        if (load_result)
+                        {
+                            publish_decoded_asset<TAsset>(
+                                asset_id,
+                                normalized_path,
+                                published,
+                                decoded);
+                        }
+                        else
+                        {
+                            TBX_TRACE_WARNING(
+                                "Failed to decode asset '{}': {}. Keeping fallback.",
+                                normalized_path,
+                                load_result.get_report());
+                        }
+                        completion->set_value(load_result);
+                    });
+            });
+        return result;
+    }
+
+    template <typename TAsset>
+    void AssetManager::publish_decoded_asset(
+        const Uuid& asset_id,
+        const std::string& normalized_path,
+        const std::shared_ptr<TAsset>& fallback,
+        std::shared_ptr<TAsset> decoded)
+    {
+        auto* store = get_store<TAsset>();
+        if (!store)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard store_lock(store->mutex);
+            auto iterator = store->records.find(asset_id);
+
+            // The record may have been unloaded or reloaded while the decode ran; its current
+            // asset is newer than this one then.
+            if (iterator == store->records.end() || iterator->second.asset != fallback)
+            {
+                return;
+            }
+            iterator->second.asset = std::move(decoded);
+        }
+
+        if (_dispatcher)
+        {
+            _dispatcher->post<AssetReloadedEvent>(Handle(normalized_path, asset_id), true);
+        }
+    }
+
+    template <typename TAsset>
+    AssetPreload AssetManager::preload(const std::vector<Handle>& handles)
+    {
+        auto state = std::make_shared<AssetPreloadState>();
+        state->completion = state->completion_source.get_future().share();
+        {
+            std::lock_guard lock(state->mutex);
+            for (const auto& handle : handles)
+                queue_preload<TAsset>(*state, handle);
+        }
+
+        std::lock_guard lock(_preload_mutex);
+        _preloads.push_back(state);
+        return AssetPreload(std::move(state));
+    }
+
+    template <typename TAsset>
+    void AssetManager::queue_preload(AssetPreloadState& state, const Handle& handle)
+    {
+        const auto asset_id = ensure(handle);
+        if (asset_id.is_valid() && !state.visited[typeid(TAsset)].insert(asset_id).second)
+            return;
+
+        ++state.progress.discovered_count;
+        auto promise = load_async<TAsset>(handle);
+        if (!promise.asset)
+        {
+            state.add_failure(handle, "Asset could not be resolved.");
+            return;
+        }
+
+        state.pending.push_back(
+            PendingAssetPreload {
+                .handle = handle,
+                .load = promise.promise,
+                .loading_asset = promise.asset,
+                .resolve_asset = [this, handle]() -> std::shared_ptr<const void>
+                {
+                    return load<TAsset>(handle);
+                },
+                .get_dependencies = [](const void* asset) -> AssetDependencies
+                {
+                    if constexpr (DependentAsset<TAsset>)
+                        return AssetLoader<TAsset>::get_dependencies(
+                            *static_cast<const TAsset*>(asset));
+                    else
+                        return {};
+                },
+            });
+    }
+
     template <typename TAsset>
     AssetStore<TAsset>* AssetManager::get_store(bool create_if_missing)
     {
         auto type_key = std::type_index(typeid(TAsset));
-        auto iterator = _stores.find(type_key);
-        if (iterator != _stores.end())
         {
-            return static_cast<AssetStore<TAsset>*>(iterator->second.get());
+            std::shared_lock lock(_stores_mutex);
+            auto iterator = _stores.find(type_key);
+            if (iterator != _stores.end())
+            {
+                return static_cast<AssetStore<TAsset>*>(iterator->second.get());
+            }
         }
         if (!create_if_missing)
         {
             return nullptr;
         }
 
-        auto store = std::make_unique<AssetStore<TAsset>>();
-        auto* store_ptr = store.get();
-        _stores.emplace(type_key, std::move(store));
-        return store_ptr;
+        std::lock_guard lock(_stores_mutex);
+        auto& store = _stores[type_key];
+        if (!store)
+        {
+            store = std::make_unique<AssetStore<TAsset>>();
+        }
+        return static_cast<AssetStore<TAsset>*>(store.get());
     }
 
     template <typename TAsset>
     const AssetStore<TAsset>* AssetManager::get_store() const
     {
         auto type_key = std::type_index(typeid(TAsset));
+        std::shared_lock lock(_stores_mutex);
         auto iterator = _stores.find(type_key);
         if (iterator == _stores.end())
         {
@@ -271,36 +478,4 @@ namespace tbx
         static_cast<void>(was_inserted);
         return &inserted->second;
     }
-
-    template <typename TAsset>
-    AssetRecord<TAsset>* AssetManager::get_record(AssetStore<TAsset>& store, const Handle& handle)
-    {
-        auto* entry = _registry->find_entry(handle);
-        if (!entry || !entry->asset_id.is_valid())
-        {
-            return nullptr;
-        }
-
-        return get_record(store, *entry);
-    }
-
-    template <typename TAsset>
-    const AssetRecord<TAsset>* AssetManager::get_record(
-        const AssetStore<TAsset>& store,
-        const Handle& handle) const
-    {
-        auto* entry = _registry->find_entry(handle);
-        if (!entry || !entry->asset_id.is_valid())
-        {
-            return nullptr;
-        }
-
-        auto iterator = store.records.find(entry->asset_id);
-        if (iterator == store.records.end())
-        {
-            return nullptr;
-        }
-
-        return &iterator->second;
-    }
 }
@@ -5,13 +5,21 @@
 #include "tbx/common/result.h"
 #include "tbx/common/typedefs.h"
 #include "tbx/common/uuid.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <functional>
 #include <future>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -24,6 +32,32 @@ namespace tbx
         Uuid asset_id = {};
     };
 
+    // Asset id read from a `.meta` sidecar, valid while the sidecar keeps this write time and size.
+    struct AssetIndexRecord
+    {
+        Uuid asset_id = {};
+        std::filesystem::file_time_type meta_write_time = {};
+        uint64 meta_size = 0U;
+    };
+
+    // What a scan learned from one asset's `.meta` sidecar without touching the registry.
+    struct AssetMetaProbe
+    {
+        Uuid asset_id = {};
+        std::filesystem::file_time_type meta_write_time = {};
+        uint64 meta_size = 0U;
+
+        // True when the sidecar was parsed rather than answered by the index.
+        bool was_parsed = false;
+    };
+
+    struct ScannedAssetFile
+    {
+        std::filesystem::path resolved_path = {};
+        std::string normalized_path = {};
+        AssetMetaProbe meta = {};
+    };
+
     class TBX_API AssetRegistry final
     {
       public:
@@ -52,6 +86,13 @@ namespace tbx
         Result scan_asset_directory(const std::filesystem::path& root);
         static bool should_track_asset_path(const std::filesystem::path& asset_path);
 
+        // Loads ids cached by a previous `save_index`, so unchanged `.meta` files are not parsed.
+        Result load_index(const std::filesystem::path& index_path);
+        Result save_index();
+
+        // Spreads directory scans over the job system's workers. Null scans on the caller.
+        void set_job_system(JobSystem* job_system);
+
       private:
         AssetRegistryEntry* find_entry_by_id(Uuid asset_id);
         const AssetRegistryEntry* find_entry_by_id(Uuid asset_id) const;
@@ -60,8 +101,17 @@ namespace tbx
         static Uuid make_runtime_asset_id(const std::string& normalized_path);
         Uuid generate_unique_asset_id() const;
         AssetRegistryEntry& get_or_create_path_entry(const std::filesystem::path& asset_path);
+        AssetRegistryEntry& get_or_create_resolved_entry(
+            std::filesystem::path resolved_path,
+            const std::string& normalized_path);
         std::string normalize_path_string(const std::filesystem::path& asset_path) const;
-        Uuid try_resolve_discovered_asset_id(const AssetRegistryEntry& entry) const;
+        Uuid try_resolve_discovered_asset_id(const AssetRegistryEntry& entry);
+        Uuid try_get_handle_source_id(const std::filesystem::path& resolved_path) const;
+        ScannedAssetFile scan_asset_file(const std::filesystem::path& asset_path) const;
+        AssetMetaProbe probe_meta_asset_id(
+            const std::filesystem::path& resolved_path,
+            const std::string& normalized_path) const;
+        Uuid accept_meta_probe(const std::string& normalized_path, const AssetMetaProbe& probe);
         Result resolve_or_repair_asset_id(
             const AssetRegistryEntry& entry,
             Uuid* out_asset_id) const;
@@ -76,6 +126,59 @@ namespace tbx
         std::vector<std::filesystem::path> _asset_directories = {};
         std::unordered_map<std::string, AssetRegistryEntry> _entries_by_path = {};
         std::unordered_map<Uuid, std::string> _path_by_id = {};
+        std::filesystem::path _index_path = {};
+        std::unordered_map<std::string, AssetIndexRecord> _index = {};
+        bool _is_index_dirty = false;
+        JobSystem* _job_system = nullptr;
+    };
+
+    // Hands assets decoded on job workers back to the thread that publishes them.
+    struct AssetDecodeQueue
+    {
+        std::mutex mutex = {};
+        std::vector<std::move_only_function<void()>> publishers = {};
+    };
+
+    // One asset of a batch preload whose load has not been inspected yet.
+    struct PendingAssetPreload
+    {
+        Handle handle = {};
+        std::shared_future<Result> load = {};
+
+        // Keeps the instance the load returned from being collected while the load is in flight.
+        std::shared_ptr<const void> loading_asset = nullptr;
+
+        // Fetches the record's current asset once the load resolves. A worker decode publishes a
+        // new instance in place of the fallback the load returned, so the fallback is never kept.
+        std::function<std::shared_ptr<const void>()> resolve_asset = {};
+
+        // Reads a resolved asset's references; empty for types without dependencies.
+        std::function<AssetDependencies(const void*)> get_dependencies = {};
+    };
+
+    struct AssetPreloadState
+    {
+        mutable std::mutex mutex = {};
+        AssetPreloadProgress progress = {};
+        std::promise<Result> completion_source = {};
+        std::shared_future<Result> completion = {};
+        std::vector<PendingAssetPreload> pending = {};
+        std::unordered_map<std::type_index, std::unordered_set<Uuid>> visited = {};
+
+        // References to every asset the batch finished loading. They keep collection from
+        // streaming the assets out until the last AssetPreload observing the batch is released.
+        std::vector<std::shared_ptr<const void>> loaded_assets = {};
+        std::string failure_report = {};
+        bool is_complete = false;
+
+        void add_failure(const Handle& handle, const std::string& report)
+        {
+            ++progress.finished_count;
+            ++progress.failed_count;
+            if (!failure_report.empty())
+                failure_report += "\n";
+            failure_report += "'" + handle.get_name() + "': " + report;
+        }
     };
 
     struct AssetStoreReloadResult
@@ -84,16 +187,37 @@ namespace tbx
         bool succeeded = true;
     };
 
+    struct AssetStoreCollectResult
+    {
+        uint examined_count = 0U;
+        uint unloaded_count = 0U;
+        bool has_finished_pass = false;
+    };
+
     struct IAssetStore
     {
         virtual ~IAssetStore() = default;
         virtual const char* get_asset_type_name() const = 0;
+        virtual void clear() = 0;
         virtual void erase(Uuid asset_id) = 0;
         virtual AssetStoreReloadResult reload(
             const AssetRegistryEntry& entry,
             std::chrono::steady_clock::time_point timestamp) = 0;
         virtual uint unload_unreferenced() = 0;
+        virtual AssetStoreCollectResult collect_unreferenced(
+            uint max_record_count,
+            std::chrono::steady_clock::time_point now,
+            std::chrono::steady_clock::duration min_idle_time) = 0;
         virtual void set_pinned(Uuid asset_id, bool is_pinned) = 0;
+        virtual uint enforce_memory_budget(
+            size budget_bytes,
+            std::chrono::steady_clock::time_point now,
+            std::chrono::steady_clock::duration min_idle_time) = 0;
+        virtual AssetMemoryUsage get_memory_usage() const = 0;
+
+        // Guards the store's records. AssetManager takes it around every call into the store;
+        // readers that only share out a loaded asset take it shared.
+        mutable std::shared_mutex mutex = {};
     };
 
     template <typename TAsset>
@@ -108,16 +232,84 @@ namespace tbx
         std::shared_future<Result> pending_load = {};
         AssetLoadParameters<TAsset> load_parameters = {};
         bool has_load_parameters = false;
+
+        // Bytes counted toward the store's resident total when the record was last measured.
+        size memory_size = 0U;
+
+        // Set while a synchronous load runs outside the store lock, so concurrent loads of the
+        // same asset wait for its result instead of loading it again.
+        std::shared_future<std::shared_ptr<TAsset>> in_flight_load = {};
     };
 
+    // Records an access made under a shared store lock, where other readers may touch the same
+    // record. Every other access to `last_access` happens under the exclusive lock.
+    template <typename TAsset>
+    void touch_asset_record(AssetRecord<TAsset>& record, std::chrono::steady_clock::time_point now)
+    {
+        std::atomic_ref(record.last_access).store(now, std::memory_order_relaxed);
+    }
+
+    template <typename TAsset>
+    size get_asset_memory_size(const TAsset& asset)
+    {
+        if constexpr (MeasurableAsset<TAsset>)
+            return AssetLoader<TAsset>::get_memory_size(asset);
+        else
+            return sizeof(TAsset);
+    }
+
+    template <typename TAsset>
+    bool is_asset_record_collectable(
+        const AssetRecord<TAsset>& record,
+        std::chrono::steady_clock::time_point now,
+        std::chrono::steady_clock::duration min_idle_time)
+    {
+        if (record.is_pinned || !record.asset || record.asset.use_count() > 1)
+        {
+            return false;
+        }
+        return now - record.last_access >= min_idle_time;
+    }
+
     template <typename TAsset>
     struct AssetStore final : IAssetStore
     {
         std::unordered_map<Uuid, AssetRecord<TAsset>> records = {};
 
+        // Next hash bucket the incremental collector examines, and how many of its records an
+        // earlier step already examined. Bucket indices survive erases, so a rehash at worst
+        // makes one sweep skip or revisit a few records.
+        size collection_bucket = 0U;
+        size collection_bucket_offset = 0U;
+
+        // Sum of every record's `memory_size`; exact for measured records.
+        size resident_bytes = 0U;
+        size memory_budget = 0U;
+        uint evicted_count = 0U;
+
+        // A budget that eviction could not meet is retried only after usage grows or a sweep
+        // finishes, so an unreachable budget does not cost a full walk every frame.
+        size bytes_after_last_eviction = 0U;
+        bool has_swept_since_eviction = true;
+
+        void measure(AssetRecord<TAsset>& record)
+        {
+            update_asset_stream_state(record);
+            const auto memory_size = record.asset && record.stream_state == AssetStreamState::LOADED
+                                         ? get_asset_memory_size(*record.asset)
+                                         : size(0U);
+            resident_bytes = resident_bytes - record.memory_size + memory_size;
+            record.memory_size = memory_size;
+        }
+
         void erase(Uuid asset_id) override
         {
-            records.erase(asset_id);
+            auto iterator = records.find(asset_id);
+            if (iterator == records.end())
+                return;
+
+            resident_bytes -= iterator->second.memory_size;
+            records.erase(iterator);
         }
 
         const char* get_asset_type_name() const override
@@ -125,6 +317,16 @@ namespace tbx
             return typeid(TAsset).name();
         }
 
+        void clear() override
+        {
+            records.clear();
+            collection_bucket = 0U;
+            collection_bucket_offset = 0U;
+            resident_bytes = 0U;
+            bytes_after_last_eviction = 0U;
+            has_swept_since_eviction = true;
+        }
+
         AssetStoreReloadResult reload(
             const AssetRegistryEntry& entry,
             const std::chrono::steady_clock::time_point timestamp) override
@@ -157,6 +359,7 @@ namespace tbx
                     record.pending_load = {};
                 }
             }
+            measure(record);
 
             auto result = AssetStoreReloadResult {
                 .attempted = true,
@@ -167,20 +370,132 @@ namespace tbx
 
         uint unload_unreferenced() override
         {
+            const auto now = std::chrono::steady_clock::now();
             uint unloaded_count = 0U;
             for (auto& entry : records)
             {
                 auto& record = entry.second;
-                if (!record.is_pinned && record.asset && record.asset.use_count() <= 1)
+                if (is_asset_record_collectable(record, now, {}))
                 {
                     record.asset.reset();
                     record.stream_state = AssetStreamState::UNLOADED;
                     unloaded_count += 1U;
                 }
+                measure(record);
             }
             return unloaded_count;
         }
 
+        AssetStoreCollectResult collect_unreferenced(
+            uint max_record_count,
+            std::chrono::steady_clock::time_point now,
+            std::chrono::steady_clock::duration min_idle_time) override
+        {
+            auto result = AssetStoreCollectResult {};
+            const auto bucket_count = records.bucket_count();
+
+            // An empty bucket costs as much as a record, so sweeps over sparse stores stay
+            // bounded as well.
+            uint step_count = 0U;
+            while (collection_bucket < bucket_count && step_count < max_record_count)
+            {
+                const auto bucket_size = records.bucket_size(collection_bucket);
+                if (collection_bucket_offset >= bucket_size)
+                {
+                    step_count += bucket_size == 0U ? 1U : 0U;
+                    ++collection_bucket;
+                    collection_bucket_offset = 0U;
+                    continue;
+                }
+
+                auto iterator = std::next(
+                    records.begin(collection_bucket),
+                    static_cast<std::ptrdiff_t>(collection_bucket_offset));
+                for (; iterator != records.end(collection_bucket) && step_count < max_record_count;
+                     ++iterator)
+                {
+                    auto& record = iterator->second;
+                    result.examined_count += 1U;
+                    if (is_asset_record_collectable(record, now, min_idle_time))
+                    {
+                        record.asset.reset();
+                        record.stream_state = AssetStreamState::UNLOADED;
+                        result.unloaded_count += 1U;
+                    }
+                    measure(record);
+                    ++collection_bucket_offset;
+                    ++step_count;
+                }
+            }
+
+            if (collection_bucket >= bucket_count)
+            {
+                collection_bucket = 0U;
+                collection_bucket_offset = 0U;
+                result.has_finished_pass = true;
+                has_swept_since_eviction = true;
+            }
+            return result;
+        }
+
+        uint enforce_memory_budget(
+            size budget_bytes,
+            std::chrono::steady_clock::time_point now,
+            std::chrono::steady_clock::duration min_idle_time) override
+        {
+            memory_budget = budget_bytes;
+            if (budget_bytes == 0U || resident_bytes <= budget_bytes)
+                return 0U;
+            if (!has_swept_since_eviction && resident_bytes <= bytes_after_last_eviction)
+                return 0U;
+
+            auto candidates = std::vector<AssetRecord<TAsset>*>();
+            for (auto& entry : records)
+            {
+                auto& record = entry.second;
+                measure(record);
+                if (record.memory_size > 0U
+                    && is_asset_record_collectable(record, now, min_idle_time))
+                {
+                    candidates.push_back(&record);
+                }
+            }
+            std::sort(
+                candidates.begin(),
+                candidates.end(),
+                [](const AssetRecord<TAsset>* left, const AssetRecord<TAsset>* right)
+                {
+                    return left->last_access < right->last_access;
+                });
+
+            uint evicted = 0U;
+            for (auto* record : candidates)
+            {
+                if (resident_bytes <= budget_bytes)
+                    break;
+
+                record->asset.reset();
+                record->stream_state = AssetStreamState::UNLOADED;
+                measure(*record);
+                evicted += 1U;
+            }
+
+            evicted_count += evicted;
+            bytes_after_last_eviction = resident_bytes;
+            has_swept_since_eviction = false;
+            return evicted;
+        }
+
+        AssetMemoryUsage get_memory_usage() const override
+        {
+            return AssetMemoryUsage {
+                .type_name = get_asset_type_name(),
+                .resident_bytes = resident_bytes,
+                .budget_bytes = memory_budget,
+                .evicted_count = evicted_count,
+            };
+        }
+
         void set_pinned(Uuid asset_id, bool is_pinned) override
         {
             auto iterator = records.find(asset_id);
@@ -30,7 +30,8 @@ namespace tbx
     /// Purpose: Message requesting that a texture payload be loaded with specific settings.
     /// @details
     /// Ownership: The texture asset pointer is non-owning and owned by the caller.
-    /// Thread Safety: Payload access requires external synchronization.
+    /// Thread Safety: Marked thread-safe, so posted requests may be handled on job workers during
+    /// flush. The payload is written before flush returns.
     struct TBX_API LoadTextureRequest : public LoadAssetRequest<Texture>
     {
         LoadTextureRequest(
@@ -48,6 +49,7 @@ namespace tbx
             , mipmaps(mipmaps)
             , compression(compression)
         {
+            dispatch_policy.is_thread_safe = true;
         }
 
         TextureWrap wrap = TextureWrap::REPEAT;
@@ -61,12 +63,14 @@ namespace tbx
     /// Purpose: Message requesting that a model payload be loaded.
     /// @details
     /// Ownership: The model pointer is non-owning and owned by the caller.
-    /// Thread Safety: Payload access requires external synchronization.
+    /// Thread Safety: Marked thread-safe, so posted requests may be handled on job workers during
+    /// flush. The payload is written before flush returns.
     struct TBX_API LoadModelRequest : public LoadAssetRequest<Model>
     {
         LoadModelRequest(std::filesystem::path asset_path, Model* asset_payload)
             : LoadAssetRequest<Model>(std::move(asset_path), asset_payload)
         {
+            dispatch_policy.is_thread_safe = true;
         }
     };
 
@@ -74,12 +78,14 @@ namespace tbx
     /// Purpose: Message requesting that a shader payload be loaded.
     /// @details
     /// Ownership: The shader program pointer is non-owning and owned by the caller.
-    /// Thread Safety: Payload access requires external synchronization.
+    /// Thread Safety: Marked thread-safe, so posted requests may be handled on job workers during
+    /// flush. The payload is written before flush returns.
     struct TBX_API LoadShaderRequest : public LoadAssetRequest<Shader>
     {
         LoadShaderRequest(std::filesystem::path asset_path, Shader* asset_payload)
             : LoadAssetRequest<Shader>(std::move(asset_path), asset_payload)
         {
+            dispatch_policy.is_thread_safe = true;
         }
     };
 
@@ -87,12 +93,14 @@ namespace tbx
     /// Purpose: Message requesting that a material payload be loaded.
     /// @details
     /// Ownership: The material pointer is non-owning and owned by the caller.
-    /// Thread Safety: Payload access requires external synchronization.
+    /// Thread Safety: Marked thread-safe, so posted requests may be handled on job workers during
+    /// flush. The payload is written before flush returns.
     struct TBX_API LoadMaterialRequest : public LoadAssetRequest<Material>
     {
         LoadMaterialRequest(std::filesystem::path asset_path, Material* asset_payload)
             : LoadAssetRequest<Material>(std::move(asset_path), asset_payload)
         {
+            dispatch_policy.is_thread_safe = true;
         }
     };
 
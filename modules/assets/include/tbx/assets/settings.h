@@ -0,0 +1,42 @@
+#pragma once
+#include "tbx/common/typedefs.h"
+#include "tbx/tbx_api.h"
+#include <chrono>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Bounds the work AssetManager::collect_unreferenced does in a single call.
+    /// @details
+    /// Ownership: Value type owned by callers and by AppSettings.
+    /// Thread Safety: Safe for concurrent reads; synchronize concurrent writes externally.
+    struct TBX_API AssetCollectionSettings
+    {
+        // Records examined per call before the collector yields; each empty hash bucket it steps
+        // over counts as one. Zero disables the idle sweep; memory budgets are still enforced.
+        uint max_records_per_step = 64U;
+
+        // Wall-clock time a call may spend before it yields. Zero applies only the record limit.
+        std::chrono::microseconds time_budget = std::chrono::microseconds(200);
+
+        // How long an unreferenced asset stays resident after its last load before eviction.
+        std::chrono::milliseconds min_idle_time = std::chrono::milliseconds(1000);
+
+        // Resident bytes each asset type may hold. A type over budget evicts its least recently
+        // used assets that are unpinned and idle for `budget_min_idle_time`, even when they are
+        // younger than `min_idle_time`. Types without a budget are unbounded.
+        std::unordered_map<std::type_index, size> memory_budgets = {};
+
+        // How long an unreferenced asset stays resident before a memory budget may evict it.
+        std::chrono::milliseconds budget_min_idle_time = std::chrono::milliseconds(100);
+
+        template <typename TAsset>
+        void set_memory_budget(size max_resident_bytes)
+        {
+            memory_budgets.insert_or_assign(std::type_index(typeid(TAsset)), max_resident_bytes);
+        }
+    };
+}
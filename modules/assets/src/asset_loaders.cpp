@@ -120,6 +120,12 @@ namespace tbx
         return std::make_shared<Model>(create_two_sided_fallback_mesh(), material);
     }
 
+    static void append_dependency(std::vector<Handle>& dependencies, const Handle& handle)
+    {
+        if (handle.is_valid() || !handle.get_name().empty())
+            dependencies.push_back(handle);
+    }
+
     void warn_missing_dispatcher(std::string_view action)
     {
         std::string message = std::string("No global dispatcher available to ").append(action);
@@ -393,4 +399,155 @@ namespace tbx
         }
         return asset;
     }
+
+    std::shared_ptr<Model> create_model_fallback(const ModelLoadParameters&)
+    {
+        return create_model_data();
+    }
+
+    std::shared_ptr<Texture> create_texture_fallback(const TextureLoadParameters& parameters)
+    {
+        const TextureSettings& settings = parameters.settings;
+        return create_fallback_texture(
+            settings.wrap,
+            settings.filter,
+            settings.format,
+            settings.mipmaps,
+            settings.compression);
+    }
+
+    std::shared_ptr<Shader> create_shader_fallback(const ShaderLoadParameters&)
+    {
+        return create_shader_data();
+    }
+
+    std::shared_ptr<Material> create_material_fallback(const MaterialLoadParameters&)
+    {
+        return create_material_data();
+    }
+
+    Result decode_model(
+        const std::filesystem::path& asset_path,
+        const ModelLoadParameters&,
+        Model& out_model)
+    {
+        auto* dispatcher = get_global_dispatcher();
+        if (!dispatcher)
+            return Result(false, "No global dispatcher available to decode a model");
+
+        LoadModelRequest message(asset_path, &out_model);
+        message.not_handled_behavior = MessageNotHandledBehavior::WARN;
+        return dispatcher->send(message);
+    }
+
+    Result decode_texture(
+        const std::filesystem::path& asset_path,
+        const TextureLoadParameters& parameters,
+        Texture& out_texture)
+    {
+        auto* dispatcher = get_global_dispatcher();
+        if (!dispatcher)
+            return Result(false, "No global dispatcher available to decode a texture");
+
+        const TextureSettings& settings = parameters.settings;
+        LoadTextureRequest
+            message(
+                asset_path,
+                &out_texture,
+                settings.wrap,
+                settings.filter,
+                settings.format,
+                settings.mipmaps,
+                settings.compression);
+        message.not_handled_behavior = MessageNotHandledBehavior::WARN;
+        return dispatcher->send(message);
+    }
+
+    Result decode_shader(
+        const std::filesystem::path& asset_path,
+        const ShaderLoadParameters&,
+        Shader& out_shader)
+    {
+        auto* dispatcher = get_global_dispatcher();
+        if (!dispatcher)
+            return Result(false, "No global dispatcher available to decode a shader");
+
+        LoadShaderRequest message(asset_path, &out_shader);
+        message.not_handled_behavior = MessageNotHandledBehavior::WARN;
+        return dispatcher->send(message);
+    }
+
+    Result decode_material(
+        const std::filesystem::path& asset_path,
+        const MaterialLoadParameters&,
+        Material& out_material)
+    {
+        auto* dispatcher = get_global_dispatcher();
+        if (!dispatcher)
+            return Result(false, "No global dispatcher available to decode a material");
+
+        LoadMaterialRequest message(asset_path, &out_material);
+        message.not_handled_behavior = MessageNotHandledBehavior::WARN;
+        return dispatcher->send(message);
+    }
+
+    AssetDependencies get_material_dependencies(const Material& material)
+    {
+        auto dependencies = AssetDependencies();
+        append_dependency(dependencies.shaders, material.program.vertex);
+        append_dependency(dependencies.shaders, material.program.fragment);
+        append_dependency(dependencies.shaders, material.program.tesselation);
+        append_dependency(dependencies.shaders, material.program.geometry);
+        append_dependency(dependencies.shaders, material.program.compute);
+        for (const auto& binding : material.textures)
+            append_dependency(dependencies.textures, binding.texture.handle);
+        return dependencies;
+    }
+
+    AssetDependencies get_model_dependencies(const Model& model)
+    {
+        auto dependencies = AssetDependencies();
+        for (const auto& material : model.materials)
+        {
+            auto material_dependencies = get_material_dependencies(material);
+            dependencies.shaders.insert(
+                dependencies.shaders.end(),
+                material_dependencies.shaders.begin(),
+                material_dependencies.shaders.end());
+            dependencies.textures.insert(
+                dependencies.textures.end(),
+                material_dependencies.textures.begin(),
+                material_dependencies.textures.end());
+        }
+        return dependencies;
+    }
+
+    size get_texture_memory_size(const Texture& texture)
+    {
+        return texture.pixels.size() * sizeof(Pixel);
+    }
+
+    size get_model_memory_size(const Model& model)
+    {
+        auto memory_size = size(0U);
+        for (const auto& mesh : model.meshes)
+        {
+            memory_size += mesh.vertices.vertices.size() * sizeof(float);
+            memory_size += mesh.indices.size() * sizeof(uint32);
+        }
+        return memory_size;
+    }
+
+    size get_audio_memory_size(const AudioClip& clip)
+    {
+        return clip.samples.size() * sizeof(float);
+    }
+
+    size get_shader_memory_size(const Shader& shader)
+    {
+        auto memory_size = size(0U);
+        for (const auto& source : shader.sources)
+            memory_size += source.source.size();
+        return memory_size;
+    }
 }
@@ -1,21 +1,54 @@
 #include "tbx/assets/manager.h"
 #include "tbx/assets/events.h"
 #include "tbx/assets/registry.h"
+#include "tbx/async/job_system.h"
 #include "tbx/debugging/macros.h"
 #include "tbx/files/events.h"
 #include "tbx/messages/dispatcher.h"
+#include <algorithm>
 #include <filesystem>
+#include <iterator>
 
 namespace tbx
 {
     namespace
     {
+        constexpr uint CollectionSliceRecordCount = 16U;
+
         Handle build_asset_handle(const AssetRegistryEntry& entry)
         {
             return Handle(entry.normalized_path, entry.asset_id);
         }
     }
 
+    AssetPreload::AssetPreload(std::shared_ptr<AssetPreloadState> state)
+        : _state(std::move(state))
+    {
+    }
+
+    AssetPreloadProgress AssetPreload::get_progress() const
+    {
+        if (!_state)
+            return {};
+
+        std::lock_guard lock(_state->mutex);
+        return _state->progress;
+    }
+
+    std::shared_future<Result> AssetPreload::get_completion() const
+    {
+        return _state ? _state->completion : std::shared_future<Result>();
+    }
+
+    bool AssetPreload::is_complete() const
+    {
+        if (!_state)
+            return false;
+
+        std::lock_guard lock(_state->mutex);
+        return _state->is_complete;
+    }
+
     AssetManager::AssetManager(
         IMessageDispatcher* dispatcher,
         std::filesystem::path working_directory,
@@ -33,6 +66,7 @@ namespace tbx
                   std::move(handle_source),
                   std::move(asset_handle_serializer),
                   _file_ops))
+        , _decode_queue(std::make_shared<AssetDecodeQueue>())
     {
         for (const auto& directory : asset_directories)
             add_directory(directory);
@@ -40,19 +74,157 @@ namespace tbx
 
     AssetManager::~AssetManager() = default;
 
+    Result AssetManager::load_registry_index(const std::filesystem::path& index_path)
+    {
+        std::lock_guard lock(_registry_mutex);
+        return _registry->load_index(index_path);
+    }
+
+    Result AssetManager::save_registry_index()
+    {
+        std::lock_guard lock(_registry_mutex);
+        return _registry->save_index();
+    }
+
+    void AssetManager::set_job_system(JobSystem* job_system)
+    {
+        std::lock_guard lock(_registry_mutex);
+        _job_system = job_system;
+        _registry->set_job_system(job_system);
+    }
+
+    uint AssetManager::publish_decoded_assets()
+    {
+        auto publishers = std::vector<std::move_only_function<void()>>();
+        {
+            std::lock_guard lock(_decode_queue->mutex);
+            publishers.swap(_decode_queue->publishers);
+        }
+
+        for (auto& publish : publishers)
+            publish();
+        return static_cast<uint>(publishers.size());
+    }
+
+    uint AssetManager::advance_preloads()
+    {
+        auto preloads = std::vector<std::shared_ptr<AssetPreloadState>>();
+        {
+            std::lock_guard lock(_preload_mutex);
+            preloads = _preloads;
+        }
+
+        uint finished_count = 0U;
+        for (const auto& state : preloads)
+        {
+            std::lock_guard lock(state->mutex);
+
+            // Dependencies of an asset may already be loaded, so keep sweeping until a pass finds
+            // nothing new that is ready.
+            auto has_progress = true;
+            while (has_progress)
+            {
+                has_progress = false;
+                auto pending = std::move(state->pending);
+                state->pending.clear();
+                for (auto& entry : pending)
+                {
+                    if (entry.load.valid()
+                        && entry.load.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                    {
+                        state->pending.push_back(std::move(entry));
+                        continue;
+                    }
+
+                    has_progress = true;
+                    ++finished_count;
+                    const auto load_result = entry.load.valid() ? entry.load.get() : Result();
+                    if (!load_result)
+                    {
+                        state->add_failure(entry.handle, load_result.get_report());
+                        continue;
+                    }
+
+                    auto asset = entry.resolve_asset();
+                    if (!asset)
+                    {
+                        state->add_failure(entry.handle, "Asset could not be resolved.");
+                        continue;
+                    }
+
+                    ++state->progress.finished_count;
+                    queue_dependencies(*state, entry.get_dependencies(asset.get()));
+                    state->loaded_assets.push_back(std::move(asset));
+                }
+            }
+
+            if (!state->pending.empty() || state->is_complete)
+                continue;
+
+            state->is_complete = true;
+            if (state->progress.failed_count == 0U)
+                state->completion_source.set_value({});
+            else
+                state->completion_source.set_value(Result(false, state->failure_report));
+        }
+
+        std::lock_guard lock(_preload_mutex);
+        std::erase_if(
+            _preloads,
+            [](const std::shared_ptr<AssetPreloadState>& state)
+            {
+                std::lock_guard state_lock(state->mutex);
+                return state->is_complete;
+            });
+        return finished_count;
+    }
+
+    void AssetManager::queue_dependencies(
+        AssetPreloadState& state,
+        const AssetDependencies& dependencies)
+    {
+        for (const auto& handle : dependencies.textures)
+            queue_preload<Texture>(state, handle);
+        for (const auto& handle : dependencies.shaders)
+            queue_preload<Shader>(state, handle);
+        for (const auto& handle : dependencies.materials)
+            queue_preload<Material>(state, handle);
+    }
+
+    void AssetManager::schedule_decode(std::move_only_function<void()> decode_job)
+    {
+        try
+        {
+            _job_system.load()->schedule(std::move(decode_job));
+        }
+        catch (...)
+        {
+            // The job system no longer accepts work, so decode on the caller instead.
+            decode_job();
+        }
+    }
+
     void AssetManager::unload_all()
     {
         TBX_TRACE_INFO("Unloading all assets.");
-        std::lock_guard lock(_mutex);
-        _stores.clear();
+        std::lock_guard collection_lock(_collection_mutex);
+        std::shared_lock lock(_stores_mutex);
+        for (const auto& store : _stores)
+        {
+            std::lock_guard store_lock(store.second->mutex);
+            store.second->clear();
+        }
+        _collection_store_index = 0U;
     }
 
     void AssetManager::unload_unreferenced()
     {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_stores_mutex);
         for (const auto& store : _stores)
         {
+            std::unique_lock store_lock(store.second->mutex);
             const auto unloaded_count = store.second->unload_unreferenced();
+            store_lock.unlock();
             if (unloaded_count > 0U)
             {
                 TBX_TRACE_INFO(
@@ -63,9 +235,95 @@ namespace tbx
         }
     }
 
+    AssetCollectionStats AssetManager::collect_unreferenced(const AssetCollectionSettings& settings)
+    {
+        auto stats = AssetCollectionStats {};
+        if (settings.max_records_per_step == 0U && settings.memory_budgets.empty())
+            return stats;
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto has_time_budget = settings.time_budget.count() > 0;
+        const auto deadline = start + settings.time_budget;
+
+        auto remaining_record_count = settings.max_records_per_step;
+
+        std::lock_guard collection_lock(_collection_mutex);
+        std::shared_lock lock(_stores_mutex);
+        if (_collection_store_index >= _stores.size())
+            _collection_store_index = 0U;
+
+        while (!_stores.empty() && remaining_record_count > 0U)
+        {
+            // Small slices keep the clock checks frequent enough to honor the time budget.
+            const auto slice = std::min(remaining_record_count, CollectionSliceRecordCount);
+            remaining_record_count -= slice;
+            auto& store = *std::next(_stores.begin(), _collection_store_index)->second;
+            std::unique_lock store_lock(store.mutex);
+            const auto result = store.collect_unreferenced(slice, start, settings.min_idle_time);
+            store_lock.unlock();
+            stats.examined_count += result.examined_count;
+            stats.unloaded_count += result.unloaded_count;
+            if (result.unloaded_count > 0U)
+            {
+                TBX_TRACE_INFO(
+                    "Unloaded {} unreferenced assets (type={}).",
+                    result.unloaded_count,
+                    store.get_asset_type_name());
+            }
+            if (result.has_finished_pass && ++_collection_store_index >= _stores.size())
+            {
+                // Stop at the end of a sweep so one call never examines a record twice.
+                _collection_store_index = 0U;
+                stats.has_completed_pass = true;
+                break;
+            }
+
+            if (has_time_budget && std::chrono::steady_clock::now() >= deadline)
+                break;
+        }
+
+        // Budgets are enforced after the sweep so idle assets it already released are not
+        // counted against them. Only unreferenced assets can be evicted.
+        for (const auto& [type_key, store] : _stores)
+        {
+            const auto budget = settings.memory_budgets.find(type_key);
+            const auto budget_bytes =
+                budget != settings.memory_budgets.end() ? budget->second : size(0U);
+            std::unique_lock store_lock(store->mutex);
+            const auto evicted_count =
+                store->enforce_memory_budget(budget_bytes, start, settings.budget_min_idle_time);
+            store_lock.unlock();
+            stats.evicted_count += evicted_count;
+            if (evicted_count > 0U)
+            {
+                TBX_TRACE_INFO(
+                    "Evicted {} least recently used assets to fit a {} byte budget (type={}).",
+                    evicted_count,
+                    budget_bytes,
+                    store->get_asset_type_name());
+            }
+        }
+
+        stats.elapsed = std::chrono::steady_clock::now() - start;
+        return stats;
+    }
+
+    std::vector<AssetMemoryUsage> AssetManager::get_memory_usage() const
+    {
+        std::shared_lock lock(_stores_mutex);
+        auto usage = std::vector<AssetMemoryUsage>();
+        usage.reserve(_stores.size());
+        for (const auto& [type_key, store] : _stores)
+        {
+            std::shared_lock store_lock(store->mutex);
+            usage.push_back(store->get_memory_usage());
+        }
+        return usage;
+    }
+
     Uuid AssetManager::ensure(const Handle& handle)
     {
-        std::lock_guard lock(_mutex);
+        std::lock_guard lock(_registry_mutex);
         auto asset_id = Uuid {};
         const auto ensure_result = _registry->ensure_asset_id(handle, &asset_id);
         if (!ensure_result.succeeded())
@@ -92,25 +350,67 @@ namespace tbx
 
     std::filesystem::path AssetManager::resolve(const std::filesystem::path& asset_path) const
     {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_registry_mutex);
         return _registry->resolve_asset_path(asset_path);
     }
 
     std::filesystem::path AssetManager::resolve(const Handle& handle) const
     {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_registry_mutex);
         return _registry->resolve_asset_path(handle);
     }
 
-    void AssetManager::set_pinned(const Handle& handle, bool is_pinned)
+    Uuid AssetManager::find_asset_id(const Handle& handle) const
     {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_registry_mutex);
+        if (!handle.get_name().empty())
+        {
+            auto iterator = _asset_ids_by_name.find(handle.get_name());
+            if (iterator != _asset_ids_by_name.end())
+                return iterator->second;
+        }
+
         auto* entry = _registry->find_entry(handle);
-        if (!entry || !entry->asset_id.is_valid())
+        return entry ? entry->asset_id : Uuid {};
+    }
+
+    bool AssetManager::ensure_asset_entry(const Handle& handle, AssetRegistryEntry& out_entry)
+    {
+        std::lock_guard lock(_registry_mutex);
+        const AssetRegistryEntry* entry = nullptr;
+        const auto ensure_result = _registry->ensure_entry(handle, &entry);
+        if (!ensure_result.succeeded() || !entry)
+        {
+            TBX_TRACE_WARNING(
+                "Failed to ensure asset entry for handle (name='{}', id={}): {}",
+                handle.get_name(),
+                to_string(handle.get_id()),
+                ensure_result.get_report());
+            return false;
+        }
+        if (!ensure_result.get_report().empty())
+        {
+            TBX_TRACE_INFO("Asset registry: {}", ensure_result.get_report());
+        }
+
+        if (!handle.get_name().empty())
+            _asset_ids_by_name.insert_or_assign(handle.get_name(), entry->asset_id);
+        out_entry = *entry;
+        return true;
+    }
+
+    void AssetManager::set_pinned(const Handle& handle, bool is_pinned)
+    {
+        const auto asset_id = find_asset_id(handle);
+        if (!asset_id.is_valid())
             return;
 
+        std::shared_lock lock(_stores_mutex);
         for (auto& store : _stores)
-            store.second->set_pinned(entry->asset_id, is_pinned);
+        {
+            std::lock_guard store_lock(store.second->mutex);
+            store.second->set_pinned(asset_id, is_pinned);
+        }
     }
 
     void AssetManager::add_directory(const std::filesystem::path& path)
@@ -118,7 +418,7 @@ namespace tbx
         if (path.empty())
             return;
 
-        std::lock_guard lock(_mutex);
+        std::lock_guard lock(_registry_mutex);
         const auto directory_count = _registry->get_asset_directories().size();
         const auto add_result = _registry->add_asset_directory(path);
         if (!add_result.succeeded())
@@ -134,6 +434,9 @@ namespace tbx
             TBX_TRACE_INFO("Asset registry: {}", add_result.get_report());
         }
 
+        // A new root can shadow paths that earlier roots resolved.
+        _asset_ids_by_name.clear();
+
         const auto directories = _registry->get_asset_directories();
         if (directories.size() == directory_count)
             return;
@@ -146,10 +449,15 @@ namespace tbx
 
     std::vector<std::filesystem::path> AssetManager::get_directories() const
     {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_registry_mutex);
         return _registry->get_asset_directories();
     }
 
+    std::shared_ptr<IFileOps> AssetManager::get_file_ops() const
+    {
+        return _file_ops;
+    }
+
     void AssetManager::on_asset_changed(
         const std::filesystem::path& watched_path,
         const FileWatchChange& change)
@@ -172,9 +480,13 @@ namespace tbx
         Handle affected_asset = {};
 
         {
-            std::lock_guard lock(_mutex);
+            std::lock_guard lock(_registry_mutex);
+            std::shared_lock stores_lock(_stores_mutex);
             AssetRegistryEntry registry_entry = {};
 
+            // Created, modified and removed files can all change which id a name resolves to.
+            _asset_ids_by_name.clear();
+
             switch (change.type)
             {
                 case FileWatchChangeType::CREATED:
@@ -226,9 +538,11 @@ namespace tbx
                     {
                         for (auto& store : _stores)
                         {
+                            std::unique_lock store_lock(store.second->mutex);
                             const auto store_reload_result = store.second->reload(
                                 registry_entry,
                                 std::chrono::steady_clock::now());
+                            store_lock.unlock();
                             if (!store_reload_result.attempted)
                                 continue;
 
@@ -286,7 +600,10 @@ namespace tbx
                     if (registry_entry.asset_id.is_valid())
                     {
                         for (auto& store : _stores)
+                        {
+                            std::lock_guard store_lock(store.second->mutex);
                             store.second->erase(registry_entry.asset_id);
+                        }
                     }
 
                     affected_asset = build_asset_handle(registry_entry);
@@ -1,9 +1,15 @@
 #include "tbx/assets/manager.h"
+#include "tbx/async/job_system.h"
 #include "tbx/common/string_utils.h"
 #include "tbx/files/ops.h"
 #include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -11,6 +17,117 @@ namespace tbx
 {
     namespace
     {
+        // Files a scan job claims at a time; small enough to balance slow network stats.
+        constexpr size ScanBatchSize = 16U;
+
+        struct ParallelScanState
+        {
+            std::function<void(size)> work = {};
+            size count = 0U;
+            std::atomic<size> next_index = 0U;
+            std::mutex mutex = {};
+            std::condition_variable finished = {};
+            size finished_count = 0U;
+        };
+
+        // Claims and runs batches until none are left. Helpers that start after every batch was
+        // claimed return without touching the caller's data.
+        void run_scan_batches(ParallelScanState& state)
+        {
+            while (true)
+            {
+                const auto begin = state.next_index.fetch_add(ScanBatchSize);
+                if (begin >= state.count)
+                    return;
+
+                const auto end = std::min(begin + ScanBatchSize, state.count);
+                for (auto index = begin; index < end; ++index)
+                    state.work(index);
+
+                std::lock_guard lock(state.mutex);
+                state.finished_count += end - begin;
+                if (state.finished_count == state.count)
+                    state.finished.notify_all();
+            }
+        }
+
+        // Runs `work` for every index in [0, count) on the caller and idle job workers. The caller
+        // works too and only waits for claimed batches, so this cannot deadlock on a busy pool.
+        void run_in_parallel(JobSystem* job_system, size count, std::function<void(size)> work)
+        {
+            auto state = std::make_shared<ParallelScanState>();
+            state->work = std::move(work);
+            state->count = count;
+            if (job_system && count > ScanBatchSize)
+            {
+                const auto helper_count = std::min(
+                    job_system->get_worker_count(),
+                    (count + ScanBatchSize - 1U) / ScanBatchSize - 1U);
+                try
+                {
+                    for (size helper = 0U; helper < helper_count; ++helper)
+                        job_system->schedule([state]() { run_scan_batches(*state); });
+                }
+                catch (...)
+                {
+                    // The job system no longer accepts work; the caller scans the rest.
+                }
+            }
+
+            run_scan_batches(*state);
+            std::unique_lock lock(state->mutex);
+            state->finished.wait(
+                lock,
+                [&state]()
+                {
+                    return state->finished_count == state->count;
+                });
+        }
+
+        // Bump when the index line layout changes; older indexes are then ignored.
+        constexpr std::string_view AssetIndexHeader = "tbx-asset-index 2";
+
+        template <typename TNumber>
+        bool try_parse_index_number(std::string_view text, TNumber& out_value)
+        {
+            const auto* end = text.data() + text.size();
+            const auto [parsed_end, error] = std::from_chars(text.data(), end, out_value);
+            return error == std::errc() && parsed_end == end;
+        }
+
+        bool try_parse_index_line(
+            std::string_view line,
+            std::string& out_path,
+            AssetIndexRecord& out_record)
+        {
+            const auto id_end = line.find('\t');
+            const auto time_end =
+                id_end == std::string_view::npos ? id_end : line.find('\t', id_end + 1U);
+            const auto size_end =
+                time_end == std::string_view::npos ? time_end : line.find('\t', time_end + 1U);
+            if (size_end == std::string_view::npos)
+                return false;
+
+            auto id = uint32();
+            auto ticks = std::filesystem::file_time_type::rep();
+            auto meta_size = uint64();
+            if (!try_parse_index_number(line.substr(0U, id_end), id)
+                || !try_parse_index_number(
+                    line.substr(id_end + 1U, time_end - id_end - 1U),
+                    ticks)
+                || !try_parse_index_number(
+                    line.substr(time_end + 1U, size_end - time_end - 1U),
+                    meta_size))
+                return false;
+
+            out_path = line.substr(size_end + 1U);
+            out_record.asset_id = Uuid(id);
+            out_record.meta_write_time = std::filesystem::file_time_type(
+                std::filesystem::file_time_type::duration(ticks));
+            out_record.meta_size = meta_size;
+            return !out_path.empty() && out_record.asset_id.is_valid();
+        }
+
         Result make_failed_result(std::string report)
         {
             auto result = Result {};
@@ -381,37 +498,45 @@ namespace tbx
             return make_failed_result("Cannot scan an empty asset directory root.");
         }
 
-        auto result = Result {};
-        auto entries = _file_ops->read_directory(root);
-        auto asset_entries = std::vector<std::filesystem::path>();
-        for (const auto& entry : entries)
-        {
-            if (_file_ops->get_type(entry) != FileType::FILE)
-                continue;
-            if (!should_track_asset_path(entry))
-                continue;
-
-            asset_entries.push_back(entry);
-        }
+        // Stat, resolve, and read sidecars in parallel; only the merge below mutates the registry.
+        const auto entries = _file_ops->read_directory(root);
+        auto scanned_files = std::vector<ScannedAssetFile>(entries.size());
+        run_in_parallel(
+            _job_system,
+            entries.size(),
+            [this, &entries, &scanned_files](size index)
+            {
+                scanned_files[index] = scan_asset_file(entries[index]);
+            });
 
+        std::erase_if(
+            scanned_files,
+            [](const ScannedAssetFile& scanned)
+            {
+                return scanned.normalized_path.empty();
+            });
         std::sort(
-            asset_entries.begin(),
-            asset_entries.end(),
-            [](const std::filesystem::path& left, const std::filesystem::path& right)
+            scanned_files.begin(),
+            scanned_files.end(),
+            [](const ScannedAssetFile& left, const ScannedAssetFile& right)
             {
-                return left.lexically_normal().generic_string()
-                       < right.lexically_normal().generic_string();
+                return left.normalized_path < right.normalized_path;
             });
 
-        for (const auto& entry : asset_entries)
+        auto result = Result {};
+        for (auto& scanned : scanned_files)
         {
-            auto& registry_entry = get_or_create_path_entry(entry);
+            auto& registry_entry = get_or_create_resolved_entry(
+                std::move(scanned.resolved_path),
+                scanned.normalized_path);
             if (registry_entry.asset_id.is_valid())
             {
                 continue;
             }
 
-            auto discovered_id = try_resolve_discovered_asset_id(registry_entry);
+            auto discovered_id = try_get_handle_source_id(registry_entry.resolved_path);
+            if (!discovered_id.is_valid())
+                discovered_id = accept_meta_probe(registry_entry.normalized_path, scanned.meta);
             if (discovered_id.is_valid())
             {
                 const auto assign_result = try_assign_asset_id(registry_entry, discovered_id);
@@ -422,6 +547,103 @@ namespace tbx
         return result;
     }
 
+    void AssetRegistry::set_job_system(JobSystem* job_system)
+    {
+        _job_system = job_system;
+    }
+
+    Result AssetRegistry::load_index(const std::filesystem::path& index_path)
+    {
+        _index_path = index_path;
+        _index.clear();
+        _is_index_dirty = false;
+
+        auto data = std::string();
+        if (index_path.empty()
+            || !_file_ops->read_file(index_path, FileDataFormat::UTF8_TEXT, data))
+        {
+            auto result = Result {};
+            result.flag_success("No asset registry index to load.");
+            return result;
+        }
+
+        auto lines = std::string_view(data);
+        auto line_end = lines.find('\n');
+        if (lines.substr(0U, line_end) != AssetIndexHeader)
+        {
+            return make_failed_result(
+                std::string("Ignoring asset registry index '")
+                    .append(index_path.generic_string())
+                    .append("' with an unknown format."));
+        }
+
+        auto skipped_count = uint();
+        while (line_end != std::string_view::npos)
+        {
+            lines.remove_prefix(line_end + 1U);
+            line_end = lines.find('\n');
+            const auto line = lines.substr(0U, line_end);
+            if (line.empty())
+                continue;
+
+            auto path = std::string();
+            auto record = AssetIndexRecord();
+            if (!try_parse_index_line(line, path, record))
+            {
+                ++skipped_count;
+                continue;
+            }
+            _index.insert_or_assign(std::move(path), record);
+        }
+
+        auto result = Result {};
+        if (skipped_count > 0U)
+        {
+            append_report(
+                result,
+                std::string("Skipped ")
+                    .append(std::to_string(skipped_count))
+                    .append(" malformed asset registry index lines."));
+        }
+        return result;
+    }
+
+    Result AssetRegistry::save_index()
+    {
+        if (_index_path.empty() || !_is_index_dirty)
+            return {};
+
+        auto data = std::string(AssetIndexHeader);
+        data.push_back('\n');
+        for (const auto& [path, record] : _index)
+        {
+            // Drop assets that were deleted or re-keyed since they were indexed.
+            const auto* entry = find_entry_by_path(path);
+            if (!entry || entry->asset_id != record.asset_id)
+                continue;
+
+            data.append(std::to_string(static_cast<uint32>(record.asset_id)))
+                .append("\t")
+                .append(std::to_string(record.meta_write_time.time_since_epoch().count()))
+                .append("\t")
+                .append(std::to_string(record.meta_size))
+                .append("\t")
+                .append(path)
+                .append("\n");
+        }
+
+        if (!_file_ops->write_file(_index_path, FileDataFormat::UTF8_TEXT, data))
+        {
+            return make_failed_result(
+                std::string("Failed to write asset registry index '")
+                    .append(_index_path.generic_string())
+                    .append("'."));
+        }
+
+        _is_index_dirty = false;
+        return {};
+    }
+
     AssetRegistryEntry* AssetRegistry::find_entry_by_id(Uuid asset_id)
     {
         return const_cast<AssetRegistryEntry*>(
@@ -485,6 +707,13 @@ namespace tbx
     {
         auto resolved_path = resolve_asset_path(asset_path);
         auto normalized_path = resolved_path.lexically_normal().generic_string();
+        return get_or_create_resolved_entry(std::move(resolved_path), normalized_path);
+    }
+
+    AssetRegistryEntry& AssetRegistry::get_or_create_resolved_entry(
+        std::filesystem::path resolved_path,
+        const std::string& normalized_path)
+    {
         auto iterator = _entries_by_path.find(normalized_path);
         if (iterator != _entries_by_path.end())
         {
@@ -504,31 +733,91 @@ namespace tbx
         return resolve_asset_path(asset_path).lexically_normal().generic_string();
     }
 
-    Uuid AssetRegistry::try_resolve_discovered_asset_id(const AssetRegistryEntry& entry) const
+    Uuid AssetRegistry::try_resolve_discovered_asset_id(const AssetRegistryEntry& entry)
     {
-        if (_handle_source)
+        if (const auto source_id = try_get_handle_source_id(entry.resolved_path);
+            source_id.is_valid())
         {
-            auto handle = Handle();
-            if (_handle_source(entry.resolved_path, handle) && handle.get_id().is_valid())
-            {
-                return handle.get_id();
-            }
+            return source_id;
         }
 
-        auto meta_path = entry.resolved_path;
+        return accept_meta_probe(
+            entry.normalized_path,
+            probe_meta_asset_id(entry.resolved_path, entry.normalized_path));
+    }
+
+    Uuid AssetRegistry::try_get_handle_source_id(const std::filesystem::path& resolved_path) const
+    {
+        if (!_handle_source)
+            return {};
+
+        auto handle = Handle();
+        if (_handle_source(resolved_path, handle) && handle.get_id().is_valid())
+            return handle.get_id();
+        return {};
+    }
+
+    ScannedAssetFile AssetRegistry::scan_asset_file(const std::filesystem::path& asset_path) const
+    {
+        if (!should_track_asset_path(asset_path)
+            || _file_ops->get_type(asset_path) != FileType::FILE)
+            return {};
+
+        auto scanned = ScannedAssetFile();
+        scanned.resolved_path = resolve_asset_path(asset_path);
+        scanned.normalized_path = scanned.resolved_path.lexically_normal().generic_string();
+        scanned.meta = probe_meta_asset_id(scanned.resolved_path, scanned.normalized_path);
+        return scanned;
+    }
+
+    AssetMetaProbe AssetRegistry::probe_meta_asset_id(
+        const std::filesystem::path& resolved_path,
+        const std::string& normalized_path) const
+    {
+        // The sidecar's write time and size both detect a missing sidecar and validate the
+        // indexed id; a rewrite within the clock's resolution still changes the size.
+        auto probe = AssetMetaProbe();
+        auto meta_path = resolved_path;
         meta_path += ".meta";
-        if (!_file_ops->exists(meta_path))
+        probe.meta_write_time = _file_ops->get_last_write_time(meta_path);
+        if (!_file_ops->get_file_size(meta_path, probe.meta_size))
         {
-            return {};
+            return probe;
         }
 
-        auto parsed_handle = _handle_serializer->read_from_disk(*_file_ops, entry.resolved_path);
-        if (!parsed_handle || !parsed_handle->get_id().is_valid())
+        if (const auto indexed = _index.find(normalized_path);
+            indexed != _index.end() && indexed->second.meta_write_time == probe.meta_write_time
+            && indexed->second.meta_size == probe.meta_size)
         {
-            return {};
+            probe.asset_id = indexed->second.asset_id;
+            return probe;
         }
 
-        return parsed_handle->get_id();
+        auto parsed_handle = _handle_serializer->read_from_disk(*_file_ops, resolved_path);
+        if (parsed_handle && parsed_handle->get_id().is_valid())
+        {
+            probe.asset_id = parsed_handle->get_id();
+            probe.was_parsed = true;
+        }
+        return probe;
+    }
+
+    Uuid AssetRegistry::accept_meta_probe(
+        const std::string& normalized_path,
+        const AssetMetaProbe& probe)
+    {
+        if (probe.was_parsed)
+        {
+            _index.insert_or_assign(
+                normalized_path,
+                AssetIndexRecord {
+                    .asset_id = probe.asset_id,
+                    .meta_write_time = probe.meta_write_time,
+                    .meta_size = probe.meta_size,
+                });
+            _is_index_dirty = true;
+        }
+        return probe.asset_id;
     }
 
     Result AssetRegistry::resolve_or_repair_asset_id(
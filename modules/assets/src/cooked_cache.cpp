@@ -0,0 +1,601 @@
+#include "tbx/assets/cooked_cache.h"
+#include <array>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace tbx
+{
+    namespace
+    {
+        constexpr std::array<char, 4> CookedBlobMagic = {'T', 'B', 'X', 'C'};
+
+        // Bump whenever the blob layout or any serialized type changes.
+        constexpr uint32 CookedBlobVersion = 1U;
+
+        // Magic, version, kind, key hashes, and payload size.
+        constexpr size CookedBlobHeaderSize =
+            sizeof(CookedBlobMagic) + sizeof(uint32) * 2U + sizeof(uint64) * 3U;
+
+        constexpr uint32 TextureBlobKind = 1U;
+        constexpr uint32 ModelBlobKind = 2U;
+        constexpr uint32 MaterialBlobKind = 3U;
+
+        constexpr uint64 FnvOffsetBasis = 14695981039346656037ULL;
+        constexpr uint64 FnvPrime = 1099511628211ULL;
+
+        uint64 hash_bytes(std::string_view bytes, uint64 hash = FnvOffsetBasis)
+        {
+            for (const auto byte : bytes)
+            {
+                hash ^= static_cast<uint8>(byte);
+                hash *= FnvPrime;
+            }
+            return hash;
+        }
+
+        const char* get_blob_kind_name(uint32 kind)
+        {
+            switch (kind)
+            {
+                case TextureBlobKind:
+                    return "texture";
+                case ModelBlobKind:
+                    return "model";
+                case MaterialBlobKind:
+                    return "material";
+                default:
+                    return "unknown";
+            }
+        }
+
+        class BlobWriter
+        {
+          public:
+            template <typename TValue>
+            void write(const TValue& value)
+            {
+                static_assert(std::is_trivially_copyable_v<TValue>);
+                const auto offset = _data.size();
+                _data.resize(offset + sizeof(TValue));
+                std::memcpy(_data.data() + offset, &value, sizeof(TValue));
+            }
+
+            template <typename TValue>
+            void write_array(const std::vector<TValue>& values)
+            {
+                static_assert(std::is_trivially_copyable_v<TValue>);
+                write(static_cast<uint64>(values.size()));
+                const auto offset = _data.size();
+                _data.resize(offset + values.size() * sizeof(TValue));
+                if (!values.empty())
+                    std::memcpy(
+                        _data.data() + offset,
+                        values.data(),
+                        values.size() * sizeof(TValue));
+            }
+
+            void write_string(std::string_view value)
+            {
+                write(static_cast<uint64>(value.size()));
+                _data.append(value);
+            }
+
+            template <typename... TAlternatives>
+            void write_variant(const std::variant<TAlternatives...>& value)
+            {
+                write(static_cast<uint32>(value.index()));
+                std::visit([this](const auto& alternative) { write(alternative); }, value);
+            }
+
+            std::string& get_data()
+            {
+                return _data;
+            }
+
+          private:
+            std::string _data = {};
+        };
+
+        class BlobReader
+        {
+          public:
+            BlobReader(std::string_view data)
+                : _data(data)
+            {
+            }
+
+          public:
+            template <typename TValue>
+            bool read(TValue& out_value)
+            {
+                static_assert(std::is_trivially_copyable_v<TValue>);
+                if (_data.size() - _offset < sizeof(TValue))
+                    return false;
+
+                std::memcpy(&out_value, _data.data() + _offset, sizeof(TValue));
+                _offset += sizeof(TValue);
+                return true;
+            }
+
+            template <typename TValue>
+            bool read_array(std::vector<TValue>& out_values)
+            {
+                static_assert(std::is_trivially_copyable_v<TValue>);
+                auto count = uint64();
+                if (!read(count) || count > (_data.size() - _offset) / sizeof(TValue))
+                    return false;
+
+                out_values.resize(static_cast<size>(count));
+                if (count > 0U)
+                    std::memcpy(out_values.data(), _data.data() + _offset, count * sizeof(TValue));
+                _offset += static_cast<size>(count * sizeof(TValue));
+                return true;
+            }
+
+            bool read_string(std::string& out_value)
+            {
+                auto length = uint64();
+                if (!read(length) || length > _data.size() - _offset)
+                    return false;
+
+                out_value.assign(_data.substr(_offset, static_cast<size>(length)));
+                _offset += static_cast<size>(length);
+                return true;
+            }
+
+            // Reads a count that must be backed by at least one byte per element, so corrupted
+            // blobs cannot request huge allocations.
+            bool read_count(size& out_count)
+            {
+                auto count = uint64();
+                if (!read(count) || count > _data.size() - _offset)
+                    return false;
+
+                out_count = static_cast<size>(count);
+                return true;
+            }
+
+            template <typename... TAlternatives>
+            bool read_variant(std::variant<TAlternatives...>& out_value)
+            {
+                auto index = uint32();
+                if (!read(index))
+                    return false;
+
+                return read_variant_alternative(
+                    index,
+                    out_value,
+                    std::index_sequence_for<TAlternatives...>());
+            }
+
+            bool is_at_end() const
+            {
+                return _offset == _data.size();
+            }
+
+          private:
+            template <typename TVariant, size... TIndices>
+            bool read_variant_alternative(
+                uint32 index,
+                TVariant& out_value,
+                std::index_sequence<TIndices...>)
+            {
+                auto has_read = false;
+                (
+                    [&]()
+                    {
+                        if (index != TIndices)
+                            return;
+
+                        auto alternative = std::variant_alternative_t<TIndices, TVariant>();
+                        has_read = read(alternative);
+                        out_value = alternative;
+                    }(),
+                    ...);
+                return has_read;
+            }
+
+          private:
+            std::string_view _data = {};
+            size _offset = 0U;
+        };
+
+        void write_handle(BlobWriter& writer, const Handle& handle)
+        {
+            writer.write_string(handle.get_name());
+            writer.write(static_cast<uint32>(handle.get_id()));
+        }
+
+        bool read_handle(BlobReader& reader, Handle& out_handle)
+        {
+            auto name = std::string();
+            auto id = uint32();
+            if (!reader.read_string(name) || !reader.read(id))
+                return false;
+
+            out_handle = Handle(std::move(name), Uuid(id));
+            return true;
+        }
+
+        void write_texture_settings(BlobWriter& writer, const TextureSettings& settings)
+        {
+            writer.write(settings.resolution.width);
+            writer.write(settings.resolution.height);
+            writer.write(settings.wrap);
+            writer.write(settings.filter);
+            writer.write(settings.format);
+            writer.write(settings.mipmaps);
+            writer.write(settings.compression);
+        }
+
+        bool read_texture_settings(BlobReader& reader, TextureSettings& out_settings)
+        {
+            return reader.read(out_settings.resolution.width)
+                   && reader.read(out_settings.resolution.height) && reader.read(out_settings.wrap)
+                   && reader.read(out_settings.filter) && reader.read(out_settings.format)
+                   && reader.read(out_settings.mipmaps) && reader.read(out_settings.compression);
+        }
+
+        void write_material(BlobWriter& writer, const Material& material)
+        {
+            write_handle(writer, material.program.vertex);
+            write_handle(writer, material.program.fragment);
+            write_handle(writer, material.program.tesselation);
+            write_handle(writer, material.program.geometry);
+            write_handle(writer, material.program.compute);
+
+            writer.write(static_cast<uint64>(material.parameters.values.size()));
+            for (const auto& parameter : material.parameters.values)
+            {
+                writer.write_string(parameter.name);
+                writer.write_variant(parameter.data);
+            }
+
+            writer.write(static_cast<uint64>(material.textures.values.size()));
+            for (const auto& binding : material.textures.values)
+            {
+                writer.write_string(binding.name);
+                write_handle(writer, binding.texture.handle);
+                writer.write(binding.texture.settings.has_value());
+                if (binding.texture.settings)
+                    write_texture_settings(writer, *binding.texture.settings);
+            }
+
+            writer.write(material.config);
+        }
+
+        bool read_material(BlobReader& reader, Material& out_material)
+        {
+            auto material = Material();
+            if (!read_handle(reader, material.program.vertex)
+                || !read_handle(reader, material.program.fragment)
+                || !read_handle(reader, material.program.tesselation)
+                || !read_handle(reader, material.program.geometry)
+                || !read_handle(reader, material.program.compute))
+                return false;
+
+            auto parameter_count = size();
+            if (!reader.read_count(parameter_count))
+                return false;
+            material.parameters.values.resize(parameter_count);
+            for (auto& parameter : material.parameters.values)
+            {
+                if (!reader.read_string(parameter.name) || !reader.read_variant(parameter.data))
+                    return false;
+            }
+
+            auto texture_count = size();
+            if (!reader.read_count(texture_count))
+                return false;
+            material.textures.values.resize(texture_count);
+            for (auto& binding : material.textures.values)
+            {
+                auto has_settings = false;
+                if (!reader.read_string(binding.name)
+                    || !read_handle(reader, binding.texture.handle) || !reader.read(has_settings))
+                    return false;
+
+                if (has_settings)
+                {
+                    auto settings = TextureSettings();
+                    if (!read_texture_settings(reader, settings))
+                        return false;
+                    binding.texture.settings = settings;
+                }
+            }
+
+            if (!reader.read(material.config))
+                return false;
+
+            out_material = std::move(material);
+            return true;
+        }
+
+        void write_mesh(BlobWriter& writer, const Mesh& mesh)
+        {
+            writer.write_array(mesh.vertices.vertices);
+            writer.write(mesh.vertices.layout.stride);
+            writer.write(static_cast<uint64>(mesh.vertices.layout.elements.size()));
+            for (const auto& attribute : mesh.vertices.layout.elements)
+            {
+                writer.write_variant(attribute.type);
+                writer.write(attribute.size);
+                writer.write(attribute.count);
+                writer.write(attribute.offset);
+                writer.write(attribute.normalized);
+            }
+            writer.write_array(mesh.indices);
+        }
+
+        bool read_mesh(BlobReader& reader, Mesh& out_mesh)
+        {
+            auto element_count = size();
+            if (!reader.read_array(out_mesh.vertices.vertices)
+                || !reader.read(out_mesh.vertices.layout.stride)
+                || !reader.read_count(element_count))
+                return false;
+
+            out_mesh.vertices.layout.elements.resize(element_count);
+            for (auto& attribute : out_mesh.vertices.layout.elements)
+            {
+                if (!reader.read_variant(attribute.type) || !reader.read(attribute.size)
+                    || !reader.read(attribute.count) || !reader.read(attribute.offset)
+                    || !reader.read(attribute.normalized))
+                    return false;
+            }
+            return reader.read_array(out_mesh.indices);
+        }
+    }
+
+    CookedAssetCache::CookedAssetCache(std::filesystem::path cache_directory)
+        : _directory(std::move(cache_directory))
+        , _file_ops(_directory)
+    {
+    }
+
+    CookedAssetKey CookedAssetCache::make_key(
+        std::string_view source_data,
+        std::string_view parameters)
+    {
+        return CookedAssetKey {
+            .source_hash = hash_bytes(source_data),
+            .parameter_hash = hash_bytes(parameters),
+        };
+    }
+
+    const std::filesystem::path& CookedAssetCache::get_directory() const
+    {
+        return _directory;
+    }
+
+    bool CookedAssetCache::try_read(const CookedAssetKey& key, Texture& out_texture) const
+    {
+        auto blob = FileView();
+        auto payload = std::string_view();
+        if (!read_blob(key, TextureBlobKind, blob, payload))
+            return false;
+
+        auto reader = BlobReader(payload);
+        auto texture = Texture();
+        if (!read_texture_settings(reader, texture) || !reader.read_array(texture.pixels)
+            || !reader.is_at_end())
+            return false;
+
+        out_texture = std::move(texture);
+        return true;
+    }
+
+    bool CookedAssetCache::try_read(const CookedAssetKey& key, Model& out_model) const
+    {
+        auto blob = FileView();
+        auto payload = std::string_view();
+        if (!read_blob(key, ModelBlobKind, blob, payload))
+            return false;
+
+        auto reader = BlobReader(payload);
+        auto model = Model();
+        auto mesh_count = size();
+        if (!reader.read_count(mesh_count))
+            return false;
+        model.meshes.resize(mesh_count);
+        for (auto& mesh : model.meshes)
+        {
+            if (!read_mesh(reader, mesh))
+                return false;
+        }
+
+        auto material_count = size();
+        if (!reader.read_count(material_count))
+            return false;
+        model.materials.resize(material_count);
+        for (auto& material : model.materials)
+        {
+            if (!read_material(reader, material))
+                return false;
+        }
+
+        auto part_count = size();
+        if (!reader.read_count(part_count))
+            return false;
+        model.parts.resize(part_count);
+        for (auto& part : model.parts)
+        {
+            if (!reader.read(part.transform) || !reader.read(part.mesh_index)
+                || !reader.read(part.material_index) || !reader.read_array(part.children))
+                return false;
+        }
+
+        if (!reader.is_at_end())
+            return false;
+
+        out_model = std::move(model);
+        return true;
+    }
+
+    bool CookedAssetCache::try_read(const CookedAssetKey& key, Material& out_material) const
+    {
+        auto blob = FileView();
+        auto payload = std::string_view();
+        if (!read_blob(key, MaterialBlobKind, blob, payload))
+            return false;
+
+        auto reader = BlobReader(payload);
+        auto material = Material();
+        if (!read_material(reader, material) || !reader.is_at_end())
+            return false;
+
+        out_material = std::move(material);
+        return true;
+    }
+
+    Result CookedAssetCache::write(const CookedAssetKey& key, const Texture& texture) const
+    {
+        auto writer = BlobWriter();
+        write_texture_settings(writer, texture);
+        writer.write_array(texture.pixels);
+        return write_blob(key, TextureBlobKind, writer.get_data());
+    }
+
+    Result CookedAssetCache::write(const CookedAssetKey& key, const Model& model) const
+    {
+        auto writer = BlobWriter();
+        writer.write(static_cast<uint64>(model.meshes.size()));
+        for (const auto& mesh : model.meshes)
+            write_mesh(writer, mesh);
+
+        writer.write(static_cast<uint64>(model.materials.size()));
+        for (const auto& material : model.materials)
+            write_material(writer, material);
+
+        writer.write(static_cast<uint64>(model.parts.size()));
+        for (const auto& part : model.parts)
+        {
+            writer.write(part.transform);
+            writer.write(part.mesh_index);
+            writer.write(part.material_index);
+            writer.write_array(part.children);
+        }
+        return write_blob(key, ModelBlobKind, writer.get_data());
+    }
+
+    Result CookedAssetCache::write(const CookedAssetKey& key, const Material& material) const
+    {
+        auto writer = BlobWriter();
+        write_material(writer, material);
+        return write_blob(key, MaterialBlobKind, writer.get_data());
+    }
+
+    std::filesystem::path CookedAssetCache::get_blob_path(const CookedAssetKey& key, uint32 kind)
+        const
+    {
+        return _directory
+               / std::format(
+                   "{:016x}{:016x}.{}.tbxc",
+                   key.source_hash,
+                   key.parameter_hash,
+                   get_blob_kind_name(kind));
+    }
+
+    bool CookedAssetCache::read_blob(
+        const CookedAssetKey& key,
+        uint32 kind,
+        FileView& out_blob,
+        std::string_view& out_payload) const
+    {
+        if (_directory.empty())
+            return false;
+
+        // The file operator is rooted at the cache directory.
+        auto blob = _file_ops.map_file(get_blob_path(key, kind).filename());
+        if (!blob.is_valid())
+            return false;
+
+        const auto data = blob.get_data();
+        auto reader = BlobReader(data);
+        auto magic = std::array<char, 4>();
+        auto version = uint32();
+        auto stored_kind = uint32();
+        auto stored_key = CookedAssetKey();
+        auto payload_size = uint64();
+        if (!reader.read(magic) || magic != CookedBlobMagic || !reader.read(version)
+            || version != CookedBlobVersion || !reader.read(stored_kind) || stored_kind != kind
+            || !reader.read(stored_key.source_hash) || !reader.read(stored_key.parameter_hash)
+            || stored_key != key || !reader.read(payload_size))
+            return false;
+
+        if (payload_size != data.size() - CookedBlobHeaderSize)
+            return false;
+
+        out_payload = data.substr(CookedBlobHeaderSize);
+        out_blob = std::move(blob);
+        return true;
+    }
+
+    Result CookedAssetCache::write_blob(
+        const CookedAssetKey& key,
+        uint32 kind,
+        const std::string& payload) const
+    {
+        if (_directory.empty())
+            return Result(false, "Cooked asset cache has no directory.");
+
+        auto error = std::error_code();
+        std::filesystem::create_directories(_directory, error);
+        if (error)
+        {
+            return Result(
+                false,
+                std::format(
+                    "Failed to create cooked asset directory '{}': {}",
+                    _directory.string(),
+                    error.message()));
+        }
+
+        auto header = BlobWriter();
+        header.write(CookedBlobMagic);
+        header.write(CookedBlobVersion);
+        header.write(kind);
+        header.write(key.source_hash);
+        header.write(key.parameter_hash);
+        header.write(static_cast<uint64>(payload.size()));
+
+        // Workers may cook the same asset at once, so each writes its own temporary file.
+        const auto blob_path = get_blob_path(key, kind);
+        auto temporary_path = blob_path;
+        temporary_path += std::format(
+            ".{:x}.tmp",
+            std::hash<std::thread::id>()(std::this_thread::get_id()));
+        {
+            auto stream = std::ofstream(temporary_path, std::ios::binary | std::ios::trunc);
+            const auto& header_data = header.get_data();
+            stream.write(header_data.data(), static_cast<std::streamsize>(header_data.size()));
+            stream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+            if (!stream)
+            {
+                stream.close();
+                std::filesystem::remove(temporary_path, error);
+                return Result(
+                    false,
+                    std::format("Failed to write cooked asset '{}'.", blob_path.string()));
+            }
+        }
+
+        std::filesystem::rename(temporary_path, blob_path, error);
+        if (error)
+        {
+            std::filesystem::remove(temporary_path, error);
+            return Result(
+                false,
+                std::format("Failed to publish cooked asset '{}'.", blob_path.string()));
+        }
+
+        return {};
+    }
+}
@@ -1,15 +1,20 @@
 #include "tbx/assets/manager.h"
 #include "tbx/assets/events.h"
+#include "tbx/async/job_system.h"
 #include "tbx/common/handle.h"
 #include "tbx/common/result.h"
 #include "tbx/files/tests/in_memory_file_ops.h"
 #include "tbx/messages/dispatcher.h"
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <filesystem>
+#include <format>
+#include <functional>
 #include <future>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 namespace tbx
@@ -35,6 +40,7 @@ namespace tbx
         bool use_async = false;
         std::shared_ptr<TestAsset> asset;
         std::shared_ptr<std::promise<Result>> completion;
+        std::function<void(const std::filesystem::path&)> on_sync_load;
     };
 
     static TestAssetLoaderState& get_test_asset_loader_state()
@@ -53,6 +59,7 @@ namespace tbx
         state.use_async = false;
         state.asset.reset();
         state.completion.reset();
+        state.on_sync_load = {};
     }
 
     template <>
@@ -88,7 +95,7 @@ namespace tbx
         }
 
         static std::shared_ptr<TestAsset> load(
-            const std::filesystem::path&,
+            const std::filesystem::path& asset_path,
             const Parameters& parameters = {})
         {
             auto& state = get_test_asset_loader_state();
@@ -96,9 +103,131 @@ namespace tbx
             asset->value = parameters.value;
             state.sync_load_count += 1;
             state.last_sync_parameters = parameters;
+            if (state.on_sync_load)
+                state.on_sync_load(asset_path);
             return asset;
         }
     };
+
+    struct DecodedTestAsset
+    {
+        int value = 0;
+    };
+
+    template <>
+    struct AssetLoader<DecodedTestAsset>
+    {
+        using Parameters = TestAssetLoadParameters;
+
+        static AssetPromise<DecodedTestAsset> load_async(
+            const std::filesystem::path&,
+            const Parameters& = {})
+        {
+            return {};
+        }
+
+        static std::shared_ptr<DecodedTestAsset> load(
+            const std::filesystem::path&,
+            const Parameters& = {})
+        {
+            return {};
+        }
+
+        static std::shared_ptr<DecodedTestAsset> create_fallback(const Parameters& = {})
+        {
+            return std::make_shared<DecodedTestAsset>();
+        }
+
+        static Result decode(
+            const std::filesystem::path&,
+            const Parameters& parameters,
+            DecodedTestAsset& out_asset)
+        {
+            out_asset.value = parameters.value;
+            return {};
+        }
+    };
+
+    struct DependentTestAsset
+    {
+        std::vector<Handle> textures = {};
+    };
+
+    template <>
+    struct AssetLoader<DependentTestAsset>
+    {
+        using Parameters = DefaultAssetLoadParameters;
+
+        static AssetPromise<DependentTestAsset> load_async(
+            const std::filesystem::path&,
+            const Parameters& = {})
+        {
+            auto completion = std::promise<Result>();
+            completion.set_value({});
+            return {
+                .asset = load({}),
+                .promise = completion.get_future().share(),
+            };
+        }
+
+        static std::shared_ptr<DependentTestAsset> load(
+            const std::filesystem::path&,
+            const Parameters& = {})
+        {
+            auto asset = std::make_shared<DependentTestAsset>();
+            asset->textures = {Handle("shared.png"), Handle("shared.png")};
+            return asset;
+        }
+
+        static AssetDependencies get_dependencies(const DependentTestAsset& asset)
+        {
+            return {.textures = asset.textures};
+        }
+    };
+
+    struct DecodedDependentTestAsset
+    {
+        std::vector<Handle> textures = {};
+    };
+
+    template <>
+    struct AssetLoader<DecodedDependentTestAsset>
+    {
+        using Parameters = DefaultAssetLoadParameters;
+
+        static AssetPromise<DecodedDependentTestAsset> load_async(
+            const std::filesystem::path&,
+            const Parameters& = {})
+        {
+            return {};
+        }
+
+        static std::shared_ptr<DecodedDependentTestAsset> load(
+            const std::filesystem::path&,
+            const Parameters& = {})
+        {
+            return {};
+        }
+
+        static std::shared_ptr<DecodedDependentTestAsset> create_fallback(const Parameters& = {})
+        {
+            return std::make_shared<DecodedDependentTestAsset>();
+        }
+
+        static Result decode(
+            const std::filesystem::path&,
+            const Parameters&,
+            DecodedDependentTestAsset& out_asset)
+        {
+            out_asset.textures = {Handle("decoded.png")};
+            return {};
+        }
+
+        static AssetDependencies get_dependencies(const DecodedDependentTestAsset& asset)
+        {
+            return {.textures = asset.textures};
+        }
+    };
 }
 
 namespace tbx::tests::assets
@@ -476,6 +605,53 @@ namespace tbx::tests::assets
         EXPECT_TRUE(manager.unload<TestAsset>(handle));
     }
 
+    TEST(asset_manager, coalesces_concurrent_loads_of_the_same_asset)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+        Handle handle("shared.asset");
+        reset_test_asset_loader_state();
+        auto started = std::promise<void>();
+        auto release = std::promise<void>();
+        auto released = release.get_future().share();
+        get_test_asset_loader_state().on_sync_load =
+            [&started, released](const std::filesystem::path& asset_path)
+        {
+            if (asset_path.filename() != "shared.asset")
+                return;
+
+            started.set_value();
+            released.wait();
+        };
+
+        // Act
+        auto first = std::shared_ptr<TestAsset>();
+        auto second = std::shared_ptr<TestAsset>();
+        auto first_loader = std::thread(
+            [&]()
+            {
+                first = manager.load<TestAsset>(handle);
+            });
+        started.get_future().wait();
+        auto second_loader = std::thread(
+            [&]()
+            {
+                second = manager.load<TestAsset>(handle);
+            });
+        const auto other = manager.load<TestAsset>(Handle("other.asset"));
+        release.set_value();
+        first_loader.join();
+        second_loader.join();
+
+        // Assert
+        ASSERT_NE(first, nullptr);
+        EXPECT_EQ(first, second);
+        EXPECT_NE(other, nullptr);
+        EXPECT_EQ(get_test_asset_loader_state().sync_load_count, 2);
+        EXPECT_EQ(manager.get_usage<TestAsset>(handle).stream_state, AssetStreamState::LOADED);
+    }
+
     TEST(asset_manager, forwards_async_load_parameters)
     {
         // Arrange
@@ -524,6 +700,134 @@ namespace tbx::tests::assets
         EXPECT_EQ(streamed_in.asset->value, 99);
     }
 
+    TEST(asset_manager, decodes_async_on_job_workers_and_publishes_on_caller)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        CapturingAssetEventDispatcher dispatcher;
+        AssetManager manager = make_manager(&dispatcher, working_directory);
+        JobSystem job_system = JobSystem(JobSystemConfiguration {.worker_count = 2});
+        manager.set_job_system(&job_system);
+        Handle handle("decoded.asset");
+
+        // Act
+        auto streamed_in = manager.load_async<DecodedTestAsset>(handle, {.value = 17});
+        job_system.wait_for_idle();
+        const auto value_before_publish = streamed_in.asset->value;
+        const auto usage_before_publish = manager.get_usage<DecodedTestAsset>(handle);
+        const auto published_count = manager.publish_decoded_assets();
+        auto published = manager.load_async<DecodedTestAsset>(handle, {.value = 17});
+
+        // Assert
+        EXPECT_EQ(value_before_publish, 0);
+        EXPECT_EQ(usage_before_publish.stream_state, AssetStreamState::LOADING);
+        EXPECT_EQ(published_count, 1U);
+        ASSERT_EQ(streamed_in.promise.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        EXPECT_TRUE(streamed_in.promise.get());
+        EXPECT_EQ(streamed_in.asset->value, 0);
+        ASSERT_NE(published.asset, nullptr);
+        EXPECT_NE(published.asset, streamed_in.asset);
+        EXPECT_EQ(published.asset->value, 17);
+        EXPECT_EQ(
+            manager.get_usage<DecodedTestAsset>(handle).stream_state,
+            AssetStreamState::LOADED);
+        const auto reloaded_events = dispatcher.get_reloaded_events();
+        ASSERT_EQ(reloaded_events.size(), 1U);
+        EXPECT_EQ(
+            reloaded_events[0].affected_asset.get_name(),
+            (working_directory / "decoded.asset").generic_string());
+    }
+
+    TEST(asset_manager, preloads_dependencies_once_per_batch)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+
+        // Act
+        auto preload = manager.preload<DependentTestAsset>(
+            {Handle("first.asset"), Handle("second.asset"), Handle("first.asset")});
+        const auto queued_progress = preload.get_progress();
+        const auto finished_count = manager.advance_preloads();
+        const auto progress = preload.get_progress();
+
+        // Assert
+        EXPECT_EQ(queued_progress.discovered_count, 2U);
+        EXPECT_EQ(finished_count, 3U);
+        EXPECT_EQ(progress.discovered_count, 3U);
+        EXPECT_EQ(progress.finished_count, 3U);
+        EXPECT_EQ(progress.failed_count, 1U);
+        ASSERT_TRUE(preload.is_complete());
+        EXPECT_FALSE(preload.get_completion().get());
+        EXPECT_EQ(manager.advance_preloads(), 0U);
+    }
+
+    TEST(asset_manager, preloaded_assets_survive_collection_until_released)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+        Handle handle("preloaded.asset");
+        reset_test_asset_loader_state();
+        auto preload = manager.preload<TestAsset>({handle});
+        manager.advance_preloads();
+        ASSERT_TRUE(preload.is_complete());
+
+        auto settings = AssetCollectionSettings {
+            .max_records_per_step = 1024U,
+            .min_idle_time = std::chrono::milliseconds(0),
+        };
+
+        // Act
+        const auto held_stats = manager.collect_unreferenced(settings);
+        const auto held_state = manager.get_usage<TestAsset>(handle).stream_state;
+        preload = {};
+        const auto released_stats = manager.collect_unreferenced(settings);
+
+        // Assert
+        EXPECT_EQ(held_stats.unloaded_count, 0U);
+        EXPECT_EQ(held_state, AssetStreamState::LOADED);
+        EXPECT_EQ(released_stats.unloaded_count, 1U);
+        EXPECT_EQ(
+            manager.get_usage<TestAsset>(handle).stream_state,
+            AssetStreamState::UNLOADED);
+    }
+
+    TEST(asset_manager, preload_follows_and_holds_assets_decoded_on_job_workers)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+        JobSystem job_system = JobSystem(JobSystemConfiguration {.worker_count = 2});
+        manager.set_job_system(&job_system);
+        Handle handle("decoded_dependent.asset");
+        auto settings = AssetCollectionSettings {
+            .max_records_per_step = 1024U,
+            .min_idle_time = std::chrono::milliseconds(0),
+        };
+
+        // Act
+        auto preload = manager.preload<DecodedDependentTestAsset>({handle});
+        while (!preload.is_complete())
+        {
+            job_system.wait_for_idle();
+            manager.publish_decoded_assets();
+            manager.advance_preloads();
+        }
+        const auto progress = preload.get_progress();
+        manager.collect_unreferenced(settings);
+        const auto held_state = manager.get_usage<DecodedDependentTestAsset>(handle).stream_state;
+        preload = {};
+        manager.collect_unreferenced(settings);
+
+        // Assert
+        EXPECT_EQ(progress.discovered_count, 2U);
+        EXPECT_EQ(held_state, AssetStreamState::LOADED);
+        EXPECT_EQ(
+            manager.get_usage<DecodedDependentTestAsset>(handle).stream_state,
+            AssetStreamState::UNLOADED);
+    }
+
     TEST(asset_manager, unloads_unreferenced_assets)
     {
         // Arrange
@@ -560,6 +864,148 @@ namespace tbx::tests::assets
         EXPECT_EQ(keep_usage_after.ref_count, 0U);
     }
 
+    TEST(asset_manager, collects_unreferenced_assets_incrementally)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+        Handle keep_handle("keep.asset");
+        reset_test_asset_loader_state();
+        auto keep_asset = manager.load<TestAsset>(keep_handle);
+        for (const auto* name : {"drop_a.asset", "drop_b.asset", "drop_c.asset", "drop_d.asset"})
+            ASSERT_NE(manager.load<TestAsset>(Handle(name)), nullptr);
+
+        auto settings = AssetCollectionSettings {
+            .max_records_per_step = 1U,
+            .time_budget = std::chrono::microseconds(0),
+            .min_idle_time = std::chrono::milliseconds(0),
+        };
+
+        // Act
+        uint step_count = 0U;
+        uint unloaded_count = 0U;
+        auto stats = AssetCollectionStats {};
+        do
+        {
+            stats = manager.collect_unreferenced(settings);
+            unloaded_count += stats.unloaded_count;
+            ++step_count;
+        } while (!stats.has_completed_pass && step_count < 1000U);
+
+        // Assert
+        EXPECT_TRUE(stats.has_completed_pass);
+        EXPECT_GT(step_count, 1U);
+        EXPECT_EQ(unloaded_count, 4U);
+        EXPECT_EQ(manager.get_usage<TestAsset>(keep_handle).stream_state, AssetStreamState::LOADED);
+        EXPECT_EQ(
+            manager.get_usage<TestAsset>(Handle("drop_a.asset")).stream_state,
+            AssetStreamState::UNLOADED);
+    }
+
+    TEST(asset_manager, collection_step_examines_at_most_the_record_limit)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+        reset_test_asset_loader_state();
+        constexpr uint AssetCount = 40U;
+        for (uint asset_index = 0U; asset_index < AssetCount; ++asset_index)
+        {
+            const auto name = std::format("bounded_{}.asset", asset_index);
+            ASSERT_NE(manager.load<TestAsset>(Handle(name)), nullptr);
+        }
+
+        auto settings = AssetCollectionSettings {
+            .max_records_per_step = 2U,
+            .time_budget = std::chrono::microseconds(0),
+            .min_idle_time = std::chrono::milliseconds(0),
+        };
+
+        // Act
+        uint step_count = 0U;
+        uint unloaded_count = 0U;
+        uint max_examined_count = 0U;
+        auto stats = AssetCollectionStats {};
+        do
+        {
+            stats = manager.collect_unreferenced(settings);
+            unloaded_count += stats.unloaded_count;
+            max_examined_count = std::max(max_examined_count, stats.examined_count);
+            ++step_count;
+        } while (!stats.has_completed_pass && step_count < 1000U);
+
+        // Assert
+        EXPECT_TRUE(stats.has_completed_pass);
+        EXPECT_LE(max_examined_count, 2U);
+        EXPECT_EQ(unloaded_count, AssetCount);
+    }
+
+    TEST(asset_manager, collection_keeps_recently_used_assets)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+        Handle handle("recent.asset");
+        reset_test_asset_loader_state();
+        ASSERT_NE(manager.load<TestAsset>(handle), nullptr);
+
+        auto settings = AssetCollectionSettings {
+            .max_records_per_step = 1024U,
+            .min_idle_time = std::chrono::hours(1),
+        };
+
+        // Act
+        const auto stats = manager.collect_unreferenced(settings);
+
+        // Assert
+        EXPECT_TRUE(stats.has_completed_pass);
+        EXPECT_EQ(stats.examined_count, 1U);
+        EXPECT_EQ(stats.unloaded_count, 0U);
+        EXPECT_EQ(manager.get_usage<TestAsset>(handle).stream_state, AssetStreamState::LOADED);
+    }
+
+    TEST(asset_manager, memory_budget_evicts_least_recently_used_assets)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        AssetManager manager = make_manager(nullptr, working_directory);
+        reset_test_asset_loader_state();
+        auto referenced = manager.load<TestAsset>(Handle("referenced.asset"));
+        for (const auto* name : {"oldest.asset", "older.asset", "newest.asset"})
+            ASSERT_NE(manager.load<TestAsset>(Handle(name)), nullptr);
+
+        auto settings = AssetCollectionSettings {
+            .max_records_per_step = 1024U,
+            .min_idle_time = std::chrono::hours(1),
+            .budget_min_idle_time = std::chrono::milliseconds(0),
+        };
+        settings.set_memory_budget<TestAsset>(2U * sizeof(TestAsset));
+
+        // Act
+        const auto stats = manager.collect_unreferenced(settings);
+        const auto usage = manager.get_memory_usage();
+
+        // Assert
+        EXPECT_EQ(stats.unloaded_count, 0U);
+        EXPECT_EQ(stats.evicted_count, 2U);
+        EXPECT_EQ(
+            manager.get_usage<TestAsset>(Handle("referenced.asset")).stream_state,
+            AssetStreamState::LOADED);
+        EXPECT_EQ(
+            manager.get_usage<TestAsset>(Handle("oldest.asset")).stream_state,
+            AssetStreamState::UNLOADED);
+        EXPECT_EQ(
+            manager.get_usage<TestAsset>(Handle("older.asset")).stream_state,
+            AssetStreamState::UNLOADED);
+        EXPECT_EQ(
+            manager.get_usage<TestAsset>(Handle("newest.asset")).stream_state,
+            AssetStreamState::LOADED);
+        ASSERT_EQ(usage.size(), 1U);
+        EXPECT_EQ(usage.front().resident_bytes, 2U * sizeof(TestAsset));
+        EXPECT_EQ(usage.front().budget_bytes, 2U * sizeof(TestAsset));
+        EXPECT_EQ(usage.front().evicted_count, 2U);
+    }
+
     TEST(asset_manager, resolves_asset_id_from_handle_source)
     {
         // Arrange
@@ -733,6 +1179,132 @@ namespace tbx::tests::assets
         EXPECT_EQ(serializer_state->write_count, 0);
     }
 
+    TEST(asset_manager, registry_index_skips_unchanged_meta_files)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        auto file_ops = std::make_shared<InMemoryFileOps>(working_directory);
+        file_ops->write_file("content/rock.asset", FileDataFormat::UTF8_TEXT, "rock");
+        file_ops->write_file("content/rock.asset.meta", FileDataFormat::UTF8_TEXT, "{}");
+        file_ops->write_file("content/tree.asset", FileDataFormat::UTF8_TEXT, "tree");
+        file_ops->write_file("content/tree.asset.meta", FileDataFormat::UTF8_TEXT, "{}");
+        auto serializer_state = std::make_shared<TrackingHandleSerializerState>();
+        serializer_state->stored_handles[working_directory / "content" / "rock.asset"] =
+            Handle(Uuid(0x3U));
+        serializer_state->stored_handles[working_directory / "content" / "tree.asset"] =
+            Handle(Uuid(0x4U));
+        auto make_indexed_manager = [&]()
+        {
+            auto manager = std::make_unique<AssetManager>(
+                nullptr,
+                working_directory,
+                std::vector<std::filesystem::path> {},
+                HandleSource {},
+                std::make_unique<TrackingHandleSerializer>(serializer_state),
+                file_ops);
+            manager->load_registry_index("cache/asset_registry.index");
+            manager->add_directory("content");
+            return manager;
+        };
+
+        // Act
+        const auto first_save_result = make_indexed_manager()->save_registry_index();
+        const auto cold_read_count = serializer_state->read_count;
+        file_ops->touch(
+            "content/tree.asset.meta",
+            std::filesystem::file_time_type::clock::now() + std::chrono::seconds(1));
+        serializer_state->stored_handles[working_directory / "content" / "tree.asset"] =
+            Handle(Uuid(0x5U));
+        auto warm_manager = make_indexed_manager();
+        const auto warm_read_count = serializer_state->read_count - cold_read_count;
+
+        // Assert
+        ASSERT_TRUE(first_save_result) << first_save_result.get_report();
+        EXPECT_EQ(cold_read_count, 2);
+        EXPECT_EQ(warm_read_count, 1);
+        EXPECT_EQ(warm_manager->resolve(Handle("rock.asset")), Uuid(0x3U));
+        EXPECT_EQ(warm_manager->resolve(Handle("tree.asset")), Uuid(0x5U));
+    }
+
+    TEST(asset_manager, registry_index_reparses_meta_files_whose_size_changed)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        auto file_ops = std::make_shared<InMemoryFileOps>(working_directory);
+        const auto meta_write_time = std::filesystem::file_time_type::clock::now();
+        file_ops->write_file_entry("content/rock.asset", "rock", meta_write_time);
+        file_ops->write_file_entry("content/rock.asset.meta", "{}", meta_write_time);
+        auto serializer_state = std::make_shared<TrackingHandleSerializerState>();
+        serializer_state->stored_handles[working_directory / "content" / "rock.asset"] =
+            Handle(Uuid(0x6U));
+        auto make_indexed_manager = [&]()
+        {
+            auto manager = std::make_unique<AssetManager>(
+                nullptr,
+                working_directory,
+                std::vector<std::filesystem::path> {},
+                HandleSource {},
+                std::make_unique<TrackingHandleSerializer>(serializer_state),
+                file_ops);
+            manager->load_registry_index("cache/asset_registry.index");
+            manager->add_directory("content");
+            return manager;
+        };
+
+        // Act
+        const auto first_save_result = make_indexed_manager()->save_registry_index();
+        const auto cold_read_count = serializer_state->read_count;
+        file_ops->write_file_entry(
+            "content/rock.asset.meta",
+            "{ \"id\": \"7\" }",
+            meta_write_time);
+        serializer_state->stored_handles[working_directory / "content" / "rock.asset"] =
+            Handle(Uuid(0x7U));
+        auto warm_manager = make_indexed_manager();
+        const auto warm_read_count = serializer_state->read_count - cold_read_count;
+
+        // Assert
+        ASSERT_TRUE(first_save_result) << first_save_result.get_report();
+        EXPECT_EQ(cold_read_count, 1);
+        EXPECT_EQ(warm_read_count, 1);
+        EXPECT_EQ(warm_manager->resolve(Handle("rock.asset")), Uuid(0x7U));
+    }
+
+    TEST(asset_manager, scans_directories_on_job_workers_in_path_order)
+    {
+        // Arrange
+        std::filesystem::path working_directory = "/virtual/asset_manager";
+        auto file_ops = std::make_shared<InMemoryFileOps>(working_directory);
+        for (uint32 index = 0U; index < 40U; ++index)
+        {
+            const auto asset_path = std::format("content/asset_{:02}.asset", index);
+            file_ops->write_file(asset_path, FileDataFormat::UTF8_TEXT, "asset");
+            file_ops->write_file(
+                asset_path + ".meta",
+                FileDataFormat::UTF8_TEXT,
+                std::format("{{ \"id\": \"{:x}\" }}\n", 0x100U + index));
+        }
+        file_ops->write_file("content/zz_copy.asset", FileDataFormat::UTF8_TEXT, "copy");
+        file_ops->write_file(
+            "content/zz_copy.asset.meta",
+            FileDataFormat::UTF8_TEXT,
+            "{ \"id\": \"100\" }\n");
+        JobSystem job_system = JobSystem(JobSystemConfiguration {.worker_count = 2});
+        AssetManager manager(nullptr, working_directory, {}, {}, {}, file_ops);
+        manager.set_job_system(&job_system);
+
+        // Act
+        manager.add_directory("content");
+
+        // Assert
+        for (uint32 index = 0U; index < 40U; ++index)
+        {
+            const auto asset_path = std::format("asset_{:02}.asset", index);
+            EXPECT_EQ(manager.resolve(Handle(asset_path)), Uuid(0x100U + index)) << asset_path;
+        }
+        EXPECT_NE(manager.resolve(Handle("zz_copy.asset")), Uuid(0x100U));
+    }
+
     TEST(asset_manager, unloads_all_assets)
     {
         // Arrange
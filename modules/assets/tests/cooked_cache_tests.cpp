@@ -0,0 +1,99 @@
+#include "pch.h"
+#include "tbx/assets/cooked_cache.h"
+#include <filesystem>
+
+namespace tbx::tests::assets
+{
+    static std::filesystem::path make_cache_directory(const char* name)
+    {
+        const auto directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        return directory;
+    }
+
+    TEST(cooked_asset_cache, round_trips_textures_and_misses_on_changed_source)
+    {
+        // Arrange
+        const auto directory = make_cache_directory("tbx_cooked_cache_texture_tests");
+        const auto cache = CookedAssetCache(directory);
+        const auto key = CookedAssetCache::make_key("png bytes", "rgba");
+        auto texture = Texture(
+            {2U, 1U},
+            TextureWrap::CLAMP_TO_EDGE,
+            TextureFilter::NEAREST,
+            TextureFormat::RGBA,
+            TextureMipmaps::DISABLED,
+            TextureCompression::DISABLED,
+            {1, 2, 3, 4, 5, 6, 7, 8});
+
+        // Act
+        const auto write_result = cache.write(key, texture);
+        auto cooked = Texture();
+        const auto was_read = cache.try_read(key, cooked);
+        auto stale = Texture();
+        const auto was_stale_read =
+            cache.try_read(CookedAssetCache::make_key("edited png bytes", "rgba"), stale);
+
+        // Assert
+        ASSERT_TRUE(write_result) << write_result.get_report();
+        ASSERT_TRUE(was_read);
+        EXPECT_EQ(cooked.resolution.width, 2U);
+        EXPECT_EQ(cooked.wrap, TextureWrap::CLAMP_TO_EDGE);
+        EXPECT_EQ(cooked.format, TextureFormat::RGBA);
+        EXPECT_EQ(cooked.pixels, texture.pixels);
+        EXPECT_FALSE(was_stale_read);
+
+        std::filesystem::remove_all(directory);
+    }
+
+    TEST(cooked_asset_cache, round_trips_models_with_materials)
+    {
+        // Arrange
+        const auto directory = make_cache_directory("tbx_cooked_cache_model_tests");
+        const auto cache = CookedAssetCache(directory);
+        const auto key = CookedAssetCache::make_key("fbx bytes");
+        auto material = Material();
+        material.program.vertex = Handle("shaders/lit.vert");
+        material.parameters.set("color", Color(0.5F, 0.25F, 1.0F, 1.0F));
+        material.parameters.set("roughness", 0.75F);
+        material.textures.set("diffuse", Handle("textures/crate.png"));
+        material.config.is_two_sided = true;
+        auto model = Model();
+        model.meshes = {make_quad()};
+        model.materials = {material};
+        model.parts = {ModelPart {.transform = Mat4(2.0F), .children = {0U}}};
+
+        // Act
+        const auto write_result = cache.write(key, model);
+        auto cooked = Model();
+        const auto was_read = cache.try_read(key, cooked);
+        auto as_material = Material();
+        const auto was_read_as_material = cache.try_read(key, as_material);
+
+        // Assert
+        ASSERT_TRUE(write_result) << write_result.get_report();
+        ASSERT_TRUE(was_read);
+        ASSERT_EQ(cooked.meshes.size(), 1U);
+        EXPECT_EQ(cooked.meshes[0].vertices.vertices, model.meshes[0].vertices.vertices);
+        EXPECT_EQ(cooked.meshes[0].vertices.layout.stride, model.meshes[0].vertices.layout.stride);
+        EXPECT_EQ(cooked.meshes[0].indices, model.meshes[0].indices);
+        ASSERT_EQ(cooked.materials.size(), 1U);
+        EXPECT_EQ(cooked.materials[0].program.vertex.get_name(), "shaders/lit.vert");
+        EXPECT_EQ(cooked.materials[0].program.vertex.get_id(), material.program.vertex.get_id());
+        ASSERT_NE(cooked.materials[0].parameters.get("roughness"), nullptr);
+        EXPECT_FLOAT_EQ(
+            std::get<float>(cooked.materials[0].parameters.get("roughness")->data),
+            0.75F);
+        ASSERT_NE(cooked.materials[0].textures.get("diffuse"), nullptr);
+        EXPECT_EQ(
+            cooked.materials[0].textures.get("diffuse")->texture.handle.get_name(),
+            "textures/crate.png");
+        EXPECT_TRUE(cooked.materials[0].config.is_two_sided);
+        ASSERT_EQ(cooked.parts.size(), 1U);
+        EXPECT_EQ(cooked.parts[0].transform, Mat4(2.0F));
+        EXPECT_EQ(cooked.parts[0].children, std::vector<uint32>({0U}));
+        EXPECT_FALSE(was_read_as_material);
+
+        std::filesystem::remove_all(directory);
+    }
+}
@@ -0,0 +1,145 @@
+#include "tbx/assets/manager.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures how AssetManager::load scales when several threads hit it at once:
+//   TbxAssetContentionBench [thread-count] [loads-per-thread]
+// A cold race loads every handle from all threads and reports how many decodes ran, then repeated
+// loads of the resident handles are timed from one thread and from `thread-count` threads. The
+// tool only uses the public load API, so build it at two revisions to compare locking changes.
+namespace tbx
+{
+    constexpr uint ContentionHandleCount = 64U;
+    constexpr auto ContentionDecodeTime = std::chrono::microseconds(200);
+
+    struct ContentionBenchAsset
+    {
+        uint value = 0U;
+    };
+
+    std::atomic<uint> contention_decode_count = 0U;
+
+    // Stands in for a file loader; the sleep approximates a decode so cold races are visible.
+    template <>
+    struct AssetLoader<ContentionBenchAsset>
+    {
+        using Parameters = DefaultAssetLoadParameters;
+
+        static AssetPromise<ContentionBenchAsset> load_async(
+            const std::filesystem::path& asset_path,
+            const Parameters& parameters = {})
+        {
+            auto completion = std::promise<Result>();
+            auto promise = AssetPromise<ContentionBenchAsset> {
+                .asset = load(asset_path, parameters),
+                .promise = completion.get_future().share(),
+            };
+            completion.set_value({});
+            return promise;
+        }
+
+        static std::shared_ptr<ContentionBenchAsset> load(
+            const std::filesystem::path&,
+            const Parameters& = {})
+        {
+            contention_decode_count.fetch_add(1U);
+            std::this_thread::sleep_for(ContentionDecodeTime);
+            return std::make_shared<ContentionBenchAsset>();
+        }
+    };
+
+    // Returns the average wall time of one load while `thread_count` threads load concurrently.
+    static double measure_load_time(
+        AssetManager& manager,
+        const std::vector<Handle>& handles,
+        const uint thread_count,
+        const uint loads_per_thread)
+    {
+        auto threads = std::vector<std::thread>();
+        threads.reserve(thread_count);
+        const auto start = std::chrono::steady_clock::now();
+        for (uint thread_index = 0U; thread_index < thread_count; ++thread_index)
+        {
+            threads.emplace_back(
+                [&manager, &handles, thread_index, loads_per_thread]()
+                {
+                    for (uint load_index = 0U; load_index < loads_per_thread; ++load_index)
+                    {
+                        const auto& handle = handles[(load_index + thread_index) % handles.size()];
+                        manager.load<ContentionBenchAsset>(handle);
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        const auto elapsed = std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start);
+        return elapsed.count() / (static_cast<double>(loads_per_thread) * thread_count);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 3)
+    {
+        std::cerr << "Usage: TbxAssetContentionBench [thread-count] [loads-per-thread]\n";
+        return 2;
+    }
+
+    const auto thread_count = argc > 1 ? static_cast<uint>(std::stoul(argv[1])) : 4U;
+    const auto loads_per_thread = argc > 2 ? static_cast<uint>(std::stoul(argv[2])) : 200000U;
+    if (thread_count == 0U || loads_per_thread == 0U)
+    {
+        std::cerr << "Thread count and loads per thread must be greater than zero.\n";
+        return 2;
+    }
+
+    const auto working_directory =
+        std::filesystem::temp_directory_path() / "tbx_asset_contention_bench";
+    std::filesystem::create_directories(working_directory);
+    auto handles = std::vector<tbx::Handle>();
+    handles.reserve(tbx::ContentionHandleCount);
+    for (uint handle_index = 0U; handle_index < tbx::ContentionHandleCount; ++handle_index)
+    {
+        const auto asset_name = "asset_" + std::to_string(handle_index) + ".bench";
+        std::ofstream(working_directory / asset_name) << handle_index;
+        handles.emplace_back(asset_name);
+    }
+
+    {
+        auto manager = tbx::AssetManager(nullptr, working_directory);
+        auto racers = std::vector<std::thread>();
+        for (uint thread_index = 0U; thread_index < thread_count; ++thread_index)
+        {
+            racers.emplace_back(
+                [&manager, &handles]()
+                {
+                    for (const auto& handle : handles)
+                        manager.load<tbx::ContentionBenchAsset>(handle);
+                });
+        }
+
+        for (auto& racer : racers)
+            racer.join();
+
+        std::cout << "Cold race: " << tbx::contention_decode_count.load() << " decodes for "
+                  << handles.size() << " handles across " << thread_count << " threads\n";
+        std::cout << "Resident loads, 1 thread: "
+                  << tbx::measure_load_time(manager, handles, 1U, loads_per_thread)
+                  << " ns/load\n";
+        std::cout << "Resident loads, " << thread_count << " threads: "
+                  << tbx::measure_load_time(manager, handles, thread_count, loads_per_thread)
+                  << " ns/load\n";
+    }
+
+    std::filesystem::remove_all(working_directory);
+    return 0;
+}
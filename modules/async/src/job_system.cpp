@@ -1,4 +1,5 @@
 #include "tbx/async/job_system.h"
+#include "tbx/profiling/macros.h"
 #include <stdexcept>
 
 namespace tbx
@@ -102,6 +103,7 @@ namespace tbx
 
     void JobSystem::run_worker(std::stop_token stop_token)
     {
+        TBX_PROFILE_THREAD("job worker");
         while (true)
         {
             Job job = {};
@@ -1,4 +1,5 @@
 #include "tbx/async/thread_manager.h"
+#include "tbx/profiling/macros.h"
 #include <stdexcept>
 #include <vector>
 
@@ -137,6 +138,7 @@ namespace tbx
 
     void ThreadManager::ThreadLane::run(std::stop_token stop_token)
     {
+        TBX_PROFILE_THREAD(_name);
         while (true)
         {
             auto task = Task {};
@@ -1,10 +1,16 @@
 #pragma once
 #include "tbx/tbx_api.h"
-#include <memory>
 #include <string>
 
 namespace tbx
 {
+    /// @brief
+    /// Purpose: Reports whether an operation succeeded, with an optional human readable report.
+    /// @details
+    /// Ownership: Value type. The status is stored inline and the report only allocates once it
+    /// outgrows the string's small buffer, so successful results with no report never allocate.
+    /// Copies are independent; share a result across threads through a future instead.
+    /// Thread Safety: Not thread-safe; synchronize concurrent access externally.
     class TBX_API Result
     {
       public:
@@ -29,7 +35,8 @@ namespace tbx
         }
 
       private:
-        std::shared_ptr<bool> _success;
-        std::shared_ptr<std::string> _report;
+        // Mutable so handlers can flag results on messages they only see through const references.
+        mutable bool _success = true;
+        mutable std::string _report = {};
     };
 }
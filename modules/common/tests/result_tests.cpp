@@ -0,0 +1,43 @@
+#include "pch.h"
+#include "tbx/common/result.h"
+#include <string>
+
+namespace tbx::tests::common
+{
+    TEST(ResultTests, DefaultsToSuccessWithEmptyReport)
+    {
+        const Result result = {};
+
+        EXPECT_TRUE(result.succeeded());
+        EXPECT_TRUE(static_cast<bool>(result));
+        EXPECT_TRUE(result.get_report().empty());
+    }
+
+    TEST(ResultTests, FlagsFailureWithReport)
+    {
+        const Result result = {};
+
+        result.flag_failure("Something went wrong.");
+
+        EXPECT_FALSE(result.succeeded());
+        EXPECT_EQ(result.get_report(), "Something went wrong.");
+
+        result.flag_success();
+
+        EXPECT_TRUE(result.succeeded());
+        EXPECT_TRUE(result.get_report().empty());
+    }
+
+    TEST(ResultTests, CopiesAreIndependent)
+    {
+        const Result original = Result(false, "original");
+        const Result copy = original;
+
+        copy.flag_success("copy");
+
+        EXPECT_FALSE(original.succeeded());
+        EXPECT_EQ(original.get_report(), "original");
+        EXPECT_TRUE(copy.succeeded());
+        EXPECT_EQ(copy.get_report(), "copy");
+    }
+}
@@ -87,6 +87,16 @@ namespace tbx
     /// Transform components are authored and stored in local space.
     TBX_API Transform get_world_space_transform(const Entity& entity);
 
+    /// @brief
+    /// Purpose: Resolves an entity transform in world space, blending entities and parents that
+    /// carry a TransformInterpolation component between their last two fixed-step states.
+    /// @details
+    /// Ownership: Returns an owned Transform value snapshot.
+    /// Thread Safety: Not thread-safe; synchronize external concurrent access. Notes:
+    /// `interpolation_alpha` is the fraction of a fixed step elapsed since the last one ran.
+    TBX_API Transform
+        get_interpolated_world_space_transform(const Entity& entity, float interpolation_alpha);
+
     /// @brief
     /// Purpose: RAII wrapper that destroys the wrapped entity on scope exit.
     /// @details
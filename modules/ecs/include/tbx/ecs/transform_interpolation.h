@@ -0,0 +1,49 @@
+#pragma once
+#include "tbx/math/transform.h"
+#include "tbx/tbx_api.h"
+
+namespace tbx
+{
+    class EntityRegistry;
+
+    /// @brief
+    /// Purpose: Opt-in component that keeps the local Transform from the last two fixed steps so
+    /// rendering can blend between them.
+    /// @details
+    /// Ownership: Value component owned by the entity registry.
+    /// Thread Safety: Not thread-safe; written on the main thread around fixed updates.
+    /// Notes: Only entities that also carry a Transform are captured. When the live Transform no
+    /// longer matches `current` (for example after a teleport outside fixed update), rendering
+    /// uses the live value instead of blending.
+    struct TBX_API TransformInterpolation
+    {
+        Transform previous = {};
+        Transform current = {};
+        bool has_history = false;
+    };
+
+    /// @brief
+    /// Purpose: Stores each interpolated entity's live Transform as its previous state.
+    /// @details
+    /// Ownership: Mutates components owned by `registry`.
+    /// Thread Safety: Not thread-safe; call on the main thread before a fixed step runs.
+    TBX_API void capture_previous_transforms(EntityRegistry& registry);
+
+    /// @brief
+    /// Purpose: Stores each interpolated entity's live Transform as its current state.
+    /// @details
+    /// Ownership: Mutates components owned by `registry`.
+    /// Thread Safety: Not thread-safe; call on the main thread after a fixed step runs.
+    TBX_API void capture_current_transforms(EntityRegistry& registry);
+
+    /// @brief
+    /// Purpose: Resolves the local Transform to draw for an entity at a point between fixed steps.
+    /// @details
+    /// Ownership: Returns an owned Transform value.
+    /// Thread Safety: Stateless helper; safe to call concurrently. Notes: Returns `live` unless
+    /// the history is valid and still matches it.
+    TBX_API Transform get_interpolated_transform(
+        const TransformInterpolation& interpolation,
+        const Transform& live,
+        float interpolation_alpha);
+}
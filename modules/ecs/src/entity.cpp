@@ -1,4 +1,5 @@
 #include "tbx/ecs/entity.h"
+#include "tbx/ecs/transform_interpolation.h"
 #include "tbx/common/uuid.h"
 #include "tbx/debugging/macros.h"
 #include <cstddef>
@@ -238,11 +239,14 @@ namespace tbx
         return value;
     }
 
-    Transform get_world_space_transform(const Entity& entity)
+    template <typename TResolveLocal>
+    static Transform resolve_world_space_transform(
+        const Entity& entity,
+        const TResolveLocal& resolve_local)
     {
         auto world_transform = Transform {};
         if (entity.has_component<Transform>())
-            world_transform = entity.get_component<Transform>();
+            world_transform = resolve_local(entity);
 
         auto cursor = entity;
         auto parent = Entity {};
@@ -255,7 +259,7 @@ namespace tbx
 
             if (parent.has_component<Transform>())
             {
-                const auto& parent_transform = parent.get_component<Transform>();
+                const auto parent_transform = resolve_local(parent);
                 world_transform = compose_world_space_transform(parent_transform, world_transform);
             }
 
@@ -266,6 +270,33 @@ namespace tbx
         return world_transform;
     }
 
+    Transform get_world_space_transform(const Entity& entity)
+    {
+        return resolve_world_space_transform(
+            entity,
+            [](const Entity& source)
+            {
+                return source.get_component<Transform>();
+            });
+    }
+
+    Transform get_interpolated_world_space_transform(const Entity& entity, float interpolation_alpha)
+    {
+        return resolve_world_space_transform(
+            entity,
+            [interpolation_alpha](const Entity& source)
+            {
+                const auto& live = source.get_component<Transform>();
+                if (!source.has_component<TransformInterpolation>())
+                    return live;
+
+                return get_interpolated_transform(
+                    source.get_component<TransformInterpolation>(),
+                    live,
+                    interpolation_alpha);
+            });
+    }
+
     EntityScope::EntityScope(Entity& source)
         : entity(source)
     {
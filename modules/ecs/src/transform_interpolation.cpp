@@ -0,0 +1,45 @@
+#include "tbx/ecs/transform_interpolation.h"
+#include "tbx/ecs/entity_registry.h"
+
+namespace tbx
+{
+    static bool is_same_transform(const Transform& left, const Transform& right)
+    {
+        return left.position == right.position && left.rotation == right.rotation
+               && left.scale == right.scale;
+    }
+
+    void capture_previous_transforms(EntityRegistry& registry)
+    {
+        registry.for_each_with<Transform, TransformInterpolation>(
+            [](Entity& entity)
+            {
+                // Starting from the live value also drops history for transforms that were
+                // moved outside fixed update since the last step.
+                auto& interpolation = entity.get_component<TransformInterpolation>();
+                interpolation.previous = entity.get_component<Transform>();
+            });
+    }
+
+    void capture_current_transforms(EntityRegistry& registry)
+    {
+        registry.for_each_with<Transform, TransformInterpolation>(
+            [](Entity& entity)
+            {
+                auto& interpolation = entity.get_component<TransformInterpolation>();
+                interpolation.current = entity.get_component<Transform>();
+                interpolation.has_history = true;
+            });
+    }
+
+    Transform get_interpolated_transform(
+        const TransformInterpolation& interpolation,
+        const Transform& live,
+        float interpolation_alpha)
+    {
+        if (!interpolation.has_history || !is_same_transform(interpolation.current, live))
+            return live;
+
+        return interpolate(interpolation.previous, interpolation.current, interpolation_alpha);
+    }
+}
@@ -0,0 +1,78 @@
+#include "tbx/ecs/entity.h"
+#include "tbx/ecs/transform_interpolation.h"
+
+namespace tbx::tests::ecs
+{
+    // Validates that rendering blends between the transforms captured around a fixed step.
+    TEST(TransformInterpolationTests, FixedStep_BlendsPreviousAndCurrentByAlpha)
+    {
+        // Arrange
+        EntityRegistry ecs = {};
+        auto entity = Entity("Mover", ecs);
+        entity.add_component<Transform>(Vec3(0.0F, 0.0F, 0.0F));
+        entity.add_component<TransformInterpolation>();
+
+        // Act
+        capture_previous_transforms(ecs);
+        entity.get_component<Transform>().position = Vec3(8.0F, 4.0F, 0.0F);
+        capture_current_transforms(ecs);
+        const auto& interpolation = entity.get_component<TransformInterpolation>();
+        const auto& live = entity.get_component<Transform>();
+        const auto at_start = get_interpolated_transform(interpolation, live, 0.0F);
+        const auto at_quarter = get_interpolated_transform(interpolation, live, 0.25F);
+        const auto at_end = get_interpolated_transform(interpolation, live, 1.0F);
+
+        // Assert
+        EXPECT_TRUE(interpolation.has_history);
+        EXPECT_FLOAT_EQ(at_start.position.x, 0.0F);
+        EXPECT_FLOAT_EQ(at_quarter.position.x, 2.0F);
+        EXPECT_FLOAT_EQ(at_quarter.position.y, 1.0F);
+        EXPECT_FLOAT_EQ(at_end.position.x, 8.0F);
+    }
+
+    // Validates that a transform moved outside fixed update is drawn where it is instead of being
+    // blended from stale history, and that the next step blends from the new position.
+    TEST(TransformInterpolationTests, Teleport_SnapsToLiveTransform)
+    {
+        // Arrange
+        EntityRegistry ecs = {};
+        auto entity = Entity("Teleporter", ecs);
+        entity.add_component<Transform>(Vec3(0.0F, 0.0F, 0.0F));
+        entity.add_component<TransformInterpolation>();
+        capture_previous_transforms(ecs);
+        entity.get_component<Transform>().position = Vec3(2.0F, 0.0F, 0.0F);
+        capture_current_transforms(ecs);
+
+        // Act
+        entity.get_component<Transform>().position = Vec3(100.0F, 0.0F, 0.0F);
+        const auto after_teleport = get_interpolated_transform(
+            entity.get_component<TransformInterpolation>(),
+            entity.get_component<Transform>(),
+            0.5F);
+        capture_previous_transforms(ecs);
+        entity.get_component<Transform>().position = Vec3(104.0F, 0.0F, 0.0F);
+        capture_current_transforms(ecs);
+        const auto next_step = get_interpolated_transform(
+            entity.get_component<TransformInterpolation>(),
+            entity.get_component<Transform>(),
+            0.5F);
+
+        // Assert
+        EXPECT_FLOAT_EQ(after_teleport.position.x, 100.0F);
+        EXPECT_FLOAT_EQ(next_step.position.x, 102.0F);
+    }
+
+    // Validates that an entity without captured history is drawn at its live transform.
+    TEST(TransformInterpolationTests, NoHistory_ReturnsLiveTransform)
+    {
+        // Arrange
+        const auto interpolation = TransformInterpolation {};
+        const auto live = Transform(Vec3(3.0F, 0.0F, 0.0F));
+
+        // Act
+        const auto resolved = get_interpolated_transform(interpolation, live, 0.5F);
+
+        // Assert
+        EXPECT_FLOAT_EQ(resolved.position.x, 3.0F);
+    }
+}
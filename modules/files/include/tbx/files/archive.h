@@ -0,0 +1,184 @@
+#pragma once
+#include "tbx/common/result.h"
+#include "tbx/common/typedefs.h"
+#include "tbx/files/mapped_file.h"
+#include "tbx/files/ops.h"
+#include "tbx/tbx_api.h"
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace tbx
+{
+    // Entry data starts on this boundary so mapped views suit aligned loads and uploads.
+    constexpr uint64 ArchiveEntryAlignment = 16U;
+
+    /// @brief
+    /// Purpose: Describes how an archive entry's bytes are stored in the pack.
+    /// @details
+    /// Ownership: Not applicable; this is a value-type classification.
+    /// Thread Safety: Safe to copy between threads.
+    enum class ArchiveCompression : uint32
+    {
+        NONE
+    };
+
+    /// @brief
+    /// Purpose: Describes one file stored in a packed asset archive.
+    /// @details
+    /// Ownership: Value type; `path` is relative to the directory the archive is mounted at.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API ArchiveEntry
+    {
+        // Generic relative path, e.g. `textures/crate.png`.
+        std::string path = {};
+
+        // Byte offset of the stored data from the start of the archive.
+        uint64 offset = 0U;
+
+        // Size of the file once read back.
+        uint64 size = 0U;
+
+        // Size of the data as stored in the archive.
+        uint64 stored_size = 0U;
+
+        ArchiveCompression compression = ArchiveCompression::NONE;
+        std::filesystem::file_time_type write_time = {};
+    };
+
+    // An entry queued on an ArchiveBuilder; `data` is used when `source_path` is empty.
+    struct ArchivePendingEntry
+    {
+        std::filesystem::path source_path = {};
+        std::string data = {};
+        std::filesystem::file_time_type write_time = {};
+    };
+
+    /// @brief
+    /// Purpose: Collects loose files and writes them as one packed archive with a table of
+    /// contents.
+    /// @details
+    /// Ownership: Owns copies of added data and source paths; source files are read during
+    /// `write`.
+    /// Thread Safety: Not thread-safe; use from one thread at a time.
+    class TBX_API ArchiveBuilder final
+    {
+      public:
+        // Adds or replaces an entry whose data is read from `source_path` when writing.
+        void add_file(const std::filesystem::path& entry_path, std::filesystem::path source_path);
+
+        // Adds or replaces an entry from in-memory data.
+        void add_data(
+            const std::filesystem::path& entry_path,
+            std::string data,
+            std::filesystem::file_time_type write_time = {});
+
+        // Adds every regular file beneath `source_directory`, keyed by its relative path.
+        Result add_directory(const std::filesystem::path& source_directory);
+
+        size get_entry_count() const;
+
+        // Writes entries sorted by path, each aligned to `ArchiveEntryAlignment`. The archive is
+        // written to a temporary file first so a failed build never replaces a good archive.
+        Result write(const std::filesystem::path& archive_path) const;
+
+      private:
+        std::unordered_map<std::string, ArchivePendingEntry> _entries = {};
+    };
+
+    /// @brief
+    /// Purpose: Opens a packed archive by memory-mapping it and indexing its table of contents.
+    /// @details
+    /// Ownership: Owns the mapping; views returned by `get_data` live as long as the archive.
+    /// Thread Safety: Lookups and reads are safe to call concurrently once `open` has returned.
+    class TBX_API Archive final
+    {
+      public:
+        Result open(const std::filesystem::path& archive_path);
+
+        const ArchiveEntry* find_entry(std::string_view entry_path) const;
+        bool has_directory(std::string_view directory_path) const;
+        const std::vector<ArchiveEntry>& get_entries() const;
+        const std::unordered_set<std::string>& get_directories() const;
+
+        // Returns a view into the mapped archive for uncompressed entries.
+        std::string_view get_data(const ArchiveEntry& entry) const;
+
+      private:
+        MappedFile _file = {};
+        std::vector<ArchiveEntry> _entries = {};
+        std::unordered_map<std::string, size> _entry_index_by_path = {};
+        std::unordered_set<std::string> _directories = {};
+    };
+
+    // An archive mounted on ArchiveFileOps beneath `directory`.
+    struct MountedArchive
+    {
+        std::filesystem::path directory = {};
+
+        // Shared with the views `map_file` hands out, which may outlive the file ops.
+        std::shared_ptr<Archive> archive = {};
+    };
+
+    /// @brief
+    /// Purpose: Serves files from mounted packed archives and falls back to loose files on disk.
+    /// @details
+    /// Ownership: Owns the loose-file operator and shares its mounted archives with the views
+    /// returned by `map_file`.
+    /// Thread Safety: Mount archives before sharing the instance; afterwards every `IFileOps`
+    /// call is safe to use concurrently. Writes always go to loose files.
+    /// Archives mounted later take precedence over earlier ones, and every archive takes
+    /// precedence over loose files at the same path.
+    class TBX_API ArchiveFileOps final : public IFileOps
+    {
+      public:
+        ArchiveFileOps(std::filesystem::path working_directory = {});
+
+      public:
+        // Mounts `archive_path` so its entries appear beneath `mount_directory`. Both paths are
+        // resolved against the working directory; an empty mount directory means the working
+        // directory itself.
+        Result mount(
+            const std::filesystem::path& archive_path,
+            const std::filesystem::path& mount_directory = {});
+        size get_mount_count() const;
+
+        std::filesystem::path get_working_directory() const override;
+        std::filesystem::path resolve(const std::filesystem::path& path) const override;
+        bool exists(const std::filesystem::path& path) const override;
+        FileType get_type(const std::filesystem::path& path) const override;
+        std::filesystem::file_time_type get_last_write_time(
+            const std::filesystem::path& path) const override;
+        std::vector<std::filesystem::path> read_directory(
+            const std::filesystem::path& root) const override;
+        bool read_file(
+            const std::filesystem::path& path,
+            FileDataFormat format,
+            std::string& out_data) const override;
+        bool get_file_size(const std::filesystem::path& path, uint64& out_size) const override;
+        bool read_file_into(const std::filesystem::path& path, std::span<std::byte> out_data)
+            const override;
+
+        // Archived files are served as views into the archive mapping without copying.
+        FileView map_file(const std::filesystem::path& path) const override;
+        bool write_file(
+            const std::filesystem::path& path,
+            FileDataFormat format,
+            const std::string& data) override;
+
+      private:
+        const ArchiveEntry* find_entry(
+            const std::filesystem::path& path,
+            const MountedArchive** out_mount = nullptr) const;
+        bool is_archived_directory(const std::filesystem::path& path) const;
+
+      private:
+        FileOperator _loose_files;
+        std::vector<MountedArchive> _archives = {};
+    };
+}
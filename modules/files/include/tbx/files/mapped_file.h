@@ -0,0 +1,42 @@
+#pragma once
+#include "tbx/common/result.h"
+#include "tbx/common/typedefs.h"
+#include "tbx/tbx_api.h"
+#include <filesystem>
+#include <string_view>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Maps a whole file read-only into the process address space.
+    /// @details
+    /// Ownership: Owns the mapping and releases it on close or destruction. Views returned by
+    /// `get_data` are invalidated when the mapping is closed, moved from, or reopened.
+    /// Thread Safety: Reading the mapped bytes is safe from any thread; opening and closing must
+    /// be externally synchronized.
+    class TBX_API MappedFile final
+    {
+      public:
+        MappedFile() = default;
+        ~MappedFile() noexcept;
+
+      public:
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+      public:
+        // Maps `path`, replacing any previous mapping. Empty files open with an empty view.
+        Result open(const std::filesystem::path& path);
+        void close();
+
+        bool is_open() const;
+        std::string_view get_data() const;
+
+      private:
+        const char* _data = nullptr;
+        size _size = 0U;
+        bool _is_open = false;
+    };
+}
@@ -1,6 +1,10 @@
 #pragma once
+#include "tbx/common/typedefs.h"
 #include "tbx/tbx_api.h"
+#include <cstddef>
 #include <filesystem>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -31,6 +35,30 @@ namespace tbx
         UTF8_TEXT
     };
 
+    /// @brief
+    /// Purpose: Read-only view of a whole file's bytes returned by `IFileOps::map_file`.
+    /// @details
+    /// Ownership: Shares ownership of whatever backs the bytes (a memory mapping, a mounted
+    /// archive, or a copy), so the view stays valid for as long as any copy of it is alive.
+    /// Thread Safety: Reading the bytes is safe from any thread; copies may be used concurrently.
+    class TBX_API FileView final
+    {
+      public:
+        FileView() = default;
+        FileView(std::string_view data, std::shared_ptr<const void> owner);
+
+      public:
+        // False when the file could not be mapped. Empty files map to a valid, empty view.
+        bool is_valid() const;
+        std::string_view get_data() const;
+        std::span<const std::byte> get_bytes() const;
+        size get_size() const;
+
+      private:
+        std::string_view _data = {};
+        std::shared_ptr<const void> _owner = nullptr;
+    };
+
     /// @brief
     /// Purpose: Defines filesystem operations used by importers and metadata readers.
     /// @details
@@ -96,6 +124,32 @@ namespace tbx
             FileDataFormat format,
             std::string& out_data) const = 0;
 
+        /// @brief
+        /// Purpose: Reports the size in bytes of the file at the resolved path.
+        /// @details
+        /// Ownership: Writes into caller-owned storage.
+        /// Thread Safety: Depends on the implementation.
+        virtual bool get_file_size(const std::filesystem::path& path, uint64& out_size) const = 0;
+
+        /// @brief
+        /// Purpose: Reads a whole file, unmodified, into the front of a caller-provided buffer.
+        /// @details
+        /// Ownership: Writes into caller-owned storage and does not retain it.
+        /// Thread Safety: Depends on the implementation. Notes: Fails without reading when the
+        /// file is larger than `out_data`; size the buffer with `get_file_size`.
+        virtual bool read_file_into(
+            const std::filesystem::path& path,
+            std::span<std::byte> out_data) const = 0;
+
+        /// @brief
+        /// Purpose: Returns a read-only view of a whole file's unmodified bytes without copying
+        /// them where the implementation can avoid it.
+        /// @details
+        /// Ownership: The returned view keeps its backing storage alive on its own.
+        /// Thread Safety: Depends on the implementation. Notes: Returns an invalid view when the
+        /// file cannot be read.
+        virtual FileView map_file(const std::filesystem::path& path) const = 0;
+
         /// @brief
         /// Purpose: Writes provided data to the target file path.
         /// @details
@@ -184,6 +238,29 @@ namespace tbx
         bool read_file(const std::filesystem::path& path, FileDataFormat format, std::string& out)
             const override;
 
+        /// @brief
+        /// Purpose: Reports the size in bytes of a file on disk.
+        /// @details
+        /// Ownership: Writes into the caller-owned output value.
+        /// Thread Safety: Safe to call concurrently.
+        bool get_file_size(const std::filesystem::path& path, uint64& out_size) const override;
+
+        /// @brief
+        /// Purpose: Reads a whole file into the front of the provided buffer.
+        /// @details
+        /// Ownership: Writes into the caller-owned buffer.
+        /// Thread Safety: Safe to call concurrently.
+        bool read_file_into(const std::filesystem::path& path, std::span<std::byte> out_data)
+            const override;
+
+        /// @brief
+        /// Purpose: Memory-maps a file read-only.
+        /// @details
+        /// Ownership: The returned view owns the mapping and unmaps it when the last copy is
+        /// destroyed.
+        /// Thread Safety: Safe to call concurrently.
+        FileView map_file(const std::filesystem::path& path) const override;
+
         /// @brief
         /// Purpose: Rotates files with a numeric suffix and returns the newest file path.
         /// @details
@@ -0,0 +1,584 @@
+#include "tbx/files/archive.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace tbx
+{
+    namespace
+    {
+        constexpr std::array<char, 4> ArchiveMagic = {'T', 'B', 'X', 'A'};
+
+        // Bump whenever the header or table of contents layout changes.
+        constexpr uint32 ArchiveVersion = 1U;
+
+        // Magic, version, entry count, reserved flags, table offset, and table size.
+        constexpr uint64 ArchiveHeaderSize =
+            sizeof(ArchiveMagic) + sizeof(uint32) * 3U + sizeof(uint64) * 2U;
+
+        template <typename TValue>
+        void append_value(std::string& data, const TValue& value)
+        {
+            static_assert(std::is_trivially_copyable_v<TValue>);
+            const auto offset = data.size();
+            data.resize(offset + sizeof(TValue));
+            std::memcpy(data.data() + offset, &value, sizeof(TValue));
+        }
+
+        template <typename TValue>
+        bool try_read_value(std::string_view data, uint64& offset, TValue& out_value)
+        {
+            static_assert(std::is_trivially_copyable_v<TValue>);
+            if (offset > data.size() || data.size() - offset < sizeof(TValue))
+                return false;
+
+            std::memcpy(&out_value, data.data() + offset, sizeof(TValue));
+            offset += sizeof(TValue);
+            return true;
+        }
+
+        uint64 align_offset(uint64 offset)
+        {
+            return (offset + ArchiveEntryAlignment - 1U) / ArchiveEntryAlignment
+                   * ArchiveEntryAlignment;
+        }
+
+        std::string make_entry_key(const std::filesystem::path& entry_path)
+        {
+            return entry_path.lexically_normal().generic_string();
+        }
+
+        // Returns the path of `path` inside `directory`, or empty when it lies outside it.
+        // The directory itself maps to ".".
+        std::string get_relative_entry_path(
+            const std::filesystem::path& path,
+            const std::filesystem::path& directory)
+        {
+            const auto relative = path.lexically_relative(directory);
+            if (relative.empty())
+                return {};
+
+            auto key = relative.generic_string();
+            if (key == ".." || key.starts_with("../"))
+                return {};
+            return key;
+        }
+
+        bool try_read_source_file(const std::filesystem::path& path, std::string& out_data)
+        {
+            auto stream = std::ifstream(path, std::ios::in | std::ios::binary);
+            if (!stream.is_open())
+                return false;
+
+            out_data.assign(
+                std::istreambuf_iterator<char>(stream),
+                std::istreambuf_iterator<char>());
+            return !stream.bad();
+        }
+
+        void strip_utf8_bom(std::string& contents)
+        {
+            if (contents.size() >= 3 && static_cast<unsigned char>(contents[0]) == 0xEF
+                && static_cast<unsigned char>(contents[1]) == 0xBB
+                && static_cast<unsigned char>(contents[2]) == 0xBF)
+            {
+                contents.erase(0, 3);
+            }
+        }
+    }
+
+    void ArchiveBuilder::add_file(
+        const std::filesystem::path& entry_path,
+        std::filesystem::path source_path)
+    {
+        _entries.insert_or_assign(
+            make_entry_key(entry_path),
+            ArchivePendingEntry {.source_path = std::move(source_path)});
+    }
+
+    void ArchiveBuilder::add_data(
+        const std::filesystem::path& entry_path,
+        std::string data,
+        std::filesystem::file_time_type write_time)
+    {
+        _entries.insert_or_assign(
+            make_entry_key(entry_path),
+            ArchivePendingEntry {.data = std::move(data), .write_time = write_time});
+    }
+
+    Result ArchiveBuilder::add_directory(const std::filesystem::path& source_directory)
+    {
+        auto error = std::error_code();
+        auto iterator = std::filesystem::recursive_directory_iterator(source_directory, error);
+        if (error)
+        {
+            return Result(
+                false,
+                std::format(
+                    "Failed to read archive source directory '{}': {}",
+                    source_directory.string(),
+                    error.message()));
+        }
+
+        for (const auto end = std::filesystem::recursive_directory_iterator(); iterator != end;
+             iterator.increment(error))
+        {
+            if (error)
+                break;
+            if (!iterator->is_regular_file(error))
+                continue;
+
+            add_file(iterator->path().lexically_relative(source_directory), iterator->path());
+        }
+
+        if (error)
+        {
+            return Result(
+                false,
+                std::format(
+                    "Failed to read archive source directory '{}': {}",
+                    source_directory.string(),
+                    error.message()));
+        }
+        return {};
+    }
+
+    size ArchiveBuilder::get_entry_count() const
+    {
+        return _entries.size();
+    }
+
+    Result ArchiveBuilder::write(const std::filesystem::path& archive_path) const
+    {
+        auto sorted_paths = std::vector<const std::string*>();
+        sorted_paths.reserve(_entries.size());
+        for (const auto& [entry_path, entry] : _entries)
+            sorted_paths.push_back(&entry_path);
+        std::sort(
+            sorted_paths.begin(),
+            sorted_paths.end(),
+            [](const std::string* left, const std::string* right)
+            {
+                return *left < *right;
+            });
+
+        auto error = std::error_code();
+        if (archive_path.has_parent_path())
+            std::filesystem::create_directories(archive_path.parent_path(), error);
+
+        auto temporary_path = archive_path;
+        temporary_path += ".tmp";
+        auto stream = std::ofstream(temporary_path, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+        {
+            return Result(
+                false,
+                std::format("Failed to create archive '{}'.", temporary_path.string()));
+        }
+
+        // Data is streamed first and the table of contents is appended once offsets are known.
+        auto table = std::string();
+        auto offset = ArchiveHeaderSize;
+        auto source_data = std::string();
+        const auto padding = std::array<char, ArchiveEntryAlignment> {};
+        stream.write(
+            std::string(ArchiveHeaderSize, '\0').data(),
+            static_cast<std::streamsize>(ArchiveHeaderSize));
+        for (const auto* entry_path : sorted_paths)
+        {
+            const auto& entry = _entries.at(*entry_path);
+            const auto* data = &entry.data;
+            auto write_time = entry.write_time;
+            if (!entry.source_path.empty())
+            {
+                if (!try_read_source_file(entry.source_path, source_data))
+                {
+                    stream.close();
+                    std::filesystem::remove(temporary_path, error);
+                    return Result(
+                        false,
+                        std::format(
+                            "Failed to read '{}' for archive '{}'.",
+                            entry.source_path.string(),
+                            archive_path.string()));
+                }
+
+                data = &source_data;
+                write_time = std::filesystem::last_write_time(entry.source_path, error);
+            }
+
+            const auto aligned_offset = align_offset(offset);
+            stream.write(padding.data(), static_cast<std::streamsize>(aligned_offset - offset));
+            stream.write(data->data(), static_cast<std::streamsize>(data->size()));
+            offset = aligned_offset + data->size();
+
+            append_value(table, aligned_offset);
+            append_value(table, static_cast<uint64>(data->size()));
+            append_value(table, static_cast<uint64>(data->size()));
+            append_value(table, static_cast<int64>(write_time.time_since_epoch().count()));
+            append_value(table, ArchiveCompression::NONE);
+            append_value(table, static_cast<uint32>(entry_path->size()));
+            table.append(*entry_path);
+        }
+
+        auto header = std::string();
+        append_value(header, ArchiveMagic);
+        append_value(header, ArchiveVersion);
+        append_value(header, static_cast<uint32>(sorted_paths.size()));
+        append_value(header, uint32(0U));
+        append_value(header, offset);
+        append_value(header, static_cast<uint64>(table.size()));
+
+        stream.write(table.data(), static_cast<std::streamsize>(table.size()));
+        stream.seekp(0);
+        stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+        stream.close();
+        if (!stream)
+        {
+            std::filesystem::remove(temporary_path, error);
+            return Result(
+                false,
+                std::format("Failed to write archive '{}'.", archive_path.string()));
+        }
+
+        std::filesystem::rename(temporary_path, archive_path, error);
+        if (error)
+        {
+            std::filesystem::remove(temporary_path, error);
+            return Result(
+                false,
+                std::format("Failed to replace archive '{}'.", archive_path.string()));
+        }
+        return {};
+    }
+
+    Result Archive::open(const std::filesystem::path& archive_path)
+    {
+        _entries.clear();
+        _entry_index_by_path.clear();
+        _directories.clear();
+        if (auto map_result = _file.open(archive_path); !map_result)
+            return map_result;
+
+        const auto data = _file.get_data();
+        const auto fail = [this, &archive_path](std::string_view reason)
+        {
+            _file.close();
+            _entries.clear();
+            _entry_index_by_path.clear();
+            _directories.clear();
+            return Result(false, std::format("Archive '{}' {}.", archive_path.string(), reason));
+        };
+
+        auto offset = uint64(0U);
+        auto magic = std::array<char, 4> {};
+        auto version = uint32(0U);
+        auto entry_count = uint32(0U);
+        auto flags = uint32(0U);
+        auto table_offset = uint64(0U);
+        auto table_size = uint64(0U);
+        if (!try_read_value(data, offset, magic) || magic != ArchiveMagic
+            || !try_read_value(data, offset, version) || !try_read_value(data, offset, entry_count)
+            || !try_read_value(data, offset, flags) || !try_read_value(data, offset, table_offset)
+            || !try_read_value(data, offset, table_size))
+        {
+            return fail("is not a Toybox archive");
+        }
+        if (version != ArchiveVersion)
+            return fail(std::format("has unsupported version {}", version));
+        if (table_offset < ArchiveHeaderSize || table_offset > data.size()
+            || table_size != data.size() - table_offset)
+        {
+            return fail("is truncated");
+        }
+
+        _entries.reserve(entry_count);
+        offset = table_offset;
+        for (uint32 index = 0U; index < entry_count; ++index)
+        {
+            auto entry = ArchiveEntry();
+            auto write_ticks = int64(0);
+            auto path_length = uint32(0U);
+            if (!try_read_value(data, offset, entry.offset)
+                || !try_read_value(data, offset, entry.size)
+                || !try_read_value(data, offset, entry.stored_size)
+                || !try_read_value(data, offset, write_ticks)
+                || !try_read_value(data, offset, entry.compression)
+                || !try_read_value(data, offset, path_length)
+                || data.size() - offset < path_length)
+            {
+                return fail("has a truncated table of contents");
+            }
+
+            entry.path.assign(data.substr(offset, path_length));
+            offset += path_length;
+            entry.write_time = std::filesystem::file_time_type(
+                std::filesystem::file_time_type::duration(write_ticks));
+            if (entry.compression != ArchiveCompression::NONE || entry.size != entry.stored_size)
+                return fail(std::format("stores '{}' with an unsupported encoding", entry.path));
+            if (entry.offset > table_offset || table_offset - entry.offset < entry.stored_size)
+                return fail(std::format("has out of range data for '{}'", entry.path));
+
+            _entry_index_by_path.insert_or_assign(entry.path, _entries.size());
+            for (auto directory = std::filesystem::path(entry.path).parent_path();
+                 !directory.empty();
+                 directory = directory.parent_path())
+            {
+                if (!_directories.insert(directory.generic_string()).second)
+                    break;
+            }
+            _entries.push_back(std::move(entry));
+        }
+
+        return {};
+    }
+
+    const ArchiveEntry* Archive::find_entry(std::string_view entry_path) const
+    {
+        const auto iterator = _entry_index_by_path.find(std::string(entry_path));
+        if (iterator == _entry_index_by_path.end())
+            return nullptr;
+        return &_entries[iterator->second];
+    }
+
+    bool Archive::has_directory(std::string_view directory_path) const
+    {
+        return directory_path == "." || _directories.contains(std::string(directory_path));
+    }
+
+    const std::vector<ArchiveEntry>& Archive::get_entries() const
+    {
+        return _entries;
+    }
+
+    const std::unordered_set<std::string>& Archive::get_directories() const
+    {
+        return _directories;
+    }
+
+    std::string_view Archive::get_data(const ArchiveEntry& entry) const
+    {
+        return _file.get_data().substr(
+            static_cast<size>(entry.offset),
+            static_cast<size>(entry.stored_size));
+    }
+
+    ArchiveFileOps::ArchiveFileOps(std::filesystem::path working_directory)
+        : _loose_files(std::move(working_directory))
+    {
+    }
+
+    Result ArchiveFileOps::mount(
+        const std::filesystem::path& archive_path,
+        const std::filesystem::path& mount_directory)
+    {
+        auto archive = std::make_shared<Archive>();
+        if (auto open_result = archive->open(resolve(archive_path)); !open_result)
+            return open_result;
+
+        auto directory =
+            mount_directory.empty() ? get_working_directory() : resolve(mount_directory);
+        _archives.push_back(
+            MountedArchive {
+                .directory = directory.lexically_normal(),
+                .archive = std::move(archive),
+            });
+        return {};
+    }
+
+    size ArchiveFileOps::get_mount_count() const
+    {
+        return _archives.size();
+    }
+
+    std::filesystem::path ArchiveFileOps::get_working_directory() const
+    {
+        return _loose_files.get_working_directory();
+    }
+
+    std::filesystem::path ArchiveFileOps::resolve(const std::filesystem::path& path) const
+    {
+        return _loose_files.resolve(path);
+    }
+
+    bool ArchiveFileOps::exists(const std::filesystem::path& path) const
+    {
+        return find_entry(path) || is_archived_directory(path) || _loose_files.exists(path);
+    }
+
+    FileType ArchiveFileOps::get_type(const std::filesystem::path& path) const
+    {
+        if (find_entry(path))
+            return FileType::FILE;
+        if (is_archived_directory(path))
+            return FileType::DIRECTORY;
+        return _loose_files.get_type(path);
+    }
+
+    std::filesystem::file_time_type ArchiveFileOps::get_last_write_time(
+        const std::filesystem::path& path) const
+    {
+        if (const auto* entry = find_entry(path))
+            return entry->write_time;
+        return _loose_files.get_last_write_time(path);
+    }
+
+    std::vector<std::filesystem::path> ArchiveFileOps::read_directory(
+        const std::filesystem::path& root) const
+    {
+        auto entries = _loose_files.read_directory(root);
+        if (_archives.empty())
+            return entries;
+
+        auto seen = std::unordered_set<std::string>();
+        for (const auto& entry : entries)
+            seen.insert(entry.generic_string());
+        const auto add_entry = [&entries, &seen](std::filesystem::path path)
+        {
+            if (seen.insert(path.generic_string()).second)
+                entries.push_back(std::move(path));
+        };
+
+        const auto resolved_root = resolve(root);
+        for (const auto& mounted : _archives)
+        {
+            // Listing an ancestor of the mount point also lists the directories leading to it.
+            auto prefix = get_relative_entry_path(resolved_root, mounted.directory);
+            if (prefix.empty())
+            {
+                if (get_relative_entry_path(mounted.directory, resolved_root).empty())
+                    continue;
+
+                for (auto directory = mounted.directory;
+                     get_relative_entry_path(directory, resolved_root) != ".";
+                     directory = directory.parent_path())
+                {
+                    add_entry(directory);
+                }
+                prefix = ".";
+            }
+
+            const auto is_listed = [&prefix](const std::string& path)
+            {
+                return prefix == "."
+                       || (path.size() > prefix.size() && path.starts_with(prefix)
+                           && path[prefix.size()] == '/');
+            };
+            for (const auto& directory : mounted.archive->get_directories())
+            {
+                if (is_listed(directory))
+                    add_entry(mounted.directory / directory);
+            }
+            for (const auto& entry : mounted.archive->get_entries())
+            {
+                if (is_listed(entry.path))
+                    add_entry(mounted.directory / entry.path);
+            }
+        }
+        return entries;
+    }
+
+    bool ArchiveFileOps::read_file(
+        const std::filesystem::path& path,
+        FileDataFormat format,
+        std::string& out_data) const
+    {
+        const auto* mount = static_cast<const MountedArchive*>(nullptr);
+        const auto* entry = find_entry(path, &mount);
+        if (!entry)
+            return _loose_files.read_file(path, format, out_data);
+
+        out_data.assign(mount->archive->get_data(*entry));
+        if (format == FileDataFormat::UTF8_TEXT)
+            strip_utf8_bom(out_data);
+        return true;
+    }
+
+    bool ArchiveFileOps::get_file_size(const std::filesystem::path& path, uint64& out_size) const
+    {
+        const auto* entry = find_entry(path);
+        if (!entry)
+            return _loose_files.get_file_size(path, out_size);
+
+        out_size = entry->size;
+        return true;
+    }
+
+    bool ArchiveFileOps::read_file_into(
+        const std::filesystem::path& path,
+        std::span<std::byte> out_data) const
+    {
+        const auto* mount = static_cast<const MountedArchive*>(nullptr);
+        const auto* entry = find_entry(path, &mount);
+        if (!entry)
+            return _loose_files.read_file_into(path, out_data);
+
+        const auto data = mount->archive->get_data(*entry);
+        if (data.size() > out_data.size())
+            return false;
+
+        std::memcpy(out_data.data(), data.data(), data.size());
+        return true;
+    }
+
+    FileView ArchiveFileOps::map_file(const std::filesystem::path& path) const
+    {
+        const auto* mount = static_cast<const MountedArchive*>(nullptr);
+        const auto* entry = find_entry(path, &mount);
+        if (!entry)
+            return _loose_files.map_file(path);
+
+        // Entries are views into the archive's own mapping, which the view keeps alive.
+        return FileView(mount->archive->get_data(*entry), mount->archive);
+    }
+
+    bool ArchiveFileOps::write_file(
+        const std::filesystem::path& path,
+        FileDataFormat format,
+        const std::string& data)
+    {
+        return _loose_files.write_file(path, format, data);
+    }
+
+    const ArchiveEntry* ArchiveFileOps::find_entry(
+        const std::filesystem::path& path,
+        const MountedArchive** out_mount) const
+    {
+        if (_archives.empty())
+            return nullptr;
+
+        const auto resolved = resolve(path);
+        for (auto iterator = _archives.rbegin(); iterator != _archives.rend(); ++iterator)
+        {
+            const auto entry_path = get_relative_entry_path(resolved, iterator->directory);
+            if (entry_path.empty())
+                continue;
+
+            if (const auto* entry = iterator->archive->find_entry(entry_path))
+            {
+                if (out_mount)
+                    *out_mount = &*iterator;
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    bool ArchiveFileOps::is_archived_directory(const std::filesystem::path& path) const
+    {
+        const auto resolved = resolve(path);
+        for (const auto& mounted : _archives)
+        {
+            const auto entry_path = get_relative_entry_path(resolved, mounted.directory);
+            if (!entry_path.empty() && mounted.archive->has_directory(entry_path))
+                return true;
+        }
+        return false;
+    }
+}
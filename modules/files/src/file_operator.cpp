@@ -1,10 +1,12 @@
 #include "tbx/files/ops.h"
+#include "tbx/files/mapped_file.h"
 #include <array>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <string>
 #include <system_error>
+#include <utility>
 #include <vector>
 #if defined(TBX_PLATFORM_WINDOWS)
     #ifndef NOMINMAX
@@ -135,6 +137,32 @@ namespace tbx
         return FileType::DIRECTORY;
     }
 
+    FileView::FileView(std::string_view data, std::shared_ptr<const void> owner)
+        : _data(data)
+        , _owner(std::move(owner))
+    {
+    }
+
+    bool FileView::is_valid() const
+    {
+        return _owner != nullptr;
+    }
+
+    std::string_view FileView::get_data() const
+    {
+        return _data;
+    }
+
+    std::span<const std::byte> FileView::get_bytes() const
+    {
+        return std::as_bytes(std::span(_data.data(), _data.size()));
+    }
+
+    size FileView::get_size() const
+    {
+        return _data.size();
+    }
+
     FileOperator::FileOperator(std::filesystem::path working_directory)
         : _working_directory(working_directory.lexically_normal())
     {
@@ -253,23 +281,72 @@ namespace tbx
         if (!stream.is_open())
             return false;
 
-        auto contents =
-            std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        // Read straight into the output in one call when the size is known up front.
+        auto error = std::error_code();
+        const auto file_size = std::filesystem::file_size(resolved, error);
+        if (!error)
+        {
+            out.resize(static_cast<size>(file_size));
+            stream.read(out.data(), static_cast<std::streamsize>(out.size()));
+            out.resize(static_cast<size>(stream.gcount()));
+        }
+        else
+            out.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
 
         // Strip UTF-8 BOM for text mode; binary payloads are left untouched.
-        if (!binary && contents.size() >= 3)
+        if (!binary && out.size() >= 3)
         {
-            const unsigned char bom0 = static_cast<unsigned char>(contents[0]);
-            const unsigned char bom1 = static_cast<unsigned char>(contents[1]);
-            const unsigned char bom2 = static_cast<unsigned char>(contents[2]);
+            const unsigned char bom0 = static_cast<unsigned char>(out[0]);
+            const unsigned char bom1 = static_cast<unsigned char>(out[1]);
+            const unsigned char bom2 = static_cast<unsigned char>(out[2]);
             if (bom0 == 0xEF && bom1 == 0xBB && bom2 == 0xBF)
-                contents.erase(0, 3);
+                out.erase(0, 3);
         }
 
-        out = contents;
         return true;
     }
 
+    bool FileOperator::get_file_size(const std::filesystem::path& path, uint64& out_size) const
+    {
+        auto error = std::error_code();
+        const auto file_size = std::filesystem::file_size(resolve(path), error);
+        if (error)
+            return false;
+
+        out_size = static_cast<uint64>(file_size);
+        return true;
+    }
+
+    bool FileOperator::read_file_into(
+        const std::filesystem::path& path,
+        std::span<std::byte> out_data) const
+    {
+        const std::filesystem::path resolved = resolve(path);
+        auto error = std::error_code();
+        const auto file_size = std::filesystem::file_size(resolved, error);
+        if (error || file_size > out_data.size())
+            return false;
+
+        auto stream = std::ifstream(resolved, std::ios::in | std::ios::binary);
+        if (!stream.is_open())
+            return false;
+
+        stream.read(
+            reinterpret_cast<char*>(out_data.data()),
+            static_cast<std::streamsize>(file_size));
+        return static_cast<uint64>(stream.gcount()) == file_size;
+    }
+
+    FileView FileOperator::map_file(const std::filesystem::path& path) const
+    {
+        auto mapped_file = std::make_shared<MappedFile>();
+        if (!mapped_file->open(resolve(path)))
+            return {};
+
+        const auto data = mapped_file->get_data();
+        return FileView(data, std::move(mapped_file));
+    }
+
     bool FileOperator::write_file(
         const std::filesystem::path& path,
         FileDataFormat format,
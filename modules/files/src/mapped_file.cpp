@@ -0,0 +1,129 @@
+#include "tbx/files/mapped_file.h"
+#include <format>
+#include <system_error>
+#include <utility>
+#if defined(TBX_PLATFORM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace tbx
+{
+    MappedFile::~MappedFile() noexcept
+    {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : _data(std::exchange(other._data, nullptr))
+        , _size(std::exchange(other._size, 0U))
+        , _is_open(std::exchange(other._is_open, false))
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0U);
+            _is_open = std::exchange(other._is_open, false);
+        }
+        return *this;
+    }
+
+    Result MappedFile::open(const std::filesystem::path& path)
+    {
+        close();
+
+        auto error = std::error_code();
+        const auto file_size = std::filesystem::file_size(path, error);
+        if (error)
+        {
+            return Result(
+                false,
+                std::format("Failed to map '{}': {}", path.string(), error.message()));
+        }
+        if (file_size == 0U)
+        {
+            _is_open = true;
+            return {};
+        }
+
+#if defined(TBX_PLATFORM_WINDOWS)
+        const auto file = CreateFileW(
+            path.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return Result(false, std::format("Failed to open '{}' for mapping.", path.string()));
+
+        // The view keeps the mapping alive, so both handles can be released right away.
+        const auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping)
+            return Result(false, std::format("Failed to map '{}'.", path.string()));
+
+        const auto* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!data)
+            return Result(false, std::format("Failed to map '{}'.", path.string()));
+#else
+        const auto descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            return Result(false, std::format("Failed to open '{}' for mapping.", path.string()));
+
+        // The mapping holds its own reference to the file, so the descriptor can be closed.
+        auto* data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor);
+        if (data == MAP_FAILED)
+            return Result(false, std::format("Failed to map '{}'.", path.string()));
+#endif
+
+        _data = static_cast<const char*>(data);
+        _size = static_cast<size>(file_size);
+        _is_open = true;
+        return {};
+    }
+
+    void MappedFile::close()
+    {
+        if (_data)
+        {
+#if defined(TBX_PLATFORM_WINDOWS)
+            UnmapViewOfFile(_data);
+#else
+            munmap(const_cast<char*>(_data), _size);
+#endif
+        }
+
+        _data = nullptr;
+        _size = 0U;
+        _is_open = false;
+    }
+
+    bool MappedFile::is_open() const
+    {
+        return _is_open;
+    }
+
+    std::string_view MappedFile::get_data() const
+    {
+        return std::string_view(_data, _size);
+    }
+}
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "tbx/files/archive.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace tbx::tests::file_system
+{
+    static std::filesystem::path make_archive_test_directory(const char* name)
+    {
+        const auto directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        return directory;
+    }
+
+    TEST(ArchiveFileOpsTests, ServesArchivedFilesAndFallsBackToLooseFiles)
+    {
+        const auto directory = make_archive_test_directory("tbx_archive_file_ops_tests");
+        auto builder = ArchiveBuilder();
+        builder.add_data("textures/crate.png", "png bytes");
+        builder.add_data("shaders/lit.vert", "\xEF\xBB\xBFvoid main() {}");
+        ASSERT_TRUE(builder.write(directory / "content.tbxa"));
+        std::ofstream(directory / "loose.txt") << "loose";
+
+        auto ops = ArchiveFileOps(directory);
+        const auto mount_result = ops.mount("content.tbxa", "assets");
+
+        auto texture = std::string();
+        auto shader = std::string();
+        auto loose = std::string();
+        ASSERT_TRUE(mount_result) << mount_result.get_report();
+        EXPECT_TRUE(ops.read_file("assets/textures/crate.png", FileDataFormat::BINARY, texture));
+        EXPECT_TRUE(ops.read_file("assets/shaders/lit.vert", FileDataFormat::UTF8_TEXT, shader));
+        EXPECT_TRUE(ops.read_file("loose.txt", FileDataFormat::UTF8_TEXT, loose));
+        EXPECT_EQ(texture, "png bytes");
+        EXPECT_EQ(shader, "void main() {}");
+        EXPECT_EQ(loose, "loose");
+        EXPECT_EQ(ops.map_file("assets/textures/crate.png").get_data(), "png bytes");
+        EXPECT_EQ(ops.map_file("loose.txt").get_data(), "loose");
+        EXPECT_EQ(ops.get_type("assets/textures"), FileType::DIRECTORY);
+        EXPECT_EQ(ops.get_type("assets/textures/crate.png"), FileType::FILE);
+        EXPECT_FALSE(ops.exists("assets/textures/missing.png"));
+        EXPECT_FALSE(ops.exists("textures/crate.png"));
+
+        const auto listed = ops.read_directory("assets");
+        const auto is_listed = [&listed](const std::filesystem::path& path)
+        {
+            return std::find(listed.begin(), listed.end(), path) != listed.end();
+        };
+        EXPECT_EQ(listed.size(), 4U);
+        EXPECT_TRUE(is_listed(directory / "assets" / "textures"));
+        EXPECT_TRUE(is_listed(directory / "assets" / "textures" / "crate.png"));
+        EXPECT_TRUE(is_listed(directory / "assets" / "shaders" / "lit.vert"));
+
+        const auto root_listed = ops.read_directory(directory);
+        EXPECT_NE(
+            std::find(root_listed.begin(), root_listed.end(), directory / "assets"),
+            root_listed.end());
+        EXPECT_EQ(root_listed.size(), 7U);
+
+        std::filesystem::remove_all(directory);
+    }
+
+    TEST(ArchiveTests, AlignsEntriesAndRejectsTruncatedArchives)
+    {
+        const auto directory = make_archive_test_directory("tbx_archive_tests");
+        const auto archive_path = directory / "content.tbxa";
+        auto builder = ArchiveBuilder();
+        builder.add_data("a.bin", "abc");
+        builder.add_data("b.bin", "defgh");
+        ASSERT_TRUE(builder.write(archive_path));
+
+        auto archive = Archive();
+        const auto open_result = archive.open(archive_path);
+
+        ASSERT_TRUE(open_result) << open_result.get_report();
+        ASSERT_EQ(archive.get_entries().size(), 2U);
+        for (const auto& entry : archive.get_entries())
+            EXPECT_EQ(entry.offset % ArchiveEntryAlignment, 0U) << entry.path;
+        ASSERT_NE(archive.find_entry("b.bin"), nullptr);
+        EXPECT_EQ(archive.get_data(*archive.find_entry("b.bin")), "defgh");
+
+        archive = Archive();
+        std::filesystem::resize_file(archive_path, std::filesystem::file_size(archive_path) - 2U);
+        auto truncated = Archive();
+        EXPECT_FALSE(truncated.open(archive_path));
+        EXPECT_EQ(truncated.find_entry("a.bin"), nullptr);
+
+        std::filesystem::remove_all(directory);
+    }
+}
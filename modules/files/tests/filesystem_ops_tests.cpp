@@ -1,6 +1,10 @@
 #include "pch.h"
 #include "tbx/files/ops.h"
+#include <array>
+#include <cstddef>
 #include <filesystem>
+#include <fstream>
+#include <string_view>
 
 namespace tbx::tests::file_system
 {
@@ -33,4 +37,35 @@ namespace tbx::tests::file_system
 
         EXPECT_EQ(resolved, absolute);
     }
+
+    TEST(FileOperatorTests, ReadsFilesWithoutCopyingThroughStrings)
+    {
+        const auto working = std::filesystem::temp_directory_path() / "tbx_zero_copy_root";
+        std::filesystem::remove_all(working);
+        std::filesystem::create_directories(working);
+        std::ofstream(working / "data.bin", std::ios::binary) << std::string_view("\0abc\xFF", 5);
+        std::ofstream(working / "empty.bin", std::ios::binary);
+        FileOperator ops = FileOperator(working);
+
+        auto file_size = uint64(0U);
+        auto buffer = std::array<std::byte, 8>();
+        auto small_buffer = std::array<std::byte, 4>();
+        const auto view = ops.map_file("data.bin");
+        const auto empty_view = ops.map_file("empty.bin");
+
+        ASSERT_TRUE(ops.get_file_size("data.bin", file_size));
+        EXPECT_EQ(file_size, 5U);
+        EXPECT_TRUE(ops.read_file_into("data.bin", buffer));
+        EXPECT_EQ(buffer[3], std::byte {'c'});
+        EXPECT_EQ(buffer[4], std::byte {0xFF});
+        EXPECT_FALSE(ops.read_file_into("data.bin", small_buffer));
+        ASSERT_TRUE(view.is_valid());
+        EXPECT_EQ(view.get_data(), std::string_view("\0abc\xFF", 5));
+        EXPECT_TRUE(empty_view.is_valid());
+        EXPECT_EQ(empty_view.get_size(), 0U);
+        EXPECT_FALSE(ops.map_file("missing.bin").is_valid());
+        EXPECT_FALSE(ops.get_file_size("missing.bin", file_size));
+
+        std::filesystem::remove_all(working);
+    }
 }
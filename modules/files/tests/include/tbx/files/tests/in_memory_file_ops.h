@@ -1,7 +1,10 @@
 #pragma once
 #include "tbx/files/ops.h"
+#include <cstring>
 #include <filesystem>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -111,6 +114,42 @@ namespace tbx::tests::file_system
             return true;
         }
 
+        bool get_file_size(const std::filesystem::path& path, uint64& out_size) const override
+        {
+            std::lock_guard<std::mutex> lock(_files_mutex);
+            const auto file = _files.find(resolve(path));
+            if (file == _files.end())
+                return false;
+
+            out_size = file->second.data.size();
+            return true;
+        }
+
+        bool read_file_into(const std::filesystem::path& path, std::span<std::byte> out_data)
+            const override
+        {
+            std::lock_guard<std::mutex> lock(_files_mutex);
+            const auto file = _files.find(resolve(path));
+            if (file == _files.end() || file->second.data.size() > out_data.size())
+                return false;
+
+            std::memcpy(out_data.data(), file->second.data.data(), file->second.data.size());
+            return true;
+        }
+
+        // Views share a snapshot of the contents, so later writes never change mapped bytes.
+        FileView map_file(const std::filesystem::path& path) const override
+        {
+            std::lock_guard<std::mutex> lock(_files_mutex);
+            const auto file = _files.find(resolve(path));
+            if (file == _files.end())
+                return {};
+
+            auto contents = std::make_shared<const std::string>(file->second.data);
+            const auto data = std::string_view(*contents);
+            return FileView(data, std::move(contents));
+        }
+
         bool write_file(
             const std::filesystem::path& path,
             FileDataFormat,
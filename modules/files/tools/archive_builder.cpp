@@ -0,0 +1,34 @@
+#include "tbx/files/archive.h"
+#include <filesystem>
+#include <iostream>
+
+// Packs every file beneath a source directory into one archive:
+//   TbxArchiveBuilder <source-directory> <archive-path>
+// Mount the result with `ArchiveFileOps::mount` at the directory the files were loaded from.
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: TbxArchiveBuilder <source-directory> <archive-path>\n";
+        return 2;
+    }
+
+    const auto source_directory = std::filesystem::path(argv[1]);
+    const auto archive_path = std::filesystem::path(argv[2]);
+    auto builder = tbx::ArchiveBuilder();
+    if (const auto add_result = builder.add_directory(source_directory); !add_result)
+    {
+        std::cerr << add_result.get_report() << '\n';
+        return 1;
+    }
+
+    if (const auto write_result = builder.write(archive_path); !write_result)
+    {
+        std::cerr << write_result.get_report() << '\n';
+        return 1;
+    }
+
+    std::cout << "Packed " << builder.get_entry_count() << " files into "
+              << archive_path.string() << '\n';
+    return 0;
+}
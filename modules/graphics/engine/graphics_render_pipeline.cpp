@@ -11,8 +11,10 @@
 #include "tbx/graphics/frustum.h"
 #include "tbx/graphics/sphere.h"
 #include "tbx/graphics/render_resources.h"
+#include "tbx/graphics/shader.h"
 #include "tbx/math/matrices.h"
 #include "tbx/math/trig.h"
+#include "tbx/profiling/macros.h"
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -22,6 +24,7 @@
 #include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <unordered_set>
 
 namespace tbx
 {
@@ -70,10 +73,48 @@ namespace tbx
             }
         }
 
+        // An asset handle and instance resolved through the asset manager on the main thread.
+        template <typename TAsset>
+        struct ResolvedAsset
+        {
+            Handle handle = {};
+            std::shared_ptr<TAsset> asset = {};
+        };
+
+        // Entity state and assets captured on the main thread. GPU resources are created later on
+        // the render lane, so a built scene never reads the entity registry or asset manager again.
+        struct RenderSceneItem
+        {
+            DynamicMesh dynamic_mesh = {};
+            ResolvedAsset<Model> model = {};
+            ResolvedAsset<Material> material = {};
+            std::vector<ResolvedAsset<Texture>> texture_assets = {};
+            MaterialConfig material_config = {};
+            ParamBindings material_parameters = {};
+            TextureBindings material_textures = {};
+            Mat4 transform = Mat4(1.0F);
+            float bounds_radius = 0.0F;
+            float camera_distance_squared = 0.0F;
+            bool is_visible = false;
+            bool casts_shadows = false;
+        };
+
+        struct RenderSceneSky
+        {
+            ResolvedAsset<Material> material = {};
+            std::vector<ResolvedAsset<Texture>> texture_assets = {};
+            MaterialConfig material_config = {};
+            ParamBindings material_parameters = {};
+            TextureBindings material_textures = {};
+            Mat4 transform = Mat4(1.0F);
+        };
+
         struct RenderScene
         {
             Color clear_color = DefaultClearColor;
             Size render_size = {0U, 0U};
+            float interpolation_alpha = 1.0F;
+            float lod_distance_bias = 1.0F;
             bool has_camera = false;
             Camera camera = {};
             Vec3 camera_position = Vec3(0.0F);
@@ -96,8 +137,98 @@ namespace tbx
             std::optional<PostProcessing> post_processing = std::nullopt;
             std::optional<RenderSky> sky = std::nullopt;
             RenderStage render_stage = RenderStage::FINAL_COLOR;
+            std::vector<RenderSceneItem> items = {};
+            std::optional<RenderSceneSky> sky_source = std::nullopt;
+            ResolvedAsset<Material> fallback_material = {};
+            ResolvedAsset<Material> shadow_material = {};
+            ResolvedAsset<Material> lighting_material = {};
+            ResolvedAsset<Material> post_material = {};
+            std::unordered_set<Uuid> resolved_material_ids = {};
+            std::vector<std::shared_ptr<Shader>> shaders = {};
         };
 
+        template <typename TAsset>
+        ResolvedAsset<TAsset> resolve_asset(AssetManager& asset_manager, const Handle& handle)
+        {
+            if (handle.get_name().empty() && !handle.get_id().is_valid())
+                return {};
+
+            auto resolved = ResolvedAsset<TAsset> {.handle = handle};
+            if (const auto resolved_id = asset_manager.ensure(handle); resolved_id.is_valid())
+                resolved.handle = Handle(handle.get_name(), resolved_id);
+            resolved.asset = asset_manager.load<TAsset>(resolved.handle);
+            return resolved;
+        }
+
+        // Resolves a material and, once per scene, loads its shaders so a backend compiling the
+        // program on the render lane finds them already decoded.
+        ResolvedAsset<Material> resolve_material(
+            AssetManager& asset_manager,
+            const Handle& material_handle,
+            RenderScene& scene)
+        {
+            auto material = resolve_asset<Material>(asset_manager, material_handle);
+            if (!material.asset)
+                return material;
+            if (!scene.resolved_material_ids.insert(material.handle.get_id()).second)
+                return material;
+
+            const auto& program = material.asset->program;
+            const auto shader_handles = std::array<Handle, 5> {
+                program.compute,
+                program.vertex,
+                program.fragment,
+                program.tesselation,
+                program.geometry,
+            };
+            for (const auto& shader_handle : shader_handles)
+            {
+                if (!shader_handle.is_valid())
+                    continue;
+                if (auto shader = asset_manager.load<Shader>(shader_handle))
+                    scene.shaders.push_back(std::move(shader));
+            }
+
+            return material;
+        }
+
+        std::vector<ResolvedAsset<Texture>> resolve_textures(
+            AssetManager& asset_manager,
+            const TextureBindings& material_textures)
+        {
+            auto textures = std::vector<ResolvedAsset<Texture>> {};
+            textures.reserve(material_textures.values.size());
+            for (const auto& texture_binding : material_textures.values)
+            {
+                if (!texture_binding.texture.handle.is_valid())
+                    textures.emplace_back();
+                else
+                    textures.push_back(
+                        resolve_asset<Texture>(asset_manager, texture_binding.texture.handle));
+            }
+
+            return textures;
+        }
+
+        // Copies a live dynamic mesh the first time this mesh instance is seen and reuses the copy
+        // afterwards, which keeps the render cache key stable across frames.
+        DynamicMesh snapshot_dynamic_mesh(
+            const DynamicMesh& live_mesh,
+            std::unordered_map<const Mesh*, DynamicMeshSnapshot>& snapshots)
+        {
+            if (!live_mesh.data)
+                return {};
+
+            auto& snapshot = snapshots[live_mesh.data.get()];
+            if (snapshot.source.lock() != live_mesh.data)
+            {
+                snapshot.source = live_mesh.data;
+                snapshot.copy = std::make_shared<Mesh>(*live_mesh.data);
+            }
+
+            return DynamicMesh(snapshot.copy);
+        }
+
         Vec3 to_vec3(const Color& color)
         {
             return Vec3(color.r, color.g, color.b);
@@ -541,9 +672,16 @@ namespace tbx
             };
         }
 
+        Uuid upload_pass_material(
+            RenderResourceManager& resource_manager,
+            const ResolvedAsset<Material>& material)
+        {
+            return resource_manager.upload_material(material.handle, material.asset, true);
+        }
+
         BackendPassResources build_backend_pass_resources(
             RenderResourceManager& resource_manager,
-            const Size& render_size)
+            const RenderScene& scene)
         {
             auto fallback_texture = Texture {};
             fallback_texture.resolution = {1U, 1U};
@@ -554,18 +692,8 @@ namespace tbx
             fallback_texture.compression = TextureCompression::DISABLED;
             fallback_texture.pixels = {255U, 255U, 255U, 255U};
 
-            auto fallback_material = MaterialInstance {};
-            fallback_material.material = FallbackMagentaMaterialHandle;
-
-            auto lighting_material = MaterialInstance {};
-            lighting_material.material = LightingPassMaterialHandle;
-            auto post_material = MaterialInstance {};
-            post_material.material = PostPassMaterialHandle;
-            auto shadow_material = MaterialInstance {};
-            shadow_material.material = ShadowPassMaterialHandle;
-
             auto scratch_settings = TextureSettings {};
-            scratch_settings.resolution = render_size;
+            scratch_settings.resolution = scene.render_size;
             scratch_settings.filter = TextureFilter::LINEAR;
             scratch_settings.wrap = TextureWrap::CLAMP_TO_EDGE;
             scratch_settings.format = TextureFormat::RGBA;
@@ -576,12 +704,16 @@ namespace tbx
             resources.fallbacks = RenderFallbacks {
                 .white_texture_resource =
                     resource_manager.upload_texture(fallback_texture, WhiteFallbackTextureResource, true),
-                .material_resource = resource_manager.upload_material(fallback_material, true),
+                .material_resource =
+                    upload_pass_material(resource_manager, scene.fallback_material),
                 .mesh_resource = resource_manager.upload_dynamic_mesh(DynamicMesh(cube), true),
             };
-            resources.shadow_shader_program = resource_manager.upload_material(shadow_material, true);
-            resources.lighting_shader_program = resource_manager.upload_material(lighting_material, true);
-            resources.post_shader_program = resource_manager.upload_material(post_material, true);
+            resources.shadow_shader_program =
+                upload_pass_material(resource_manager, scene.shadow_material);
+            resources.lighting_shader_program =
+                upload_pass_material(resource_manager, scene.lighting_material);
+            resources.post_shader_program =
+                upload_pass_material(resource_manager, scene.post_material);
             resources.scratch_color_texture = resource_manager.upload_render_texture(scratch_settings);
             return resources;
         }
@@ -638,7 +770,8 @@ namespace tbx
             scene.directional_lights.reserve(directional_light_entities.size());
             for (const auto& entity : directional_light_entities)
             {
-                const auto world_transform = get_world_space_transform(entity);
+                const auto world_transform =
+                    get_interpolated_world_space_transform(entity, scene.interpolation_alpha);
                 const auto& light = entity.get_component<DirectionalLight>();
                 if (!has_light_radiance(light) && max(light.ambient, 0.0F) <= 0.0001F)
                     continue;
@@ -655,7 +788,8 @@ namespace tbx
             scene.point_lights.reserve(point_light_entities.size());
             for (const auto& entity : point_light_entities)
             {
-                const auto world_transform = get_world_space_transform(entity);
+                const auto world_transform =
+                    get_interpolated_world_space_transform(entity, scene.interpolation_alpha);
                 const auto& light = entity.get_component<PointLight>();
                 if (!has_light_radiance(light))
                     continue;
@@ -674,7 +808,8 @@ namespace tbx
             scene.spot_lights.reserve(spot_light_entities.size());
             for (const auto& entity : spot_light_entities)
             {
-                const auto world_transform = get_world_space_transform(entity);
+                const auto world_transform =
+                    get_interpolated_world_space_transform(entity, scene.interpolation_alpha);
                 const auto& light = entity.get_component<SpotLight>();
                 if (!has_light_radiance(light))
                     continue;
@@ -699,7 +834,8 @@ namespace tbx
             scene.area_lights.reserve(area_light_entities.size());
             for (const auto& entity : area_light_entities)
             {
-                const auto world_transform = get_world_space_transform(entity);
+                const auto world_transform =
+                    get_interpolated_world_space_transform(entity, scene.interpolation_alpha);
                 const auto& light = entity.get_component<AreaLight>();
                 if (!has_light_radiance(light))
                     continue;
@@ -725,9 +861,14 @@ namespace tbx
             }
         }
 
-        void build_post_processing_data(const EntityRegistry& entity_registry, RenderScene& scene)
+        void build_post_processing_data(
+            const EntityRegistry& entity_registry,
+            const GraphicsSettings& settings,
+            RenderScene& scene)
         {
             scene.post_processing.reset();
+            if (!settings.post_processing_enabled.value)
+                return;
 
             const auto post_processing_entities = entity_registry.get_with<PostProcessing>();
             for (const auto& entity : post_processing_entities)
@@ -918,15 +1059,14 @@ namespace tbx
         void collect_render_items(
             const EntityRegistry& entity_registry,
             AssetManager& asset_manager,
-            RenderResourceManager& resource_manager,
+            std::unordered_map<const Mesh*, DynamicMeshSnapshot>& dynamic_mesh_snapshots,
             RenderScene& scene)
         {
             if (!scene.has_camera)
                 return;
 
             const auto entities = entity_registry.get_all();
-            scene.draw_items.reserve(entities.size());
-            scene.shadow_items.reserve(entities.size());
+            scene.items.reserve(entities.size());
             const auto view_frustum = Frustum(scene.view_projection);
 
             for (const auto& entity : entities)
@@ -937,87 +1077,64 @@ namespace tbx
                 auto fallback_material_instance = MaterialInstance {};
                 auto* material_instance = resolve_effective_material_instance(entity, fallback_material_instance);
                 const auto world_transform =
-                    entity.has_component<Transform>() ? get_world_space_transform(entity) : Transform();
+                    entity.has_component<Transform>()
+                        ? get_interpolated_world_space_transform(entity, scene.interpolation_alpha)
+                        : Transform();
                 const auto* lods = entity.has_component<Lods>() ? &entity.get_component<Lods>() : nullptr;
 
                 const auto bounds_radius = max(get_max_component(world_transform.scale), 0.001F);
                 const auto camera_distance_squared =
                     get_distance_squared(world_transform.position, scene.camera_position);
                 const auto camera_distance = sqrt(camera_distance_squared);
-
-                const auto mesh = resolve_render_mesh(entity, lods, camera_distance);
-                const auto mesh_resource = std::visit(
-                    [&resource_manager](const auto& mesh_value)
+                const auto lod_distance = camera_distance / scene.lod_distance_bias;
+
+                const auto material =
+                    resolve_material(asset_manager, material_instance->material, scene);
+                const auto material_config =
+                    resolve_material_config(*material_instance, material.asset);
+                auto material_textures =
+                    resolve_material_textures(*material_instance, material.asset);
+                auto texture_assets = resolve_textures(asset_manager, material_textures);
+
+                // Out-of-range items are still snapshotted so their GPU resources stay resident.
+                auto& item = scene.items.emplace_back(
+                    RenderSceneItem {
+                        .material = material,
+                        .texture_assets = std::move(texture_assets),
+                        .material_config = material_config,
+                        .material_parameters =
+                            resolve_material_parameters(*material_instance, material.asset),
+                        .material_textures = std::move(material_textures),
+                        .transform = build_transform_matrix(world_transform),
+                        .bounds_radius = bounds_radius,
+                        .camera_distance_squared = camera_distance_squared,
+                    });
+                std::visit(
+                    [&](const auto& mesh_value)
                     {
                         using TMesh = std::remove_cvref_t<decltype(mesh_value)>;
                         if constexpr (std::is_same_v<TMesh, DynamicMesh>)
-                            return resource_manager.upload_dynamic_mesh(mesh_value);
+                            item.dynamic_mesh =
+                                snapshot_dynamic_mesh(mesh_value, dynamic_mesh_snapshots);
                         else
-                            return resource_manager.upload_static_mesh(mesh_value);
+                            item.model = resolve_asset<Model>(asset_manager, mesh_value.handle);
                     },
-                    mesh);
-
-                Handle material_handle = material_instance->material;
-                if (material_handle.get_name().empty() && material_handle.get_id().is_valid())
-                    material_handle = Handle(material_handle.get_id());
-                const auto material_asset = asset_manager.load<Material>(material_handle);
-
-                const auto material_config = resolve_material_config(*material_instance, material_asset);
-                const auto material_parameters =
-                    resolve_material_parameters(*material_instance, material_asset);
-                auto material_textures = resolve_material_textures(*material_instance, material_asset);
-                for (auto& texture_binding : material_textures.values)
-                {
-                    if (!texture_binding.texture.handle.is_valid())
-                        continue;
-
-                    const auto texture_resource =
-                        resource_manager.upload_texture(texture_binding.texture.handle);
-                    texture_binding.texture.handle = Handle(
-                        texture_binding.texture.handle.get_name(),
-                        texture_resource);
-                }
-                const auto material_resource = resource_manager.upload_material(*material_instance);
-                const auto casts_shadows = material_config.shadow_mode != ShadowMode::None;
+                    resolve_render_mesh(entity, lods, lod_distance));
 
                 if (lods != nullptr && lods->render_distance > 0.0F
-                    && camera_distance > lods->render_distance)
+                    && lod_distance > lods->render_distance)
                 {
                     continue;
                 }
 
-                const auto is_visible =
+                item.casts_shadows = material_config.shadow_mode != ShadowMode::None;
+                item.is_visible =
                     !material_config.is_cullable
                     || view_frustum.intersects(
                         Sphere {.center = world_transform.position, .radius = bounds_radius});
-                if (!is_visible && !casts_shadows)
+                if (!item.is_visible && !item.casts_shadows)
                     continue;
 
-                if (casts_shadows)
-                {
-                    scene.shadow_items.push_back(
-                        RenderShadowItem {
-                            .mesh_resource = mesh_resource,
-                            .transform = build_transform_matrix(world_transform),
-                            .bounds_radius = bounds_radius,
-                            .is_two_sided = material_config.is_two_sided,
-                        });
-                }
-
-                if (is_visible)
-                {
-                    scene.draw_items.push_back(
-                        RenderDrawItem {
-                            .mesh_resource = mesh_resource,
-                            .material_resource = material_resource,
-                            .material_config = material_config,
-                            .material_parameters = material_parameters,
-                            .material_textures = material_textures,
-                            .transform = build_transform_matrix(world_transform),
-                            .camera_distance_squared = camera_distance_squared,
-                        });
-                }
-
                 if (entity.has_component<MaterialInstance>())
                     entity.get_component<MaterialInstance>().clear_dirty();
             }
@@ -1025,12 +1142,14 @@ namespace tbx
             const auto sky_entities = entity_registry.get_with<Sky>();
             for (const auto& sky_entity : sky_entities)
             {
-                auto sky_material_instance = sky_entity.get_component<Sky>().material;
+                const auto& sky_material_instance = sky_entity.get_component<Sky>().material;
                 const auto& sky_handle = sky_material_instance.get_handle();
                 if (sky_handle.get_name().empty() && !sky_handle.get_id().is_valid())
                     continue;
 
-                const auto material_asset = asset_manager.load<Material>(sky_material_instance.material);
+                auto material =
+                    resolve_material(asset_manager, sky_material_instance.material, scene);
+                const auto& material_asset = material.asset;
                 auto material_config = resolve_material_config(sky_material_instance, material_asset);
                 material_config.depth = MaterialDepthConfig {
                     .is_test_enabled = true,
@@ -1067,58 +1186,159 @@ namespace tbx
                     }
                 }
 
-                for (auto& texture_binding : material_textures.values)
-                {
-                    if (!texture_binding.texture.handle.is_valid())
-                        continue;
-
-                    const auto texture_resource =
-                        resource_manager.upload_texture(texture_binding.texture.handle);
-                    texture_binding.texture.handle = Handle(
-                        texture_binding.texture.handle.get_name(),
-                        texture_resource);
-                }
-
-                const auto sky_material_resource = resource_manager.upload_material(sky_material_instance);
-                const auto sky_mesh_resource = resource_manager.upload_dynamic_mesh(
-                    DynamicMesh(std::make_shared<Mesh>(sky_dome)),
-                    true);
-
-                auto sky_transform = sky_entity.has_component<Transform>()
-                                         ? get_world_space_transform(sky_entity)
-                                         : Transform();
+                auto sky_transform =
+                    sky_entity.has_component<Transform>()
+                        ? get_interpolated_world_space_transform(sky_entity, scene.interpolation_alpha)
+                        : Transform();
                 sky_transform.position = scene.camera_position;
                 const auto base_sky_scale = max(scene.camera_far_plane * 0.45F, 10.0F);
                 const auto sky_scale_multiplier = max(get_max_component(sky_transform.scale), 1.0F);
                 const auto sky_scale = base_sky_scale * sky_scale_multiplier;
                 sky_transform.scale = Vec3(sky_scale, sky_scale, sky_scale);
 
-                scene.sky = RenderSky {
-                    .mesh_resource = sky_mesh_resource,
-                    .material_resource = sky_material_resource,
+                auto texture_assets = resolve_textures(asset_manager, material_textures);
+                scene.sky_source = RenderSceneSky {
+                    .material = std::move(material),
+                    .texture_assets = std::move(texture_assets),
                     .material_config = material_config,
-                    .material_parameters = material_parameters,
-                    .material_textures = material_textures,
+                    .material_parameters = std::move(material_parameters),
+                    .material_textures = std::move(material_textures),
                     .transform = build_transform_matrix(sky_transform),
-                    .camera_distance_squared = std::numeric_limits<float>::max(),
                 };
                 break;
             }
         }
 
+        void upload_material_textures(
+            RenderResourceManager& resource_manager,
+            const std::vector<ResolvedAsset<Texture>>& texture_assets,
+            TextureBindings& material_textures)
+        {
+            const auto binding_count = std::min(material_textures.values.size(), texture_assets.size());
+            for (size texture_index = 0U; texture_index < binding_count; ++texture_index)
+            {
+                auto& texture_binding = material_textures.values[texture_index];
+                if (!texture_binding.texture.handle.is_valid())
+                    continue;
+
+                const auto& texture = texture_assets[texture_index];
+                const auto texture_resource =
+                    resource_manager.upload_texture(texture.handle, texture.asset);
+                texture_binding.texture.handle = Handle(
+                    texture_binding.texture.handle.get_name(),
+                    texture_resource);
+            }
+        }
+
+        // Runs one backend pass inside a profiling zone. `pass_name` must be a string literal.
+        template <typename TPass>
+        RenderPassOutcome run_profiled_pass(const char* pass_name, TPass&& pass)
+        {
+            TBX_PROFILE_SCOPE(pass_name);
+            return pass();
+        }
+
+        // Resolves the snapshotted items into backend resources. Must run on the render lane.
+        void upload_render_items(RenderResourceManager& resource_manager, RenderScene& scene)
+        {
+            scene.draw_items.reserve(scene.items.size());
+            scene.shadow_items.reserve(scene.items.size());
+
+            for (auto& item : scene.items)
+            {
+                const auto mesh_resource =
+                    item.dynamic_mesh.data
+                        ? resource_manager.upload_dynamic_mesh(item.dynamic_mesh)
+                        : resource_manager.upload_static_mesh(item.model.handle, item.model.asset);
+                upload_material_textures(
+                    resource_manager,
+                    item.texture_assets,
+                    item.material_textures);
+                const auto material_resource =
+                    resource_manager.upload_material(item.material.handle, item.material.asset);
+
+                if (item.casts_shadows)
+                {
+                    scene.shadow_items.push_back(
+                        RenderShadowItem {
+                            .mesh_resource = mesh_resource,
+                            .transform = item.transform,
+                            .bounds_radius = item.bounds_radius,
+                            .is_two_sided = item.material_config.is_two_sided,
+                        });
+                }
+
+                if (item.is_visible)
+                {
+                    scene.draw_items.push_back(
+                        RenderDrawItem {
+                            .mesh_resource = mesh_resource,
+                            .material_resource = material_resource,
+                            .material_config = item.material_config,
+                            .material_parameters = std::move(item.material_parameters),
+                            .material_textures = std::move(item.material_textures),
+                            .transform = item.transform,
+                            .camera_distance_squared = item.camera_distance_squared,
+                        });
+                }
+            }
+
+            if (!scene.sky_source.has_value())
+                return;
+
+            auto& sky_source = *scene.sky_source;
+            upload_material_textures(
+                resource_manager,
+                sky_source.texture_assets,
+                sky_source.material_textures);
+            const auto sky_material_resource =
+                resource_manager.upload_material(
+                    sky_source.material.handle,
+                    sky_source.material.asset);
+            const auto sky_mesh_resource = resource_manager.upload_dynamic_mesh(
+                DynamicMesh(std::make_shared<Mesh>(sky_dome)),
+                true);
+
+            scene.sky = RenderSky {
+                .mesh_resource = sky_mesh_resource,
+                .material_resource = sky_material_resource,
+                .material_config = sky_source.material_config,
+                .material_parameters = std::move(sky_source.material_parameters),
+                .material_textures = std::move(sky_source.material_textures),
+                .transform = sky_source.transform,
+                .camera_distance_squared = std::numeric_limits<float>::max(),
+            };
+        }
+
+        // Reads the entity registry, settings, and assets only; GPU uploads happen in
+        // upload_render_items.
         RenderScene build_scene(
             const EntityRegistry& entity_registry,
             AssetManager& asset_manager,
-            RenderResourceManager& resource_manager,
+            std::unordered_map<const Mesh*, DynamicMeshSnapshot>& dynamic_mesh_snapshots,
             const GraphicsSettings& settings,
             const Size& viewport_size,
+            float interpolation_alpha,
             bool& has_reported_missing_camera)
         {
+            TBX_PROFILE_SCOPE("build_scene");
             auto scene = RenderScene();
+            scene.interpolation_alpha = interpolation_alpha;
             scene.render_stage = settings.render_stage.value;
             scene.render_size = settings.resolution.value;
             if (scene.render_size.width == 0U || scene.render_size.height == 0U)
                 scene.render_size = viewport_size;
+            if (const auto render_scale = std::clamp(settings.render_scale.value, 0.1F, 1.0F);
+                render_scale < 1.0F)
+            {
+                scene.render_size.width = max(
+                    static_cast<uint32>(static_cast<float>(scene.render_size.width) * render_scale),
+                    1U);
+                scene.render_size.height = max(
+                    static_cast<uint32>(static_cast<float>(scene.render_size.height) * render_scale),
+                    1U);
+            }
+            scene.lod_distance_bias = max(settings.lod_distance_bias.value, 0.01F);
 
             if (const auto cameras = entity_registry.get_with<Camera, Transform>(); !cameras.empty())
             {
@@ -1126,7 +1346,8 @@ namespace tbx
                 scene.has_camera = true;
                 const auto& camera_entity = cameras.front();
                 auto& camera = camera_entity.get_component<Camera>();
-                const auto camera_transform = get_world_space_transform(camera_entity);
+                const auto camera_transform =
+                    get_interpolated_world_space_transform(camera_entity, scene.interpolation_alpha);
                 if (viewport_size.width > 0U && viewport_size.height > 0U)
                 {
                     const auto aspect =
@@ -1156,8 +1377,15 @@ namespace tbx
 
             build_light_data(entity_registry, scene);
             build_shadow_data(settings, scene);
-            build_post_processing_data(entity_registry, scene);
-            collect_render_items(entity_registry, asset_manager, resource_manager, scene);
+            build_post_processing_data(entity_registry, settings, scene);
+            scene.fallback_material =
+                resolve_material(asset_manager, FallbackMagentaMaterialHandle, scene);
+            scene.shadow_material =
+                resolve_material(asset_manager, ShadowPassMaterialHandle, scene);
+            scene.lighting_material =
+                resolve_material(asset_manager, LightingPassMaterialHandle, scene);
+            scene.post_material = resolve_material(asset_manager, PostPassMaterialHandle, scene);
+            collect_render_items(entity_registry, asset_manager, dynamic_mesh_snapshots, scene);
             return scene;
         }
     }
@@ -1193,6 +1421,7 @@ namespace tbx
 
     RenderingPipeline::~RenderingPipeline() noexcept
     {
+        wait_for_frames_in_flight();
         if (_message_handler_token.is_valid())
             _message_coordinator.deregister_handler(_message_handler_token);
         _thread_manager.stop_lane(RenderLaneName);
@@ -1203,13 +1432,21 @@ namespace tbx
         return _backend.get_api();
     }
 
-    void RenderingPipeline::render()
+    void RenderingPipeline::render(float interpolation_alpha)
     {
+        // Frame N-1 may still be on the render lane; finish it before touching shared render state.
+        wait_for_frames_in_flight();
         sync_windows();
         if (_windows.empty())
             return;
 
         process_asset_reload_queue();
+        std::erase_if(
+            _dynamic_mesh_snapshots,
+            [](const auto& snapshot)
+            {
+                return snapshot.second.source.expired();
+            });
 
         if (!_is_backend_initialized)
         {
@@ -1243,209 +1480,257 @@ namespace tbx
             _is_backend_initialized = true;
         }
 
+        const auto is_pipelined = _settings.pipelined_rendering_enabled.value;
         for (const auto& [window, viewport_size] : _windows)
         {
-            _thread_manager
-                .post_with_future(
-                    RenderLaneName,
-                    [this, window, viewport_size]
+            // The snapshot is built here so the render lane never reads simulation state.
+            auto scene = build_scene(
+                _entity_registry,
+                _asset_manager,
+                _dynamic_mesh_snapshots,
+                _settings,
+                viewport_size,
+                interpolation_alpha,
+                _has_reported_missing_camera);
+
+            auto frame = _thread_manager.post_with_future(
+                RenderLaneName,
+                [this, window, scene = std::move(scene)]() mutable
+                {
+                    if (const auto make_current_result = _context_manager.make_current(window);
+                        !make_current_result)
                     {
-                        if (const auto make_current_result = _context_manager.make_current(window);
-                            !make_current_result)
-                        {
-                            TBX_TRACE_ERROR(
-                                "Graphics rendering: failed to make window {} current: {}",
-                                to_string(window),
-                                make_current_result.get_report());
-                            return;
-                        }
+                        TBX_TRACE_ERROR(
+                            "Graphics rendering: failed to make window {} current: {}",
+                            to_string(window),
+                            make_current_result.get_report());
+                        return;
+                    }
 
-                        const auto scene = build_scene(
-                            _entity_registry,
-                            _asset_manager,
-                            *_resource_manager,
-                            _settings,
-                            viewport_size,
-                            _has_reported_missing_camera);
-
-                        auto opaque_draws = std::vector<RenderDrawItem> {};
-                        auto transparent_draws = std::vector<RenderDrawItem> {};
-                        split_draw_items(scene, opaque_draws, transparent_draws);
-                        const auto backend_resources =
-                            build_backend_pass_resources(*_resource_manager, scene.render_size);
-                        const auto shadow_info = build_shadow_render_info(scene, backend_resources);
-
-                        if (const auto begin_draw_result = _backend.begin_draw(
-                                window,
-                                scene.camera,
-                                scene.render_size);
-                            !begin_draw_result)
-                        {
-                            TBX_TRACE_ERROR(
-                                "Graphics rendering: failed to begin draw for window {}: {}",
-                                to_string(window),
-                                begin_draw_result.get_report());
-                            return;
-                        }
+                    TBX_PROFILE_SCOPE("render window");
+                    {
+                        TBX_PROFILE_SCOPE("upload_render_items");
+                        upload_render_items(*_resource_manager, scene);
+                    }
 
-                        if (const auto clear_result = _backend.clear(scene.clear_color); !clear_result)
-                        {
-                            TBX_TRACE_ERROR(
-                                "Graphics rendering: failed to clear frame for window {}: {}",
-                                to_string(window),
-                                clear_result.get_report());
-                            return;
-                        }
+                    auto opaque_draws = std::vector<RenderDrawItem> {};
+                    auto transparent_draws = std::vector<RenderDrawItem> {};
+                    split_draw_items(scene, opaque_draws, transparent_draws);
+                    const auto backend_resources =
+                        build_backend_pass_resources(*_resource_manager, scene);
+                    const auto shadow_info = build_shadow_render_info(scene, backend_resources);
+
+                    if (const auto begin_draw_result = _backend.begin_draw(
+                            window,
+                            scene.camera,
+                            scene.render_size);
+                        !begin_draw_result)
+                    {
+                        TBX_TRACE_ERROR(
+                            "Graphics rendering: failed to begin draw for window {}: {}",
+                            to_string(window),
+                            begin_draw_result.get_report());
+                        return;
+                    }
 
-                        auto& log_state = _window_render_log_state[window];
+                    if (const auto clear_result = _backend.clear(scene.clear_color); !clear_result)
+                    {
+                        TBX_TRACE_ERROR(
+                            "Graphics rendering: failed to clear frame for window {}: {}",
+                            to_string(window),
+                            clear_result.get_report());
+                        return;
+                    }
 
-                        auto report_pass_outcome =
-                            [&](const char* pass_name,
-                                const RenderPassOutcome& outcome,
-                                RenderPassLogState& pass_log_state)
-                        {
-                            if (outcome.is_success())
-                            {
-                                if (pass_log_state.status != RenderPassStatus::Success)
-                                {
-                                    TBX_TRACE_INFO(
-                                        "Graphics rendering: {} recovered for window {}.",
-                                        pass_name,
-                                        to_string(window));
-                                }
-
-                                pass_log_state.status = RenderPassStatus::Success;
-                                pass_log_state.diagnostics.clear();
-                                return;
-                            }
+                    auto& log_state = _window_render_log_state[window];
 
-                            const auto diagnostics =
-                                outcome.diagnostics.empty() ? std::string("(no diagnostics)")
-                                                            : outcome.diagnostics;
-                            const auto is_repeated = pass_log_state.status == outcome.status
-                                                     && pass_log_state.diagnostics == diagnostics;
-                            pass_log_state.status = outcome.status;
-                            pass_log_state.diagnostics = diagnostics;
-                            if (is_repeated)
-                                return;
-
-                            if (outcome.is_fatal())
+                    auto report_pass_outcome =
+                        [&](const char* pass_name,
+                            const RenderPassOutcome& outcome,
+                            RenderPassLogState& pass_log_state)
+                    {
+                        if (outcome.is_success())
+                        {
+                            if (pass_log_state.status != RenderPassStatus::Success)
                             {
-                                TBX_TRACE_ERROR(
-                                    "Graphics rendering: {} reported {} status for window {}: {}",
+                                TBX_TRACE_INFO(
+                                    "Graphics rendering: {} recovered for window {}.",
                                     pass_name,
-                                    to_string(outcome.status),
-                                    to_string(window),
-                                    diagnostics);
-                                return;
+                                    to_string(window));
                             }
 
-                            TBX_TRACE_WARNING(
+                            pass_log_state.status = RenderPassStatus::Success;
+                            pass_log_state.diagnostics.clear();
+                            return;
+                        }
+
+                        const auto diagnostics =
+                            outcome.diagnostics.empty() ? std::string("(no diagnostics)")
+                                                        : outcome.diagnostics;
+                        const auto is_repeated = pass_log_state.status == outcome.status
+                                                 && pass_log_state.diagnostics == diagnostics;
+                        pass_log_state.status = outcome.status;
+                        pass_log_state.diagnostics = diagnostics;
+                        if (is_repeated)
+                            return;
+
+                        if (outcome.is_fatal())
+                        {
+                            TBX_TRACE_ERROR(
                                 "Graphics rendering: {} reported {} status for window {}: {}",
                                 pass_name,
                                 to_string(outcome.status),
                                 to_string(window),
                                 diagnostics);
-                        };
+                            return;
+                        }
 
-                        auto should_render_fallback_frame = !scene.has_camera;
+                        TBX_TRACE_WARNING(
+                            "Graphics rendering: {} reported {} status for window {}: {}",
+                            pass_name,
+                            to_string(outcome.status),
+                            to_string(window),
+                            diagnostics);
+                    };
 
-                        const auto shadow_outcome = _backend.draw_shadows(shadow_info);
-                        report_pass_outcome("shadow pass", shadow_outcome, log_state.shadows);
+                    auto should_render_fallback_frame = !scene.has_camera;
 
-                        const auto geometry_outcome =
-                            _backend.draw_geometry(build_geometry_render_info(
+                    const auto shadow_outcome = run_profiled_pass(
+                        "shadow pass",
+                        [&]()
+                        {
+                            return _backend.draw_shadows(shadow_info);
+                        });
+                    report_pass_outcome("shadow pass", shadow_outcome, log_state.shadows);
+
+                    const auto geometry_outcome = run_profiled_pass(
+                        "geometry pass",
+                        [&]()
+                        {
+                            return _backend.draw_geometry(build_geometry_render_info(
                                 scene,
                                 std::move(opaque_draws),
                                 backend_resources));
-                        report_pass_outcome("geometry pass", geometry_outcome, log_state.geometry);
-                        if (geometry_outcome.is_fatal())
-                            should_render_fallback_frame = true;
+                        });
+                    report_pass_outcome("geometry pass", geometry_outcome, log_state.geometry);
+                    if (geometry_outcome.is_fatal())
+                        should_render_fallback_frame = true;
 
-                        if (scene.has_camera && !should_render_fallback_frame)
-                        {
-                            const auto lighting_outcome =
-                                _backend.draw_lighting(build_lighting_render_info(scene, backend_resources));
-                            report_pass_outcome("lighting pass", lighting_outcome, log_state.lighting);
-                            if (lighting_outcome.is_fatal())
-                            {
-                                should_render_fallback_frame = true;
-                            }
-                            else
+                    if (scene.has_camera && !should_render_fallback_frame)
+                    {
+                        const auto lighting_outcome = run_profiled_pass(
+                            "lighting pass",
+                            [&]()
                             {
-                                const auto transparent_outcome = _backend.draw_transparent(
-                                    build_transparent_render_info(
-                                        scene,
-                                        std::move(transparent_draws),
-                                        backend_resources));
-                                report_pass_outcome(
-                                    "transparent pass",
-                                    transparent_outcome,
-                                    log_state.transparency);
-
-                                const auto post_outcome = _backend.apply_post_processing(
-                                    PostProcessingPass {
-                                        .post_processing = scene.post_processing,
-                                        .post_shader_program = backend_resources.post_shader_program,
-                                        .scratch_color_texture = backend_resources.scratch_color_texture,
-                                        .fallbacks = backend_resources.fallbacks,
-                                    });
-                                report_pass_outcome(
-                                    "post-processing pass",
-                                    post_outcome,
-                                    log_state.post_processing);
-                            }
-                        }
-
-                        if (should_render_fallback_frame)
+                                return _backend.draw_lighting(
+                                    build_lighting_render_info(scene, backend_resources));
+                            });
+                        report_pass_outcome("lighting pass", lighting_outcome, log_state.lighting);
+                        if (lighting_outcome.is_fatal())
                         {
-                            if (!log_state.has_reported_fallback)
-                            {
-                                TBX_TRACE_WARNING(
-                                    "Graphics rendering: rendering fallback frame for window {}.",
-                                    to_string(window));
-                                log_state.has_reported_fallback = true;
-                            }
-
-                            if (const auto fallback_result =
-                                    _backend.clear(PipelineFallbackFrameColor);
-                                !fallback_result)
-                            {
-                                TBX_TRACE_ERROR(
-                                    "Graphics rendering: failed to clear fallback frame for window {}: {}",
-                                    to_string(window),
-                                    fallback_result.get_report());
-                            }
+                            should_render_fallback_frame = true;
                         }
                         else
                         {
-                            log_state.has_reported_fallback = false;
+                            const auto transparent_outcome = run_profiled_pass(
+                                "transparent pass",
+                                [&]()
+                                {
+                                    return _backend.draw_transparent(build_transparent_render_info(
+                                        scene,
+                                        std::move(transparent_draws),
+                                        backend_resources));
+                                });
+                            report_pass_outcome(
+                                "transparent pass",
+                                transparent_outcome,
+                                log_state.transparency);
+
+                            const auto post_outcome = run_profiled_pass(
+                                "post-processing pass",
+                                [&]()
+                                {
+                                    return _backend.apply_post_processing(
+                                        PostProcessingPass {
+                                            .post_processing = scene.post_processing,
+                                            .post_shader_program =
+                                                backend_resources.post_shader_program,
+                                            .scratch_color_texture =
+                                                backend_resources.scratch_color_texture,
+                                            .fallbacks = backend_resources.fallbacks,
+                                        });
+                                });
+                            report_pass_outcome(
+                                "post-processing pass",
+                                post_outcome,
+                                log_state.post_processing);
                         }
+                    }
 
-                        if (const auto end_draw_result = _backend.end_draw(); !end_draw_result)
+                    if (should_render_fallback_frame)
+                    {
+                        if (!log_state.has_reported_fallback)
                         {
-                            TBX_TRACE_ERROR(
-                                "Graphics rendering: failed to end draw for window {}: {}",
-                                to_string(window),
-                                end_draw_result.get_report());
-                            return;
+                            TBX_TRACE_WARNING(
+                                "Graphics rendering: rendering fallback frame for window {}.",
+                                to_string(window));
+                            log_state.has_reported_fallback = true;
                         }
 
-                        if (const auto present_result = _context_manager.present(window);
-                            !present_result)
+                        if (const auto fallback_result =
+                                _backend.clear(PipelineFallbackFrameColor);
+                            !fallback_result)
                         {
                             TBX_TRACE_ERROR(
-                                "Graphics rendering: present failed for window {}: {}",
+                                "Graphics rendering: failed to clear fallback frame for window {}: {}",
                                 to_string(window),
-                                present_result.get_report());
+                                fallback_result.get_report());
                         }
+                    }
+                    else
+                    {
+                        log_state.has_reported_fallback = false;
+                    }
 
-                        _resource_manager->clear_unused();
-                    })
-                .get();
+                    if (const auto end_draw_result = _backend.end_draw(); !end_draw_result)
+                    {
+                        TBX_TRACE_ERROR(
+                            "Graphics rendering: failed to end draw for window {}: {}",
+                            to_string(window),
+                            end_draw_result.get_report());
+                        return;
+                    }
+
+                    if (const auto present_result = _context_manager.present(window);
+                        !present_result)
+                    {
+                        TBX_TRACE_ERROR(
+                            "Graphics rendering: present failed for window {}: {}",
+                            to_string(window),
+                            present_result.get_report());
+                    }
+
+                    _resource_manager->clear_unused();
+                });
+
+            if (is_pipelined)
+                _frames_in_flight.push_back(std::move(frame));
+            else
+                frame.get();
         }
     }
 
+    void RenderingPipeline::wait_for_frames_in_flight()
+    {
+        for (auto& frame : _frames_in_flight)
+        {
+            if (frame.valid())
+                frame.get();
+        }
+
+        _frames_in_flight.clear();
+    }
+
     void RenderingPipeline::handle_message(Message& message)
     {
         if (const auto* asset_reloaded = tbx::handle_message<AssetReloadedEvent>(message))
@@ -1529,16 +1814,21 @@ namespace tbx
         return _pipeline->get_active_api();
     }
 
-    void Rendering::render()
+    void Rendering::render(float interpolation_alpha)
     {
         if (_settings.graphics_api.value != _backend.get_api())
             return;
 
-        _pipeline->render();
+        _pipeline->render(interpolation_alpha);
     }
 
     void Rendering::set_api(const GraphicsApi& api)
     {
         _settings.graphics_api = api;
     }
+
+    void Rendering::wait_for_frames_in_flight()
+    {
+        _pipeline->wait_for_frames_in_flight();
+    }
 }
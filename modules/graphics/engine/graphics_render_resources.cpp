@@ -458,9 +458,23 @@ namespace tbx
 
     Uuid RenderResourceManager::upload_static_mesh(const StaticMesh& static_mesh, const bool pin)
     {
-        const auto now = std::chrono::steady_clock::now();
         const auto resolved_mesh_handle = resolve_asset_handle(static_mesh.handle, _asset_manager);
-        const auto key = make_static_mesh_key(resolved_mesh_handle);
+        if (!make_static_mesh_key(resolved_mesh_handle).is_valid())
+            return {};
+
+        return upload_static_mesh(
+            resolved_mesh_handle,
+            _asset_manager.load<Model>(resolved_mesh_handle),
+            pin);
+    }
+
+    Uuid RenderResourceManager::upload_static_mesh(
+        const Handle& model_handle,
+        const std::shared_ptr<Model>& model,
+        const bool pin)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const auto key = make_static_mesh_key(model_handle);
         if (!key.is_valid())
             return {};
 
@@ -472,7 +486,6 @@ namespace tbx
             return get_backend_resource_uuid(key);
         }
 
-        const auto model = _asset_manager.load<Model>(resolved_mesh_handle);
         if (!model || model->meshes.empty())
             return {};
 
@@ -481,7 +494,7 @@ namespace tbx
         {
             TBX_TRACE_WARNING(
                 "Graphics rendering: failed to build render geometry for model '{}'.",
-                resolved_mesh_handle.get_name().c_str());
+                model_handle.get_name().c_str());
             return {};
         }
 
@@ -505,14 +518,25 @@ namespace tbx
     {
         const auto resolved_material_handle =
             resolve_asset_handle(material_instance.material, _asset_manager);
-        if (!resolved_material_handle.is_valid())
+        return upload_material(
+            resolved_material_handle,
+            get_material_asset(resolved_material_handle),
+            pin);
+    }
+
+    Uuid RenderResourceManager::upload_material(
+        const Handle& material_handle,
+        const std::shared_ptr<Material>& material,
+        const bool pin)
+    {
+        if (!material_handle.is_valid())
         {
             TBX_TRACE_WARNING("Graphics rendering: material handle is invalid.");
             return {};
         }
 
         const auto now = std::chrono::steady_clock::now();
-        const auto program_key = make_material_program_key(resolved_material_handle);
+        const auto program_key = make_material_program_key(material_handle);
         if (!program_key.is_valid())
             return {};
 
@@ -524,7 +548,7 @@ namespace tbx
                 _pinned_resources.insert(program_key);
             has_program = true;
         }
-        else if (const auto material = get_material_asset(resolved_material_handle))
+        else if (material)
         {
             const auto shader_handles = std::vector<Handle> {
                 material->program.compute,
@@ -550,14 +574,14 @@ namespace tbx
             {
                 TBX_TRACE_WARNING(
                     "Graphics rendering: failed to build material resource for '{}'.",
-                    resolved_material_handle.get_id().value);
+                    material_handle.get_id().value);
             }
         }
         else
         {
             TBX_TRACE_WARNING(
                 "Graphics rendering: failed to load material '{}'.",
-                resolved_material_handle.get_id().value);
+                material_handle.get_id().value);
         }
 
         if (has_program)
@@ -656,7 +680,21 @@ namespace tbx
     Uuid RenderResourceManager::upload_texture(const Handle& texture_handle, const bool pin)
     {
         const auto resolved_texture_handle = resolve_asset_handle(texture_handle, _asset_manager);
-        const auto key = make_texture_key(resolved_texture_handle);
+        if (!make_texture_key(resolved_texture_handle).is_valid())
+            return {};
+
+        return upload_texture(
+            resolved_texture_handle,
+            _asset_manager.load<Texture>(resolved_texture_handle),
+            pin);
+    }
+
+    Uuid RenderResourceManager::upload_texture(
+        const Handle& texture_handle,
+        const std::shared_ptr<Texture>& texture,
+        const bool pin)
+    {
+        const auto key = make_texture_key(texture_handle);
         if (!key.is_valid())
             return {};
 
@@ -669,7 +707,6 @@ namespace tbx
             return get_backend_resource_uuid(key);
         }
 
-        const auto texture = _asset_manager.load<Texture>(resolved_texture_handle);
         if (!texture)
             return {};
 
@@ -1,7 +1,9 @@
 #pragma once
+#include "tbx/common/typedefs.h"
 #include "tbx/graphics/api.h"
 #include "tbx/graphics/window.h"
 #include "tbx/messages/message.h"
+#include <chrono>
 #include <string>
 
 namespace tbx
@@ -104,4 +106,41 @@ namespace tbx
         NativeWindowHandle current = nullptr;
     };
 
+    /// @brief
+    /// Purpose: Signals that a managed window native handle is about to be destroyed, so consumers
+    /// still presenting to it (such as a pipelined render lane) can finish first.
+    /// @details
+    /// Ownership: Copies the window id and non-owning handle value by value.
+    /// Thread Safety: Delivered on the dispatcher thread before the handle is released.
+    struct TBX_API WindowNativeHandleReleasingEvent : public Event
+    {
+        WindowNativeHandleReleasingEvent(const Window& window_id, NativeWindowHandle handle);
+        ~WindowNativeHandleReleasingEvent() noexcept override;
+
+        Window window = {};
+        NativeWindowHandle native_handle = nullptr;
+    };
+
+    /// @brief
+    /// Purpose: Signals that the adaptive quality controller moved a quality knob to a new level.
+    /// @details
+    /// Ownership: Copies the knob name and timing values by value.
+    /// Thread Safety: Delivered on the dispatcher thread. Notes: Level 0 is full quality; higher
+    /// levels are cheaper.
+    struct TBX_API QualityLevelChangedEvent : public Event
+    {
+        QualityLevelChangedEvent(
+            std::string knob_name,
+            uint previous_level,
+            uint current_level,
+            std::chrono::nanoseconds average_time,
+            std::chrono::nanoseconds target_time);
+        ~QualityLevelChangedEvent() noexcept override;
+
+        std::string knob = {};
+        uint previous = 0U;
+        uint current = 0U;
+        std::chrono::nanoseconds average_frame_time = {};
+        std::chrono::nanoseconds target_frame_time = {};
+    };
 }
@@ -0,0 +1,154 @@
+#pragma once
+#include "tbx/common/typedefs.h"
+#include "tbx/graphics/settings.h"
+#include "tbx/messages/dispatcher.h"
+#include "tbx/tbx_api.h"
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Describes one quality setting the adaptive quality controller may step through.
+    /// @details
+    /// Ownership: Owns its name and apply callback; the callback may borrow external settings
+    /// that must outlive the controller.
+    /// Thread Safety: Not thread-safe; used on the thread that drives the controller.
+    struct TBX_API QualityKnob
+    {
+        std::string name = {};
+
+        // Number of discrete levels. Level 0 is full quality and each higher level is cheaper.
+        uint level_count = 1U;
+
+        // Applies a level in [0, level_count).
+        std::function<void(uint level)> apply = {};
+    };
+
+    /// @brief
+    /// Purpose: Tunes when the adaptive quality controller lowers or raises quality.
+    /// @details
+    /// Ownership: Value type owned by callers and by AppSettings.
+    /// Thread Safety: Safe for concurrent reads; synchronize concurrent writes externally.
+    struct TBX_API QualityControllerSettings
+    {
+        bool is_enabled = false;
+
+        // Frame time the controller tries to hold.
+        std::chrono::nanoseconds target_frame_time = std::chrono::microseconds(16667);
+
+        // Quality drops when the windowed average frame time exceeds target * downgrade_ratio and
+        // rises when it falls below target * upgrade_ratio. The gap between them is the
+        // hysteresis band that keeps the controller from oscillating.
+        double downgrade_ratio = 1.1;
+        double upgrade_ratio = 0.75;
+
+        // Frames averaged for each decision.
+        uint window_frame_count = 30U;
+
+        // Frames ignored after a change so its effect settles before the next decision.
+        uint cooldown_frame_count = 60U;
+    };
+
+    /// @brief
+    /// Purpose: Records a single level change made by the adaptive quality controller.
+    /// @details
+    /// Ownership: Owns the copied knob name.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API QualityDecision
+    {
+        std::string knob = {};
+        uint previous_level = 0U;
+        uint current_level = 0U;
+        std::chrono::nanoseconds average_frame_time = {};
+    };
+
+    /// @brief
+    /// Purpose: Summarizes the adaptive quality controller's activity for tuning.
+    /// @details
+    /// Ownership: Owns the copied last decision.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API QualityControllerStats
+    {
+        uint64 frame_count = 0U;
+        uint downgrade_count = 0U;
+        uint upgrade_count = 0U;
+        std::chrono::nanoseconds last_average_frame_time = {};
+        std::optional<QualityDecision> last_decision = std::nullopt;
+    };
+
+    /// @brief
+    /// Purpose: Tracks the level a registered quality knob currently sits at.
+    /// @details
+    /// Ownership: Owns the knob and its callback.
+    /// Thread Safety: Not thread-safe; owned by a QualityController.
+    struct TBX_API QualityKnobState
+    {
+        QualityKnob knob = {};
+        uint level = 0U;
+    };
+
+    /// @brief
+    /// Purpose: Holds a target frame time by stepping registered quality knobs down when frames run
+    /// long and back up when there is headroom.
+    /// @details
+    /// Ownership: Owns registered knobs; borrows the optional dispatcher, which must outlive it.
+    /// Thread Safety: Not thread-safe; drive it from the main loop thread.
+    /// Each decision moves one knob by one level. Downgrades pick the knob at the lowest level,
+    /// preferring earlier registrations, and upgrades undo them in reverse, so knobs registered
+    /// first are the first to drop and the last to recover.
+    class TBX_API QualityController
+    {
+      public:
+        QualityController(
+            QualityControllerSettings settings = {},
+            IMessageDispatcher* dispatcher = nullptr);
+
+      public:
+        const QualityControllerSettings& get_settings() const;
+        void set_settings(const QualityControllerSettings& settings);
+
+        void set_dispatcher(IMessageDispatcher* dispatcher);
+
+        // Registers a knob at level 0. Knobs with fewer than two levels or no callback are ignored.
+        void add_knob(QualityKnob knob);
+        void clear_knobs();
+
+        // Returns the knob's current level, or 0 when no knob has that name.
+        uint get_level(std::string_view knob_name) const;
+
+        // Feeds one frame time. Returns the decision when this frame changed a knob.
+        std::optional<QualityDecision> record_frame(std::chrono::nanoseconds frame_time);
+
+        const QualityControllerStats& get_stats() const;
+
+        // Restores every knob to full quality and clears the frame window and statistics.
+        void reset();
+
+      private:
+        std::optional<QualityDecision> change_level(bool is_downgrade);
+
+      private:
+        QualityControllerSettings _settings = {};
+        IMessageDispatcher* _dispatcher = nullptr;
+        std::vector<QualityKnobState> _knobs = {};
+        std::chrono::nanoseconds _window_total = {};
+        uint _window_count = 0U;
+        uint _cooldown_remaining = 0U;
+        QualityControllerStats _stats = {};
+    };
+
+    /// @brief
+    /// Purpose: Registers the engine's graphics quality knobs: shadow map resolution, LOD distance
+    /// bias, shadow distance, post-processing, and render resolution scale, in that order.
+    /// @details
+    /// Ownership: The knobs borrow `settings`, which must outlive `controller`. Each knob re-reads
+    /// its setting as the full-quality base when it leaves level 0, so changes made at full
+    /// quality are kept.
+    /// Thread Safety: Not thread-safe; call on the main thread.
+    TBX_API void add_graphics_quality_knobs(QualityController& controller, GraphicsSettings& settings);
+}
@@ -16,6 +16,7 @@
 #include "tbx/messages/dispatcher.h"
 #include "tbx/messages/message.h"
 #include "tbx/tbx_api.h"
+#include <future>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -80,6 +81,14 @@ namespace tbx
         float camera_distance_squared = 0.0F;
     };
 
+    // Pairs a live DynamicMesh with the private copy the render lane uploads from, so simulation
+    // code can keep writing the live mesh while a pipelined frame is still drawing.
+    struct TBX_API DynamicMeshSnapshot
+    {
+        std::weak_ptr<Mesh> source = {};
+        std::shared_ptr<Mesh> copy = {};
+    };
+
     struct TBX_API RenderFallbacks
     {
         Uuid white_texture_resource = {};
@@ -320,7 +329,12 @@ namespace tbx
     /// @details
     /// Ownership: Borrows engine systems and the active graphics backend.
     /// Thread Safety: Public calls are expected from the main thread; rendering runs on the
-    /// configured render lane.
+    /// configured render lane. Scene snapshots are built on the calling thread, so with
+    /// `GraphicsSettings::pipelined_rendering_enabled` the render lane draws frame N while the
+    /// caller simulates frame N+1, and the next `render(...)` waits for frame N first. Snapshots
+    /// carry resolved assets and copies of dynamic meshes; the render lane never loads assets or
+    /// reads components. A dynamic mesh is copied once per mesh instance, so assign a new mesh to
+    /// change rendered geometry.
     class TBX_API RenderingPipeline final
     {
       public:
@@ -338,7 +352,14 @@ namespace tbx
 
       public:
         GraphicsApi get_active_api() const;
-        void render();
+
+        // `interpolation_alpha` is the fraction of a fixed step elapsed since the last one ran;
+        // entities with a TransformInterpolation component are drawn blended by it.
+        void render(float interpolation_alpha);
+
+        // Blocks until pipelined frames still on the render lane have presented. Call before
+        // tearing down a window or backend those frames may be drawing to.
+        void wait_for_frames_in_flight();
 
       private:
         void handle_message(Message& message);
@@ -379,6 +400,8 @@ namespace tbx
         std::vector<Handle> _pending_asset_reloads = {};
         mutable bool _has_reported_missing_camera = false;
         std::unordered_map<Window, WindowRenderLogState> _window_render_log_state = {};
+        std::vector<std::future<void>> _frames_in_flight = {};
+        std::unordered_map<const Mesh*, DynamicMeshSnapshot> _dynamic_mesh_snapshots = {};
     };
 
     /// @brief
@@ -393,8 +416,9 @@ namespace tbx
 
       public:
         virtual GraphicsApi get_active_api() const = 0;
-        virtual void render() = 0;
+        virtual void render(float interpolation_alpha) = 0;
         virtual void set_api(const GraphicsApi& api) = 0;
+        virtual void wait_for_frames_in_flight() = 0;
     };
 
     /// @brief
@@ -420,7 +444,8 @@ namespace tbx
       public:
         GraphicsApi get_active_api() const override;
         void set_api(const GraphicsApi& api) override;
-        void render() override;
+        void render(float interpolation_alpha) override;
+        void wait_for_frames_in_flight() override;
 
       private:
         GraphicsSettings& _settings;
@@ -4,6 +4,7 @@
 #include "tbx/common/uuid.h"
 #include "tbx/graphics/material.h"
 #include "tbx/graphics/mesh.h"
+#include "tbx/graphics/model.h"
 #include "tbx/graphics/texture.h"
 #include "tbx/tbx_api.h"
 #include <chrono>
@@ -33,6 +34,23 @@ namespace tbx
         Uuid upload_texture(const Texture& texture, const Uuid& resource_uuid, bool pin = false);
         Uuid upload_texture(const Handle& texture_handle, bool pin = false);
         Uuid upload_render_texture(const TextureSettings& texture_settings, bool pin = false);
+
+        // These overloads take handles and assets the caller already resolved, so they never touch
+        // the asset manager and are safe to use on the render lane while the simulation runs.
+        Uuid upload_static_mesh(
+            const Handle& model_handle,
+            const std::shared_ptr<Model>& model,
+            bool pin = false);
+        Uuid upload_material(
+            const Handle& material_handle,
+            const std::shared_ptr<Material>& material,
+            bool pin = false);
+        Uuid upload_texture(
+            const Handle& texture_handle,
+            const std::shared_ptr<Texture>& texture,
+            bool pin = false);
+
+      public:
         void unload(const Uuid& resource_uuid);
         void on_asset_reloaded(const Handle& asset_handle);
         void pin(const Uuid& resource_uuid);
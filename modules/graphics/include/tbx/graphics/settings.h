@@ -37,7 +37,8 @@ namespace tbx
             RenderStage render_stage = RenderStage::FINAL_COLOR,
             uint32 shadow_map_resolution = 2048U,
             float shadow_render_distance = 90.0F,
-            float shadow_softness = 1.0F);
+            float shadow_softness = 1.0F,
+            bool pipelined_rendering = false);
 
         /// @brief
         /// Purpose: Toggles presentation sync with the display refresh rate.
@@ -89,5 +90,39 @@ namespace tbx
         /// Ownership: Value owned by this settings object.
         /// Thread Safety: Not thread-safe; synchronize access externally.
         Observable<GraphicsSettings, float> shadow_softness;
+
+        /// @brief
+        /// Purpose: Lets the render lane draw frame N while the main thread simulates frame N+1.
+        /// Presented frames trail the simulation by exactly one frame in exchange for overlapping
+        /// CPU work; disable it when input-to-photon latency matters more than throughput.
+        /// @details
+        /// Ownership: Value owned by this settings object.
+        /// Thread Safety: Not thread-safe; synchronize access externally. Changes take effect on
+        /// the next rendered frame.
+        Observable<GraphicsSettings, bool> pipelined_rendering_enabled;
+
+        /// @brief
+        /// Purpose: Scales the internal render resolution, e.g. 0.5 renders at half width and
+        /// height before presentation. Values are clamped to [0.1, 1].
+        /// @details
+        /// Ownership: Value owned by this settings object.
+        /// Thread Safety: Not thread-safe; synchronize access externally.
+        Observable<GraphicsSettings, float> render_scale;
+
+        /// @brief
+        /// Purpose: Multiplies every Lods band and render distance. Values below 1 switch to
+        /// coarser LODs and stop drawing LOD-limited meshes closer to the camera.
+        /// @details
+        /// Ownership: Value owned by this settings object.
+        /// Thread Safety: Not thread-safe; synchronize access externally.
+        Observable<GraphicsSettings, float> lod_distance_bias;
+
+        /// @brief
+        /// Purpose: Enables post-processing stacks. When disabled the scene is presented without
+        /// running any PostProcessing effects.
+        /// @details
+        /// Ownership: Value owned by this settings object.
+        /// Thread Safety: Not thread-safe; synchronize access externally.
+        Observable<GraphicsSettings, bool> post_processing_enabled;
     };
 }
@@ -76,9 +76,9 @@ namespace tbx
             TextureWrap wrap,
             TextureFilter filter,
             TextureFormat format,
-            const std::vector<Pixel>& pixels)
+            std::vector<Pixel> pixels)
             : TextureSettings {.resolution = resolution, .wrap = wrap, .filter = filter, .format = format}
-            , pixels(pixels)
+            , pixels(std::move(pixels))
         {
         }
         Texture(
@@ -88,7 +88,7 @@ namespace tbx
             TextureFormat format,
             TextureMipmaps mipmaps,
             TextureCompression compression,
-            const std::vector<Pixel>& pixels)
+            std::vector<Pixel> pixels)
             : TextureSettings {
                 .resolution = resolution,
                 .wrap = wrap,
@@ -97,7 +97,7 @@ namespace tbx
                 .mipmaps = mipmaps,
                 .compression = compression,
             }
-            , pixels(pixels)
+            , pixels(std::move(pixels))
         {
         }
 
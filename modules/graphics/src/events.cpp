@@ -63,4 +63,30 @@ namespace tbx
     }
 
     WindowNativeHandleChangedEvent::~WindowNativeHandleChangedEvent() noexcept = default;
+
+    WindowNativeHandleReleasingEvent::WindowNativeHandleReleasingEvent(
+        const Window& window_id,
+        NativeWindowHandle handle)
+        : window(window_id)
+        , native_handle(handle)
+    {
+    }
+
+    WindowNativeHandleReleasingEvent::~WindowNativeHandleReleasingEvent() noexcept = default;
+
+    QualityLevelChangedEvent::QualityLevelChangedEvent(
+        std::string knob_name,
+        uint previous_level,
+        uint current_level,
+        std::chrono::nanoseconds average_time,
+        std::chrono::nanoseconds target_time)
+        : knob(std::move(knob_name))
+        , previous(previous_level)
+        , current(current_level)
+        , average_frame_time(average_time)
+        , target_frame_time(target_time)
+    {
+    }
+
+    QualityLevelChangedEvent::~QualityLevelChangedEvent() noexcept = default;
 }
@@ -10,7 +10,8 @@ namespace tbx
         RenderStage render_stage,
         uint32 shadow_map_resolution,
         float shadow_render_distance,
-        float shadow_softness)
+        float shadow_softness,
+        bool pipelined_rendering)
         : vsync_enabled(&dispatcher, this, &GraphicsSettings::vsync_enabled, vsync)
         , graphics_api(&dispatcher, this, &GraphicsSettings::graphics_api, api)
         , resolution(&dispatcher, this, &GraphicsSettings::resolution, resolution)
@@ -26,6 +27,18 @@ namespace tbx
               &GraphicsSettings::shadow_render_distance,
               shadow_render_distance)
         , shadow_softness(&dispatcher, this, &GraphicsSettings::shadow_softness, shadow_softness)
+        , pipelined_rendering_enabled(
+              &dispatcher,
+              this,
+              &GraphicsSettings::pipelined_rendering_enabled,
+              pipelined_rendering)
+        , render_scale(&dispatcher, this, &GraphicsSettings::render_scale, 1.0F)
+        , lod_distance_bias(&dispatcher, this, &GraphicsSettings::lod_distance_bias, 1.0F)
+        , post_processing_enabled(
+              &dispatcher,
+              this,
+              &GraphicsSettings::post_processing_enabled,
+              true)
     {
     }
 }
@@ -0,0 +1,244 @@
+#include "tbx/graphics/quality_controller.h"
+#include "tbx/graphics/events.h"
+#include <algorithm>
+#include <array>
+#include <functional>
+
+namespace tbx
+{
+    QualityController::QualityController(
+        QualityControllerSettings settings,
+        IMessageDispatcher* dispatcher)
+        : _settings(settings)
+        , _dispatcher(dispatcher)
+    {
+    }
+
+    const QualityControllerSettings& QualityController::get_settings() const
+    {
+        return _settings;
+    }
+
+    void QualityController::set_settings(const QualityControllerSettings& settings)
+    {
+        _settings = settings;
+        _window_total = {};
+        _window_count = 0U;
+    }
+
+    void QualityController::set_dispatcher(IMessageDispatcher* dispatcher)
+    {
+        _dispatcher = dispatcher;
+    }
+
+    void QualityController::add_knob(QualityKnob knob)
+    {
+        if (knob.level_count < 2U || !knob.apply)
+            return;
+
+        _knobs.push_back(QualityKnobState {.knob = std::move(knob)});
+    }
+
+    void QualityController::clear_knobs()
+    {
+        _knobs.clear();
+    }
+
+    uint QualityController::get_level(std::string_view knob_name) const
+    {
+        for (const auto& state : _knobs)
+        {
+            if (state.knob.name == knob_name)
+                return state.level;
+        }
+        return 0U;
+    }
+
+    std::optional<QualityDecision> QualityController::record_frame(
+        std::chrono::nanoseconds frame_time)
+    {
+        ++_stats.frame_count;
+        if (!_settings.is_enabled || _knobs.empty())
+            return std::nullopt;
+
+        if (_cooldown_remaining > 0U)
+        {
+            --_cooldown_remaining;
+            return std::nullopt;
+        }
+
+        _window_total += frame_time;
+        ++_window_count;
+        if (_window_count < std::max(_settings.window_frame_count, 1U))
+            return std::nullopt;
+
+        const auto average = _window_total / static_cast<int64>(_window_count);
+        _stats.last_average_frame_time = average;
+        _window_total = {};
+        _window_count = 0U;
+
+        const auto target = static_cast<double>(_settings.target_frame_time.count());
+        const auto average_count = static_cast<double>(average.count());
+        if (average_count > target * _settings.downgrade_ratio)
+            return change_level(true);
+        if (average_count < target * _settings.upgrade_ratio)
+            return change_level(false);
+        return std::nullopt;
+    }
+
+    const QualityControllerStats& QualityController::get_stats() const
+    {
+        return _stats;
+    }
+
+    void QualityController::reset()
+    {
+        for (auto& state : _knobs)
+        {
+            if (state.level == 0U)
+                continue;
+
+            state.level = 0U;
+            state.knob.apply(0U);
+        }
+
+        _window_total = {};
+        _window_count = 0U;
+        _cooldown_remaining = 0U;
+        _stats = {};
+    }
+
+    std::optional<QualityDecision> QualityController::change_level(bool is_downgrade)
+    {
+        QualityKnobState* selected = nullptr;
+        for (auto& state : _knobs)
+        {
+            if (is_downgrade)
+            {
+                if (state.level + 1U < state.knob.level_count
+                    && (selected == nullptr || state.level < selected->level))
+                {
+                    selected = &state;
+                }
+            }
+            else if (state.level > 0U && (selected == nullptr || state.level >= selected->level))
+            {
+                selected = &state;
+            }
+        }
+
+        // Already at the cheapest or the best level everywhere.
+        if (selected == nullptr)
+            return std::nullopt;
+
+        auto decision = QualityDecision {
+            .knob = selected->knob.name,
+            .previous_level = selected->level,
+            .current_level = is_downgrade ? selected->level + 1U : selected->level - 1U,
+            .average_frame_time = _stats.last_average_frame_time,
+        };
+        selected->level = decision.current_level;
+        selected->knob.apply(selected->level);
+
+        if (is_downgrade)
+            ++_stats.downgrade_count;
+        else
+            ++_stats.upgrade_count;
+        _stats.last_decision = decision;
+        _cooldown_remaining = _settings.cooldown_frame_count;
+
+        if (_dispatcher)
+        {
+            _dispatcher->send<QualityLevelChangedEvent>(
+                decision.knob,
+                decision.previous_level,
+                decision.current_level,
+                decision.average_frame_time,
+                _settings.target_frame_time);
+        }
+
+        return decision;
+    }
+
+    // Builds a knob callback that derives a setting from its full-quality base. The base is
+    // re-read whenever the knob leaves level 0 so changes made at full quality are not lost.
+    template <typename TValue, typename TApply>
+    static std::function<void(uint)> make_graphics_knob(
+        Observable<GraphicsSettings, TValue>& property,
+        TApply apply)
+    {
+        return [&property, apply, base = property.value, applied_level = 0U](uint level) mutable
+        {
+            if (applied_level == 0U && level > 0U)
+                base = property.value;
+            applied_level = level;
+            property = apply(base, level);
+        };
+    }
+
+    void add_graphics_quality_knobs(QualityController& controller, GraphicsSettings& settings)
+    {
+        controller.add_knob(
+            QualityKnob {
+                .name = "shadow_map_resolution",
+                .level_count = 3U,
+                .apply = make_graphics_knob(
+                    settings.shadow_map_resolution,
+                    [](uint32 base, uint level)
+                    {
+                        return std::max(base >> level, std::min(base, 256U));
+                    }),
+            });
+
+        controller.add_knob(
+            QualityKnob {
+                .name = "lod_distance_bias",
+                .level_count = 3U,
+                .apply = make_graphics_knob(
+                    settings.lod_distance_bias,
+                    [](float base, uint level)
+                    {
+                        constexpr auto Scales = std::array {1.0F, 0.75F, 0.5F};
+                        return base * Scales[level];
+                    }),
+            });
+
+        controller.add_knob(
+            QualityKnob {
+                .name = "shadow_render_distance",
+                .level_count = 3U,
+                .apply = make_graphics_knob(
+                    settings.shadow_render_distance,
+                    [](float base, uint level)
+                    {
+                        constexpr auto Scales = std::array {1.0F, 0.75F, 0.5F};
+                        return base * Scales[level];
+                    }),
+            });
+
+        controller.add_knob(
+            QualityKnob {
+                .name = "post_processing",
+                .level_count = 2U,
+                .apply = make_graphics_knob(
+                    settings.post_processing_enabled,
+                    [](bool base, uint level)
+                    {
+                        return base && level == 0U;
+                    }),
+            });
+
+        controller.add_knob(
+            QualityKnob {
+                .name = "render_scale",
+                .level_count = 4U,
+                .apply = make_graphics_knob(
+                    settings.render_scale,
+                    [](float base, uint level)
+                    {
+                        constexpr auto Scales = std::array {1.0F, 0.85F, 0.7F, 0.5F};
+                        return base * Scales[level];
+                    }),
+            });
+    }
+}
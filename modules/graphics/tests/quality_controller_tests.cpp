@@ -0,0 +1,142 @@
+#include "PCH.h"
+#include "tbx/graphics/quality_controller.h"
+#include "tbx/graphics/settings.h"
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tbx::tests::graphics
+{
+    using namespace std::chrono_literals;
+
+    static QualityControllerSettings make_quality_settings()
+    {
+        auto settings = QualityControllerSettings {};
+        settings.is_enabled = true;
+        settings.target_frame_time = 10ms;
+        settings.window_frame_count = 4U;
+        settings.cooldown_frame_count = 2U;
+        return settings;
+    }
+
+    class IgnoringDispatcher final : public IMessageDispatcher
+    {
+      protected:
+        Result send(Message&) const override
+        {
+            return {};
+        }
+
+        std::shared_future<Result> post(std::unique_ptr<Message>) const override
+        {
+            std::promise<Result> promise = {};
+            promise.set_value({});
+            return promise.get_future().share();
+        }
+    };
+
+    // Validates that sustained slow frames step the first registered knob down one level.
+    TEST(QualityControllerTests, RecordFrame_DowngradesWhenOverTarget)
+    {
+        // Arrange
+        auto controller = QualityController(make_quality_settings());
+        auto applied_levels = std::vector<uint>();
+        controller.add_knob(
+            QualityKnob {
+                .name = "shadows",
+                .level_count = 3U,
+                .apply =
+                    [&applied_levels](uint level)
+                    {
+                        applied_levels.push_back(level);
+                    },
+            });
+
+        // Act
+        auto decision = std::optional<QualityDecision>();
+        for (int frame = 0; frame < 4; ++frame)
+            decision = controller.record_frame(15ms);
+
+        // Assert
+        ASSERT_TRUE(decision.has_value());
+        EXPECT_EQ(decision->knob, "shadows");
+        EXPECT_EQ(decision->current_level, 1U);
+        EXPECT_EQ(applied_levels, std::vector<uint>({1U}));
+        EXPECT_EQ(controller.get_stats().downgrade_count, 1U);
+    }
+
+    // Validates that frames inside the hysteresis band leave every knob untouched.
+    TEST(QualityControllerTests, RecordFrame_HoldsInsideHysteresisBand)
+    {
+        // Arrange
+        auto controller = QualityController(make_quality_settings());
+        controller.add_knob(
+            QualityKnob {
+                .name = "render_scale",
+                .level_count = 2U,
+                .apply = [](uint) {},
+            });
+
+        // Act
+        for (int frame = 0; frame < 40; ++frame)
+            controller.record_frame(9ms);
+
+        // Assert
+        EXPECT_EQ(controller.get_level("render_scale"), 0U);
+        EXPECT_EQ(controller.get_stats().downgrade_count, 0U);
+        EXPECT_EQ(controller.get_stats().upgrade_count, 0U);
+    }
+
+    // Validates that knobs drop in registration order and recover in reverse.
+    TEST(QualityControllerTests, RecordFrame_BalancesKnobsAndRecoversInReverse)
+    {
+        // Arrange
+        auto controller = QualityController(make_quality_settings());
+        controller.add_knob(QualityKnob {.name = "first", .level_count = 3U, .apply = [](uint) {}});
+        controller.add_knob(QualityKnob {.name = "second", .level_count = 3U, .apply = [](uint) {}});
+        auto decisions = std::vector<std::string>();
+
+        // Act
+        for (int frame = 0; frame < 12; ++frame)
+        {
+            if (const auto decision = controller.record_frame(20ms))
+                decisions.push_back(decision->knob);
+        }
+        for (int frame = 0; frame < 6; ++frame)
+        {
+            if (const auto decision = controller.record_frame(2ms))
+                decisions.push_back(decision->knob);
+        }
+
+        // Assert
+        EXPECT_EQ(decisions, std::vector<std::string>({"first", "second", "second"}));
+        EXPECT_EQ(controller.get_level("first"), 1U);
+        EXPECT_EQ(controller.get_level("second"), 0U);
+    }
+
+    // Validates that graphics knobs keep a setting changed at full quality instead of restoring
+    // the value captured at registration.
+    TEST(QualityControllerTests, GraphicsKnobs_RereadBaseWhenLeavingFullQuality)
+    {
+        // Arrange
+        auto dispatcher = IgnoringDispatcher();
+        auto settings = GraphicsSettings(dispatcher);
+        auto controller = QualityController(make_quality_settings());
+        add_graphics_quality_knobs(controller, settings);
+        settings.shadow_map_resolution = 4096U;
+
+        // Act
+        for (int frame = 0; frame < 4; ++frame)
+            controller.record_frame(20ms);
+        const auto downgraded = settings.shadow_map_resolution.value;
+        for (int frame = 0; frame < 6; ++frame)
+            controller.record_frame(2ms);
+
+        // Assert
+        EXPECT_EQ(downgraded, 2048U);
+        EXPECT_EQ(controller.get_level("shadow_map_resolution"), 0U);
+        EXPECT_EQ(settings.shadow_map_resolution.value, 4096U);
+    }
+}
@@ -0,0 +1,370 @@
+#include "PCH.h"
+#include "tbx/assets/manager.h"
+#include "tbx/async/job_system.h"
+#include "tbx/async/thread_manager.h"
+#include "tbx/ecs/entity.h"
+#include "tbx/ecs/entity_registry.h"
+#include "tbx/files/tests/in_memory_file_ops.h"
+#include "tbx/graphics/render_pipeline.h"
+#include "tbx/graphics/settings.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tbx::tests::graphics
+{
+    class NullMessageCoordinator final : public IMessageCoordinator
+    {
+      public:
+        void flush() override {}
+
+        Uuid register_handler(MessageHandler) override
+        {
+            return Uuid::generate();
+        }
+
+        void deregister_handler(const Uuid&) override {}
+
+        void clear_handlers() override {}
+
+      protected:
+        Result send(Message&) const override
+        {
+            return {};
+        }
+
+        std::shared_future<Result> post(std::unique_ptr<Message>) const override
+        {
+            std::promise<Result> promise = {};
+            promise.set_value({});
+            return promise.get_future().share();
+        }
+    };
+
+    class SingleWindowManager final : public IWindowManager
+    {
+      public:
+        Window create(const WindowCreateInfo&) override
+        {
+            return window;
+        }
+
+        bool destroy(const Window&) override
+        {
+            return true;
+        }
+
+        bool has(const Window& queried) const override
+        {
+            return queried == window;
+        }
+
+        bool open(const Window&) override
+        {
+            return true;
+        }
+
+        bool close(const Window&) override
+        {
+            return true;
+        }
+
+        bool is_open(const Window& queried) const override
+        {
+            return queried == window;
+        }
+
+        WindowMode get_mode(const Window&) const override
+        {
+            return WindowMode::WINDOWED;
+        }
+
+        bool set_mode(const Window&, WindowMode) override
+        {
+            return true;
+        }
+
+        std::string get_title(const Window&) const override
+        {
+            return "Pipeline";
+        }
+
+        bool set_title(const Window&, std::string) override
+        {
+            return true;
+        }
+
+        NativeWindowHandle get_native_handle(const Window&) const override
+        {
+            return nullptr;
+        }
+
+        Size get_size(const Window&) const override
+        {
+            return {64, 64};
+        }
+
+        bool set_size(const Window&, const Size&) override
+        {
+            return true;
+        }
+
+        std::vector<Window> get_open_windows() const override
+        {
+            return {window};
+        }
+
+      public:
+        Window window = Window("pipeline_window");
+    };
+
+    // Holds every frame on the render lane until `release_frames` is called, so a test can observe
+    // a pipelined frame while it is still in flight.
+    class GatedContextManager final : public IGraphicsContextManager
+    {
+      public:
+        GatedContextManager()
+            : _gate(_gate_source.get_future().share())
+        {
+        }
+
+        Result make_current(const Window&) override
+        {
+            return {};
+        }
+
+        Result present(const Window&) override
+        {
+            _gate.wait();
+            presented_frame_count.fetch_add(1U);
+            return {};
+        }
+
+        Result set_vsync(const VsyncMode&) override
+        {
+            return {};
+        }
+
+        GraphicsProcAddress get_proc_address() const override
+        {
+            return nullptr;
+        }
+
+        void release_frames()
+        {
+            _gate_source.set_value();
+        }
+
+      public:
+        std::atomic<uint> presented_frame_count = 0U;
+
+      private:
+        std::promise<void> _gate_source = {};
+        std::shared_future<void> _gate = {};
+    };
+
+    class NullGraphicsBackend final : public IGraphicsBackend
+    {
+      public:
+        GraphicsApi get_api() const override
+        {
+            return GraphicsApi::OPEN_GL;
+        }
+
+        Result initialize(GraphicsProcAddress) override
+        {
+            return {};
+        }
+
+        Result upload(const Mesh& mesh, Uuid& out_resource_uuid) override
+        {
+            uploaded_mesh_sources.push_back(&mesh);
+            uploaded_mesh_index_counts.push_back(mesh.indices.size());
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result upload(const Material&, Uuid& out_resource_uuid) override
+        {
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result upload(const Texture&, Uuid& out_resource_uuid) override
+        {
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result upload(const TextureSettings&, Uuid& out_resource_uuid) override
+        {
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result unload(const Uuid&) override
+        {
+            return {};
+        }
+
+        Result begin_draw(const Window&, const Camera&, const Size&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_shadows(const ShadowRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_geometry(const GeometryRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_lighting(const LightingRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_transparent(const TransparentRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome apply_post_processing(const PostProcessingPass&) override
+        {
+            return {};
+        }
+
+        Result clear(const Color&) override
+        {
+            return {};
+        }
+
+        Result end_draw() override
+        {
+            return {};
+        }
+
+      public:
+        std::vector<const Mesh*> uploaded_mesh_sources = {};
+        std::vector<size> uploaded_mesh_index_counts = {};
+    };
+
+    // Validates that a graphics API switch can drain a pipelined frame before the old backend is
+    // released, and that no frame reaches the backend after the switch.
+    TEST(RenderPipelineTests, ApiSwitch_DrainsFrameInFlightFirst)
+    {
+        // Arrange
+        const std::filesystem::path working_directory = "/virtual/render_pipeline";
+        auto coordinator = NullMessageCoordinator();
+        auto settings = GraphicsSettings(coordinator);
+        settings.pipelined_rendering_enabled = true;
+        auto thread_manager = ThreadManager();
+        auto job_system = JobSystem(JobSystemConfiguration {.worker_count = 1});
+        auto entity_registry = EntityRegistry();
+        auto asset_manager = AssetManager(
+            &coordinator,
+            working_directory,
+            {},
+            {},
+            {},
+            std::make_shared<tbx::tests::file_system::InMemoryFileOps>(working_directory));
+        auto window_manager = SingleWindowManager();
+        auto context_manager = GatedContextManager();
+        auto backend = NullGraphicsBackend();
+        auto rendering = Rendering(
+            coordinator,
+            thread_manager,
+            entity_registry,
+            asset_manager,
+            job_system,
+            settings,
+            window_manager,
+            context_manager,
+            backend);
+
+        // Act
+        rendering.render(0.0F);
+        const auto presented_while_in_flight = context_manager.presented_frame_count.load();
+        auto releaser = std::thread(
+            [&context_manager]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                context_manager.release_frames();
+            });
+        rendering.wait_for_frames_in_flight();
+        const auto presented_after_drain = context_manager.presented_frame_count.load();
+        releaser.join();
+        rendering.set_api(GraphicsApi::VULKAN);
+        rendering.render(0.0F);
+        rendering.wait_for_frames_in_flight();
+
+        // Assert
+        EXPECT_EQ(presented_while_in_flight, 0U);
+        EXPECT_EQ(presented_after_drain, 1U);
+        EXPECT_EQ(rendering.get_active_api(), GraphicsApi::NONE);
+        EXPECT_EQ(context_manager.presented_frame_count.load(), 1U);
+    }
+
+    // Validates that a pipelined frame uploads a private copy of a dynamic mesh, so the simulation
+    // can write the live mesh while the frame is still in flight.
+    TEST(RenderPipelineTests, PipelinedFrame_UploadsDynamicMeshSnapshot)
+    {
+        // Arrange
+        const std::filesystem::path working_directory = "/virtual/render_pipeline";
+        auto coordinator = NullMessageCoordinator();
+        auto settings = GraphicsSettings(coordinator);
+        settings.pipelined_rendering_enabled = true;
+        auto thread_manager = ThreadManager();
+        auto job_system = JobSystem(JobSystemConfiguration {.worker_count = 1});
+        auto entity_registry = EntityRegistry();
+        auto asset_manager = AssetManager(
+            &coordinator,
+            working_directory,
+            {},
+            {},
+            {},
+            std::make_shared<tbx::tests::file_system::InMemoryFileOps>(working_directory));
+        auto window_manager = SingleWindowManager();
+        auto context_manager = GatedContextManager();
+        auto backend = NullGraphicsBackend();
+        auto rendering = Rendering(
+            coordinator,
+            thread_manager,
+            entity_registry,
+            asset_manager,
+            job_system,
+            settings,
+            window_manager,
+            context_manager,
+            backend);
+        auto camera_entity = Entity("Camera", entity_registry);
+        camera_entity.add_component<Camera>();
+        camera_entity.add_component<Transform>(Vec3(0.0F, 0.0F, 10.0F));
+        auto mesh_entity = Entity("Mesh", entity_registry);
+        mesh_entity.add_component<Transform>();
+        const auto live_mesh = std::make_shared<Mesh>(quad);
+        mesh_entity.add_component<DynamicMesh>(live_mesh);
+        const auto original_index_count = live_mesh->indices.size();
+
+        // Act
+        rendering.render(0.0F);
+        live_mesh->indices.clear();
+        context_manager.release_frames();
+        rendering.wait_for_frames_in_flight();
+        rendering.render(0.0F);
+        rendering.wait_for_frames_in_flight();
+
+        // Assert
+        ASSERT_FALSE(backend.uploaded_mesh_sources.empty());
+        EXPECT_NE(backend.uploaded_mesh_sources[0], live_mesh.get());
+        EXPECT_EQ(backend.uploaded_mesh_index_counts[0], original_index_count);
+        for (const auto index_count : backend.uploaded_mesh_index_counts)
+            EXPECT_NE(index_count, 0U);
+    }
+}
@@ -0,0 +1,190 @@
+#include "PCH.h"
+#include "tbx/assets/events.h"
+#include "tbx/assets/manager.h"
+#include "tbx/assets/requests.h"
+#include "tbx/async/job_system.h"
+#include "tbx/files/tests/in_memory_file_ops.h"
+#include "tbx/graphics/render_pipeline.h"
+#include "tbx/graphics/render_resources.h"
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace tbx::tests::graphics
+{
+    class CountingGraphicsBackend final : public IGraphicsBackend
+    {
+      public:
+        GraphicsApi get_api() const override
+        {
+            return GraphicsApi::OPEN_GL;
+        }
+
+        Result initialize(GraphicsProcAddress) override
+        {
+            return {};
+        }
+
+        Result upload(const Mesh&, Uuid& out_resource_uuid) override
+        {
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result upload(const Material&, Uuid& out_resource_uuid) override
+        {
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result upload(const Texture& texture, Uuid& out_resource_uuid) override
+        {
+            uploaded_textures.push_back(texture.resolution);
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result upload(const TextureSettings&, Uuid& out_resource_uuid) override
+        {
+            out_resource_uuid = Uuid::generate();
+            return {};
+        }
+
+        Result unload(const Uuid& resource_uuid) override
+        {
+            unloaded_resources.push_back(resource_uuid);
+            return {};
+        }
+
+        Result begin_draw(const Window&, const Camera&, const Size&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_shadows(const ShadowRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_geometry(const GeometryRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_lighting(const LightingRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome draw_transparent(const TransparentRenderInfo&) override
+        {
+            return {};
+        }
+
+        RenderPassOutcome apply_post_processing(const PostProcessingPass&) override
+        {
+            return {};
+        }
+
+        Result clear(const Color&) override
+        {
+            return {};
+        }
+
+        Result end_draw() override
+        {
+            return {};
+        }
+
+      public:
+        std::vector<Size> uploaded_textures = {};
+        std::vector<Uuid> unloaded_resources = {};
+    };
+
+    // Stands in for the texture loader plugin on job workers and captures posted reload events.
+    class DecodingTextureDispatcher final : public IMessageDispatcher
+    {
+      public:
+        std::vector<Handle> get_reloaded_assets() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _reloaded_assets;
+        }
+
+      protected:
+        Result send(Message& msg) const override
+        {
+            auto* request = handle_message<LoadTextureRequest>(msg);
+            if (!request || !request->asset)
+                return {};
+
+            *request->asset = Texture(
+                Size {4, 2},
+                request->wrap,
+                request->filter,
+                request->format,
+                std::vector<Pixel>(32U, 128U));
+            request->state = MessageState::HANDLED;
+            return {};
+        }
+
+        std::shared_future<Result> post(std::unique_ptr<Message> msg) const override
+        {
+            if (const auto* reloaded = msg ? handle_message<AssetReloadedEvent>(*msg) : nullptr)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _reloaded_assets.push_back(reloaded->affected_asset);
+            }
+
+            std::promise<Result> promise = {};
+            promise.set_value({});
+            return promise.get_future().share();
+        }
+
+      private:
+        mutable std::mutex _mutex = {};
+        mutable std::vector<Handle> _reloaded_assets = {};
+    };
+
+    // Validates that publishing a worker-decoded texture evicts the fallback the render cache
+    // uploaded while the decode was in flight.
+    TEST(RenderResourcesTests, PublishedTexture_InvalidatesCachedFallbackUpload)
+    {
+        // Arrange
+        const std::filesystem::path working_directory = "/virtual/render_resources";
+        auto dispatcher = DecodingTextureDispatcher();
+        auto global_dispatcher_scope = GlobalDispatcherScope(dispatcher);
+        auto manager = AssetManager(
+            &dispatcher,
+            working_directory,
+            {},
+            {},
+            {},
+            std::make_shared<tbx::tests::file_system::InMemoryFileOps>(working_directory));
+        auto job_system = JobSystem(JobSystemConfiguration {.worker_count = 1});
+        manager.set_job_system(&job_system);
+        auto backend = CountingGraphicsBackend();
+        auto resources = RenderResourceManager(manager, backend);
+        const auto handle = Handle("brick.png");
+
+        // Act
+        auto streamed_in = manager.load_async<Texture>(handle);
+        const auto fallback_resource = resources.upload_texture(handle);
+        job_system.wait_for_idle();
+        manager.publish_decoded_assets();
+        for (const auto& reloaded_asset : dispatcher.get_reloaded_assets())
+            resources.on_asset_reloaded(reloaded_asset);
+        const auto decoded_resource = resources.upload_texture(handle);
+
+        // Assert
+        ASSERT_TRUE(streamed_in.promise.get());
+        ASSERT_EQ(dispatcher.get_reloaded_assets().size(), 1U);
+        ASSERT_EQ(backend.uploaded_textures.size(), 2U);
+        EXPECT_EQ(backend.uploaded_textures[1].width, 4U);
+        EXPECT_EQ(backend.uploaded_textures[1].height, 2U);
+        ASSERT_EQ(backend.unloaded_resources.size(), 1U);
+        EXPECT_EQ(backend.unloaded_resources[0], fallback_resource);
+        EXPECT_NE(decoded_resource, fallback_resource);
+    }
+}
@@ -3,6 +3,7 @@
 #include "tbx/input/scheme.h"
 #include "tbx/time/delta_time.h"
 #include <functional>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -95,6 +96,21 @@ namespace tbx
         virtual void set_mouse_lock_mode(MouseLockMode mode) = 0;
         virtual MouseLockMode get_mouse_lock_mode() const = 0;
 
+        /// @brief
+        /// Purpose: Returns the device state input actions are evaluated against this frame.
+        /// @details
+        /// Ownership: Returns an owned copy.
+        /// Thread Safety: Not thread-safe; call from the update thread.
+        virtual InputDeviceSnapshot get_device_snapshot() const = 0;
+
+        /// @brief
+        /// Purpose: Evaluates actions against a fixed snapshot instead of live devices, such as
+        /// while replaying a recorded session. Pass no snapshot to return to live devices.
+        /// @details
+        /// Ownership: Stores a copy of the snapshot.
+        /// Thread Safety: Not thread-safe; call from the update thread.
+        virtual void set_device_snapshot_override(std::optional<InputDeviceSnapshot> snapshot) = 0;
+
         /// @brief
         /// Purpose: Evaluates bindings and sends action lifecycle callbacks.
         /// @details
@@ -124,6 +140,9 @@ namespace tbx
         const InputScheme* get_scheme(const std::string& scheme_name) const override;
         std::vector<std::reference_wrapper<const InputScheme>> get_all_schemes() const override;
 
+        InputDeviceSnapshot get_device_snapshot() const override;
+        void set_device_snapshot_override(std::optional<InputDeviceSnapshot> snapshot) override;
+
         void update(const DeltaTime& delta_time) override;
 
       private:
@@ -137,5 +156,6 @@ namespace tbx
 
       private:
         std::unordered_map<std::string, InputScheme> _schemes = {};
+        std::optional<InputDeviceSnapshot> _snapshot_override = std::nullopt;
     };
 }
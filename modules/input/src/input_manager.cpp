@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <cmath>
 #include <ranges>
+#include <utility>
 
 namespace tbx
 {
@@ -435,8 +436,21 @@ namespace tbx
         return controller_indices;
     }
 
+    InputDeviceSnapshot InputManager::get_device_snapshot() const
+    {
+        return query_snapshot();
+    }
+
+    void InputManager::set_device_snapshot_override(std::optional<InputDeviceSnapshot> snapshot)
+    {
+        _snapshot_override = std::move(snapshot);
+    }
+
     InputDeviceSnapshot InputManager::query_snapshot() const
     {
+        if (_snapshot_override)
+            return *_snapshot_override;
+
         InputDeviceSnapshot snapshot = {
             .keyboard = get_keyboard_state(),
             .mouse = get_mouse_state(),
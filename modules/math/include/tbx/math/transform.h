@@ -40,4 +40,12 @@ namespace tbx
     /// Thread Safety: Stateless helper; safe to call concurrently.
     TBX_API Transform
         world_to_local_tranform(const Transform& parent_world, const Transform& world);
+
+    /// @brief
+    /// Purpose: Blends two transforms, lerping position and scale and slerping rotation.
+    /// @details
+    /// Ownership: Returns an owned Transform value.
+    /// Thread Safety: Stateless helper; safe to call concurrently. Notes: `alpha` is clamped to
+    /// [0, 1], where 0 returns `from` and 1 returns `to`.
+    TBX_API Transform interpolate(const Transform& from, const Transform& to, float alpha);
 }
@@ -1,4 +1,5 @@
 #include "tbx/math/transform.h"
+#include <algorithm>
 #include <cmath>
 
 namespace tbx
@@ -45,4 +46,14 @@ namespace tbx
             * divide_components(world.position - parent_world.position, parent_world.scale);
         return local;
     }
+
+    Transform interpolate(const Transform& from, const Transform& to, float alpha)
+    {
+        const float t = std::clamp(alpha, 0.0F, 1.0F);
+        auto result = Transform {};
+        result.position = glm::mix(from.position, to.position, t);
+        result.rotation = normalize(glm::slerp(from.rotation, to.rotation, t));
+        result.scale = glm::mix(from.scale, to.scale, t);
+        return result;
+    }
 }
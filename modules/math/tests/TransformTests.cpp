@@ -0,0 +1,31 @@
+#include "PCH.h"
+#include "tbx/math/transform.h"
+
+namespace tbx::tests::math
+{
+    TEST(TransformTests, Interpolate_BlendsPositionRotationAndScale)
+    {
+        Transform from(Vec3(0.0f), Quat(1.0f, 0.0f, 0.0f, 0.0f), Vec3(1.0f));
+        Transform to(Vec3(10.0f, 0.0f, -4.0f), Quat(0.0f, 0.0f, 1.0f, 0.0f), Vec3(3.0f));
+
+        Transform halfway = interpolate(from, to, 0.5f);
+
+        EXPECT_FLOAT_EQ(halfway.position.x, 5.0f);
+        EXPECT_FLOAT_EQ(halfway.position.z, -2.0f);
+        EXPECT_FLOAT_EQ(halfway.scale.y, 2.0f);
+        EXPECT_NEAR(halfway.rotation.w, 0.70710677f, 0.0001f);
+        EXPECT_NEAR(halfway.rotation.y, 0.70710677f, 0.0001f);
+    }
+
+    TEST(TransformTests, Interpolate_ClampsAlphaToEndpoints)
+    {
+        Transform from(Vec3(1.0f, 2.0f, 3.0f));
+        Transform to(Vec3(4.0f, 5.0f, 6.0f));
+
+        Transform before = interpolate(from, to, -1.0f);
+        Transform after = interpolate(from, to, 2.0f);
+
+        EXPECT_FLOAT_EQ(before.position.x, 1.0f);
+        EXPECT_FLOAT_EQ(after.position.z, 6.0f);
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "tbx/common/typedefs.h"
+#include "tbx/tbx_api.h"
+#include <array>
+#include <chrono>
+
+namespace tbx
+{
+    // Bucket i counts dispatches faster than 2^i microseconds; the last bucket collects the rest.
+    inline constexpr size MessageLatencyBucketCount = 16;
+
+    /// @brief
+    /// Purpose: Aggregated timing for a set of message dispatches.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API MessageDispatchStats
+    {
+        uint64 dispatch_count = 0;
+        std::chrono::nanoseconds total_time = {};
+        std::chrono::nanoseconds max_time = {};
+        std::array<uint64, MessageLatencyBucketCount> latency_histogram = {};
+    };
+
+    /// @brief
+    /// Purpose: Adds one dispatch that took `elapsed` to the totals and latency histogram.
+    /// @details
+    /// Ownership: Mutates the caller-owned stats in place.
+    /// Thread Safety: Not thread-safe; callers synchronize access to `stats`.
+    TBX_API void record_dispatch_time(
+        MessageDispatchStats& stats,
+        std::chrono::nanoseconds elapsed);
+}
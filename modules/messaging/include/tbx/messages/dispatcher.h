@@ -5,6 +5,7 @@
 #include <concepts>
 #include <future>
 #include <memory>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -62,6 +63,17 @@ namespace tbx
                 && std::is_constructible_v<TMessage, TArgs...>)
         std::shared_future<Result> post(TArgs&&... args) const;
 
+        /// @brief
+        /// Purpose: Immediately sends a run of same-typed events as a single batch message.
+        /// @details
+        /// Ownership: The caller retains ownership of the events; handlers borrow them through
+        /// `MessageBatch<TEvent>` for the duration of the call. Handlers are routed once for the
+        /// whole batch and the batch shares one result; an empty span is not dispatched.
+        /// Thread Safety: See class notes.
+        template <typename TEvent>
+            requires std::derived_from<TEvent, Event>
+        Result send_batch(std::span<TEvent> events) const;
+
       protected:
         virtual Result send(Message& msg) const = 0;
         virtual std::shared_future<Result> post(std::unique_ptr<Message> msg) const = 0;
@@ -104,6 +116,15 @@ namespace tbx
         /// Thread Safety: See class notes.
         virtual Uuid register_handler(MessageHandler handler) = 0;
 
+        /// @brief
+        /// Purpose: Registers a handler that receives batches of `TEvent` sent with `send_batch`.
+        /// @details
+        /// Ownership: Wraps the handler in a `MessageHandler` stored by the registrar.
+        /// Thread Safety: See class notes.
+        template <typename TEvent>
+            requires std::derived_from<TEvent, Event>
+        Uuid register_batch_handler(MessageBatchHandler<TEvent> handler);
+
         /// @brief
         /// Purpose: Removes a previously registered handler by token.
         /// @details
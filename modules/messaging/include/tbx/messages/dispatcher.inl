@@ -34,4 +34,28 @@ namespace tbx
     {
         return post(std::make_unique<TMessage>(std::forward<TArgs>(args)...));
     }
+
+    template <typename TEvent>
+        requires std::derived_from<TEvent, Event>
+    Result IMessageDispatcher::send_batch(std::span<TEvent> events) const
+    {
+        if (events.empty())
+            return {};
+
+        MessageBatch<TEvent> batch(events);
+        return send(static_cast<Message&>(batch));
+    }
+
+    template <typename TEvent>
+        requires std::derived_from<TEvent, Event>
+    Uuid IMessageHandlerRegistrar::register_batch_handler(MessageBatchHandler<TEvent> handler)
+    {
+        return register_handler(
+            [handler = std::move(handler)](Message& msg)
+            {
+                auto events = handle_message_batch<TEvent>(msg);
+                if (!events.empty())
+                    handler(events);
+            });
+    }
 }
@@ -1,8 +1,11 @@
 #pragma once
 #include "tbx/async/cancellation_token.h"
 #include "tbx/common/result.h"
+#include "tbx/common/typedefs.h"
 #include "tbx/common/uuid.h"
+#include <concepts>
 #include <functional>
+#include <span>
 
 namespace tbx
 {
@@ -31,14 +34,37 @@ namespace tbx
         std::function<void(const Message&)> on_timeout;
     };
 
+    /// @brief
+    /// Purpose: Describes how a posted message is queued and where it may be dispatched when its
+    /// queue is flushed.
+    /// @details
+    /// Ownership: Value type owned by the message.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API MessageDispatchPolicy
+    {
+        // Declares that every handler of this message may run on a job worker. Flush may then
+        // dispatch it off the main thread; completion callbacks still run on the main thread.
+        bool is_thread_safe = false;
+
+        // Thread-safe messages that share a non-zero channel are dispatched in post order.
+        // Channel 0 carries no ordering guarantee.
+        uint64 channel = 0;
+
+        // When non-zero, posting replaces a still-queued message of the same type and key. The
+        // replaced message's callbacks and future complete with the newer message.
+        uint64 coalescing_key = 0;
+    };
+
     // Base polymorphic message type for dispatching.
     // Ownership: Messages are typically stack-allocated and passed by reference
     // to send(). When posted, a copy is stored by the coordinator until delivery.
     // The callbacks stored herein are non-owning; ensure captured state outlives
     // dispatch or use weak references.
     // Thread-safety: MessageCoordinator serializes access to Message instances,
-    // allowing handlers to mutate message state safely. External callers should
-    // avoid concurrent mutation unless they add their own synchronization.
+    // allowing handlers to mutate message state safely. Messages whose dispatch
+    // policy is thread-safe may be handled on a worker thread, but still by one
+    // thread at a time. External callers should avoid concurrent mutation unless
+    // they add their own synchronization.
     struct TBX_API Message
     {
         Message();
@@ -48,6 +74,7 @@ namespace tbx
         Result result = {};
         CancellationToken cancellation_token = {};
         MessageCallbacks callbacks = {};
+        MessageDispatchPolicy dispatch_policy = {};
         Uuid id = Uuid::generate();
     };
 
@@ -74,6 +101,16 @@ namespace tbx
     template <>
     struct Request<void>;
 
+    /// @brief
+    /// Purpose: Carries a contiguous run of same-typed events so handlers are routed once per
+    /// batch instead of once per event.
+    /// @details
+    /// Ownership: Non-owning; the span borrows the caller's events for the duration of the send.
+    /// Thread Safety: Matches the sending thread. No synchronization is applied.
+    template <typename TEvent>
+        requires std::derived_from<TEvent, Event>
+    struct MessageBatch;
+
     /// @brief
     /// Purpose: Represents a subscriber callback invoked by the message coordinator during
     /// dispatch.
@@ -83,6 +120,14 @@ namespace tbx
     /// and must manage their own synchronization if touching shared state.
     using MessageHandler = std::function<void(Message&)>;
 
+    /// @brief
+    /// Purpose: Represents a subscriber callback that receives every event of a batch at once.
+    /// @details
+    /// Ownership: Non-owning. The span is only valid for the duration of the call.
+    /// Thread Safety: Invoked on the sending thread; the same rules as `MessageHandler` apply.
+    template <typename TEvent>
+    using MessageBatchHandler = std::function<void(std::span<TEvent>)>;
+
     /// @brief
     /// Purpose: Retrieves a typed message pointer from a const base message reference.
     /// @details
@@ -98,6 +143,16 @@ namespace tbx
     /// Thread Safety: Matches the caller's context. No synchronization is applied.
     template <typename TMessage>
     TMessage* handle_message(Message& message);
+
+    /// @brief
+    /// Purpose: Retrieves the events carried by a batch message of the given event type.
+    /// @details
+    /// Ownership: Non-owning; the returned span borrows from the batch sender. Returns an empty
+    /// span when the message is not a batch of `TEvent`.
+    /// Thread Safety: Matches the caller's context. No synchronization is applied.
+    template <typename TEvent>
+        requires std::derived_from<TEvent, Event>
+    std::span<TEvent> handle_message_batch(Message& message);
 }
 
 #include "tbx/messages/message.inl"
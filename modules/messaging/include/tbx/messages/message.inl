@@ -18,6 +18,19 @@ namespace tbx
         virtual ~Request() noexcept = default;
     };
 
+    template <typename TEvent>
+        requires std::derived_from<TEvent, Event>
+    struct MessageBatch : public Event
+    {
+        MessageBatch(std::span<TEvent> batch_events)
+            : events(batch_events)
+        {
+        }
+        virtual ~MessageBatch() noexcept = default;
+
+        std::span<TEvent> events = {};
+    };
+
     template <typename TMessage>
     const TMessage* handle_message(const Message& message)
     {
@@ -29,4 +42,13 @@ namespace tbx
     {
         return dynamic_cast<TMessage*>(&message);
     }
+
+    template <typename TEvent>
+        requires std::derived_from<TEvent, Event>
+    std::span<TEvent> handle_message_batch(Message& message)
+    {
+        if (auto* batch = dynamic_cast<MessageBatch<TEvent>*>(&message))
+            return batch->events;
+        return {};
+    }
 }
@@ -3,8 +3,10 @@
 #include "tbx/messages/message.h"
 #include <concepts>
 #include <functional>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace tbx
 {
@@ -24,6 +26,112 @@ namespace tbx
     template <typename TOwner, typename TProp>
     class Observable;
 
+    /// @brief
+    /// Purpose: Event sent once when an `ObservableBatchScope` ends, carrying the net change of
+    /// every observable of the owner that was assigned inside the scope.
+    /// @details
+    /// Ownership: Owns the recorded `PropertyChangedEvent` instances; the owner pointer is
+    /// non-owning.
+    /// Thread Safety: Safe for concurrent read-only access; synchronize if mutable access is needed.
+    template <typename TOwner>
+    struct ObservableBatchChangedEvent;
+
+    /// @brief
+    /// Purpose: Records observable changes for one owner while a batch is active on the current
+    /// thread. This is the non-template core of `ObservableBatchScope`.
+    /// @details
+    /// Ownership: Owns recorded change events until the batch ends. The owner and dispatcher
+    /// pointers are non-owning.
+    /// Thread Safety: Batches are tracked per thread; only assignments made on the thread that
+    /// opened the batch are recorded.
+    class TBX_API ObservableBatchRecorder
+    {
+      public:
+        ObservableBatchRecorder(const void* owner);
+        ~ObservableBatchRecorder() noexcept;
+
+        ObservableBatchRecorder(const ObservableBatchRecorder&) = delete;
+        ObservableBatchRecorder& operator=(const ObservableBatchRecorder&) = delete;
+
+        /// @brief
+        /// Purpose: Returns the innermost active batch for an owner on the calling thread.
+        /// @details
+        /// Ownership: Non-owning; returns nullptr when no batch is active for the owner.
+        /// Thread Safety: Reads calling-thread state only.
+        static ObservableBatchRecorder* find(const void* owner);
+
+        /// @brief
+        /// Purpose: Records a change, merging it with an earlier change to the same observable so
+        /// the first previous value and the latest current value are kept.
+        /// @details
+        /// Ownership: Stores a new change event owned by the recorder.
+        /// Thread Safety: Call from the thread that opened the batch.
+        template <typename TOwner, typename TProp>
+        void record(
+            IMessageDispatcher* dispatcher,
+            const Observable<TOwner, TProp>* observable,
+            Observable<TOwner, TProp> TOwner::* member,
+            TOwner* owner,
+            const TProp& previous,
+            const TProp& current);
+
+        /// @brief
+        /// Purpose: Stops recording and returns the recorded changes in first-change order.
+        /// @details
+        /// Ownership: Transfers ownership of the recorded events to the caller.
+        /// Thread Safety: Call from the thread that opened the batch.
+        std::vector<std::unique_ptr<Event>> end();
+
+        /// @brief
+        /// Purpose: Returns the dispatcher of the first recorded observable.
+        /// @details
+        /// Ownership: Non-owning; nullptr when nothing was recorded.
+        /// Thread Safety: Call from the thread that opened the batch.
+        IMessageDispatcher* get_dispatcher() const;
+
+      private:
+        Event* find_change(const void* observable) const;
+        void add_change(
+            IMessageDispatcher* dispatcher,
+            const void* observable,
+            std::unique_ptr<Event> change);
+
+      private:
+        const void* _owner = nullptr;
+        bool _is_active = true;
+        IMessageDispatcher* _dispatcher = nullptr;
+        std::vector<const void*> _observables = {};
+        std::vector<std::unique_ptr<Event>> _changes = {};
+    };
+
+    /// @brief
+    /// Purpose: Defers property changed events for an owner's observables until the scope ends,
+    /// then sends a single `ObservableBatchChangedEvent` so handlers reconfigure once.
+    /// @details
+    /// Ownership: Non-owning reference to the owner, which must outlive the scope.
+    /// Thread Safety: Only assignments made on the constructing thread are batched.
+    template <typename TOwner>
+    class ObservableBatchScope
+    {
+      public:
+        ObservableBatchScope(TOwner& owner);
+        ~ObservableBatchScope() noexcept;
+
+        ObservableBatchScope(const ObservableBatchScope&) = delete;
+        ObservableBatchScope& operator=(const ObservableBatchScope&) = delete;
+
+        /// @brief
+        /// Purpose: Ends the batch early and sends the aggregated change event.
+        /// @details
+        /// Ownership: Hands the recorded changes to the sent event.
+        /// Thread Safety: Call from the constructing thread. Later calls do nothing.
+        void commit();
+
+      private:
+        TOwner* _owner = nullptr;
+        ObservableBatchRecorder _recorder;
+    };
+
     /// @brief
     /// Purpose: Extracts the owner and property types from an observable member pointer.
     /// @details
@@ -43,7 +151,8 @@ namespace tbx
     /// @brief
     /// Purpose: Attempts to retrieve a property changed event for a specific observable member.
     /// @details
-    /// Ownership: Non-owning; the output pointer borrows from the input message.
+    /// Ownership: Non-owning; the output pointer borrows from the input message. Also finds the
+    /// member's change inside an `ObservableBatchChangedEvent`.
     /// Thread Safety: Matches the caller's context. No synchronization is applied.
     template <auto TMember>
     PropertyChangedEvent<typename ObservableMemberTraits<TMember>::Owner, typename ObservableMemberTraits<TMember>::Property>* handle_property_changed(
@@ -52,7 +161,8 @@ namespace tbx
     /// @brief
     /// Purpose: Attempts to retrieve a property changed event for a specific observable member.
     /// @details
-    /// Ownership: Non-owning; the output pointer borrows from the input message.
+    /// Ownership: Non-owning; the output pointer borrows from the input message. Also finds the
+    /// member's change inside an `ObservableBatchChangedEvent`.
     /// Thread Safety: Matches the caller's context. No synchronization is applied.
     template <auto TMember>
     const PropertyChangedEvent<typename ObservableMemberTraits<TMember>::Owner, typename ObservableMemberTraits<TMember>::Property>* handle_property_changed(
@@ -23,6 +23,33 @@ namespace tbx
         TChanged current;
     };
 
+    template <typename TOwner>
+    struct ObservableBatchChangedEvent : Event
+    {
+        ObservableBatchChangedEvent(TOwner* owner_ptr, std::vector<std::unique_ptr<Event>> changed)
+            : owner(owner_ptr)
+            , changes(std::move(changed))
+        {
+        }
+
+        template <typename TProp>
+        PropertyChangedEvent<TOwner, TProp>* find_change(
+            Observable<TOwner, TProp> TOwner::* member) const
+        {
+            for (const auto& change : changes)
+            {
+                auto* typed = dynamic_cast<PropertyChangedEvent<TOwner, TProp>*>(change.get());
+                if (typed && typed->member == member)
+                    return typed;
+            }
+
+            return nullptr;
+        }
+
+        TOwner* owner = nullptr;
+        std::vector<std::unique_ptr<Event>> changes = {};
+    };
+
     template <typename TOwner, typename TProp>
     class Observable
     {
@@ -89,6 +116,12 @@ namespace tbx
             if (!_dispatcher)
                 return;
 
+            if (auto* batch = ObservableBatchRecorder::find(owner))
+            {
+                batch->record(_dispatcher, this, _member, owner, previous, current);
+                return;
+            }
+
             _dispatcher
                 ->send<PropertyChangedEvent<TOwner, TProp>>(_member, owner, previous, current);
         }
@@ -98,6 +131,56 @@ namespace tbx
         Observable<TOwner, TProp> TOwner::* _member = nullptr;
     };
 
+    template <typename TOwner, typename TProp>
+    void ObservableBatchRecorder::record(
+        IMessageDispatcher* dispatcher,
+        const Observable<TOwner, TProp>* observable,
+        Observable<TOwner, TProp> TOwner::* member,
+        TOwner* owner,
+        const TProp& previous,
+        const TProp& current)
+    {
+        if (auto* existing =
+                dynamic_cast<PropertyChangedEvent<TOwner, TProp>*>(find_change(observable)))
+        {
+            existing->current = current;
+            return;
+        }
+
+        add_change(
+            dispatcher,
+            observable,
+            std::make_unique<PropertyChangedEvent<TOwner, TProp>>(
+                member,
+                owner,
+                previous,
+                current));
+    }
+
+    template <typename TOwner>
+    ObservableBatchScope<TOwner>::ObservableBatchScope(TOwner& owner)
+        : _owner(&owner)
+        , _recorder(&owner)
+    {
+    }
+
+    template <typename TOwner>
+    ObservableBatchScope<TOwner>::~ObservableBatchScope() noexcept
+    {
+        commit();
+    }
+
+    template <typename TOwner>
+    void ObservableBatchScope<TOwner>::commit()
+    {
+        auto changes = _recorder.end();
+        auto* dispatcher = _recorder.get_dispatcher();
+        if (changes.empty() || !dispatcher)
+            return;
+
+        dispatcher->send<ObservableBatchChangedEvent<TOwner>>(_owner, std::move(changes));
+    }
+
     template <typename TOwner, typename TProp, Observable<TOwner, TProp> TOwner::* TMember>
     struct ObservableMemberTraits<TMember>
     {
@@ -114,7 +197,14 @@ namespace tbx
         auto* typed =
             handle_message<PropertyChangedEvent<typename Traits::Owner, typename Traits::Property>>(
                 msg);
-        if (!typed || typed->member != Traits::member)
+        if (!typed)
+        {
+            const auto* batch =
+                handle_message<ObservableBatchChangedEvent<typename Traits::Owner>>(msg);
+            return batch ? batch->find_change(Traits::member) : nullptr;
+        }
+
+        if (typed->member != Traits::member)
         {
             return nullptr;
         }
@@ -130,7 +220,14 @@ namespace tbx
         const auto* typed =
             handle_message<PropertyChangedEvent<typename Traits::Owner, typename Traits::Property>>(
                 msg);
-        if (!typed || typed->member != Traits::member)
+        if (!typed)
+        {
+            const auto* batch =
+                handle_message<ObservableBatchChangedEvent<typename Traits::Owner>>(msg);
+            return batch ? batch->find_change(Traits::member) : nullptr;
+        }
+
+        if (typed->member != Traits::member)
         {
             return nullptr;
         }
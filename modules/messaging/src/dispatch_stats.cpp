@@ -0,0 +1,20 @@
+#include "tbx/messages/dispatch_stats.h"
+#include <algorithm>
+#include <bit>
+
+namespace tbx
+{
+    void record_dispatch_time(MessageDispatchStats& stats, std::chrono::nanoseconds elapsed)
+    {
+        stats.dispatch_count += 1;
+        stats.total_time += elapsed;
+        stats.max_time = std::max(stats.max_time, elapsed);
+
+        const auto microseconds = static_cast<uint64>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        const auto bucket = std::min(
+            static_cast<size>(std::bit_width(microseconds)),
+            MessageLatencyBucketCount - 1);
+        stats.latency_histogram[bucket] += 1;
+    }
+}
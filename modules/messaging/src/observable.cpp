@@ -0,0 +1,67 @@
+#include "tbx/messages/observable.h"
+#include <algorithm>
+
+namespace tbx
+{
+    // Innermost batch last. Lives in this translation unit so every module shares one registry.
+    static thread_local std::vector<ObservableBatchRecorder*> active_batches = {};
+
+    ObservableBatchRecorder::ObservableBatchRecorder(const void* owner)
+        : _owner(owner)
+    {
+        active_batches.push_back(this);
+    }
+
+    ObservableBatchRecorder::~ObservableBatchRecorder() noexcept
+    {
+        end();
+    }
+
+    ObservableBatchRecorder* ObservableBatchRecorder::find(const void* owner)
+    {
+        for (auto it = active_batches.rbegin(); it != active_batches.rend(); ++it)
+        {
+            if ((*it)->_owner == owner)
+                return *it;
+        }
+
+        return nullptr;
+    }
+
+    std::vector<std::unique_ptr<Event>> ObservableBatchRecorder::end()
+    {
+        if (!_is_active)
+            return {};
+
+        _is_active = false;
+        std::erase(active_batches, this);
+        _observables.clear();
+        return std::move(_changes);
+    }
+
+    IMessageDispatcher* ObservableBatchRecorder::get_dispatcher() const
+    {
+        return _dispatcher;
+    }
+
+    Event* ObservableBatchRecorder::find_change(const void* observable) const
+    {
+        auto it = std::ranges::find(_observables, observable);
+        if (it == _observables.end())
+            return nullptr;
+
+        return _changes[static_cast<size>(std::distance(_observables.begin(), it))].get();
+    }
+
+    void ObservableBatchRecorder::add_change(
+        IMessageDispatcher* dispatcher,
+        const void* observable,
+        std::unique_ptr<Event> change)
+    {
+        if (!_dispatcher)
+            _dispatcher = dispatcher;
+
+        _observables.push_back(observable);
+        _changes.push_back(std::move(change));
+    }
+}
@@ -0,0 +1,115 @@
+#include "pch.h"
+#include "tbx/messages/observable.h"
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace tbx::tests::messaging
+{
+    struct ObservableTestSettings
+    {
+        ObservableTestSettings(IMessageDispatcher& dispatcher)
+            : width(&dispatcher, this, &ObservableTestSettings::width, 1)
+            , height(&dispatcher, this, &ObservableTestSettings::height, 1)
+        {
+        }
+
+        Observable<ObservableTestSettings, int> width;
+        Observable<ObservableTestSettings, int> height;
+    };
+
+    class CountingDispatcher final : public IMessageDispatcher
+    {
+      public:
+        int single_change_count = 0;
+        int batch_count = 0;
+        int last_width = 0;
+        int last_height = 0;
+        int first_previous_width = 0;
+
+      protected:
+        Result send(Message& msg) const override
+        {
+            auto& self = const_cast<CountingDispatcher&>(*this);
+            if (handle_message<PropertyChangedEvent<ObservableTestSettings, int>>(msg))
+                self.single_change_count += 1;
+            if (handle_message<ObservableBatchChangedEvent<ObservableTestSettings>>(msg))
+                self.batch_count += 1;
+
+            if (auto* width = handle_property_changed<&ObservableTestSettings::width>(msg))
+            {
+                self.last_width = width->current;
+                self.first_previous_width = width->previous;
+            }
+            if (auto* height = handle_property_changed<&ObservableTestSettings::height>(msg))
+                self.last_height = height->current;
+
+            return {};
+        }
+
+        std::shared_future<Result> post(std::unique_ptr<Message> msg) const override
+        {
+            std::promise<Result> promise = {};
+            promise.set_value(send(*msg));
+            return promise.get_future().share();
+        }
+    };
+
+    TEST(ObservableTests, SendsChangeEventPerAssignmentOutsideBatch)
+    {
+        CountingDispatcher dispatcher;
+        ObservableTestSettings settings(dispatcher);
+        dispatcher.single_change_count = 0;
+
+        settings.width = 2;
+        settings.height = 3;
+
+        EXPECT_EQ(dispatcher.single_change_count, 2);
+        EXPECT_EQ(dispatcher.batch_count, 0);
+        EXPECT_EQ(dispatcher.last_width, 2);
+        EXPECT_EQ(dispatcher.last_height, 3);
+    }
+
+    TEST(ObservableTests, BatchScopeSendsOneAggregatedEvent)
+    {
+        CountingDispatcher dispatcher;
+        ObservableTestSettings settings(dispatcher);
+        dispatcher.single_change_count = 0;
+
+        {
+            ObservableBatchScope batch(settings);
+            settings.width = 2;
+            settings.height = 3;
+            settings.width = 4;
+
+            EXPECT_EQ(dispatcher.batch_count, 0);
+            EXPECT_EQ(settings.width.value, 4);
+        }
+
+        EXPECT_EQ(dispatcher.single_change_count, 0);
+        EXPECT_EQ(dispatcher.batch_count, 1);
+        EXPECT_EQ(dispatcher.first_previous_width, 1);
+        EXPECT_EQ(dispatcher.last_width, 4);
+        EXPECT_EQ(dispatcher.last_height, 3);
+    }
+
+    TEST(ObservableTests, BatchScopeOnlyDefersItsOwner)
+    {
+        CountingDispatcher dispatcher;
+        ObservableTestSettings batched(dispatcher);
+        ObservableTestSettings unbatched(dispatcher);
+        dispatcher.single_change_count = 0;
+
+        ObservableBatchScope batch(batched);
+        unbatched.width = 5;
+        batched.width = 6;
+
+        EXPECT_EQ(dispatcher.single_change_count, 1);
+
+        batch.commit();
+        batch.commit();
+
+        EXPECT_EQ(dispatcher.batch_count, 1);
+        EXPECT_EQ(dispatcher.last_width, 6);
+    }
+}
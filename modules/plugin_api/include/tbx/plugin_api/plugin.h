@@ -7,6 +7,7 @@
 #include "tbx/time/delta_time.h"
 #include <functional>
 #include <future>
+#include <span>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -58,6 +59,11 @@ namespace tbx
             requires std::derived_from<TMessage, Message>
         std::shared_future<Result> post_message(TArgs&&... args) const;
 
+        // Helper to synchronously send a run of same-typed events as one batch via the dispatcher.
+        template <typename TEvent>
+            requires std::derived_from<TEvent, Event>
+        Result send_message_batch(std::span<TEvent> events) const;
+
       protected:
         // Called when the plugin is attached to the service provider.
         // The plugin must not retain references that outlive its own lifetime.
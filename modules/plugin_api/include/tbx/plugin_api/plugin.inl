@@ -48,4 +48,16 @@ namespace tbx
             return _dispatcher->post<TMessage>(std::forward<TArgs>(args)...);
     }
 
+    template <typename TEvent>
+        requires std::derived_from<TEvent, Event>
+    Result Plugin::send_message_batch(std::span<TEvent> events) const
+    {
+        if (!_dispatcher)
+        {
+            TBX_ASSERT(_dispatcher, "Plugins must be attached before sending messages.");
+            return dispatcher_missing_result("send a message batch");
+        }
+
+        return _dispatcher->send_batch(events);
+    }
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include "tbx/async/job_system.h"
+#include "tbx/common/typedefs.h"
 #include "tbx/files/ops.h"
 #include "tbx/messages/dispatcher.h"
 #include "tbx/plugin_api/loaded_plugin.h"
@@ -74,4 +76,40 @@ namespace tbx
     TBX_API void update_plugins_fixed(
         std::vector<LoadedPlugin>& loaded_plugins,
         const DeltaTime& dt);
+
+    /// @brief
+    /// Purpose: Groups plugin updates into ordered waves whose members may update concurrently.
+    /// @details
+    /// Ownership: Value type; stores indices into the loaded plugin list it was built from.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API PluginUpdateSchedule
+    {
+        // Waves run in order. A wave either holds a single plugin or only plugins that opted in
+        // to concurrent updates and have no conflicting reads, writes, or ordering constraints.
+        std::vector<std::vector<size>> waves = {};
+    };
+
+    /// @brief
+    /// Purpose: Builds the update waves for the loaded plugins, honoring category/priority order,
+    /// `update_after` constraints, and declared update reads/writes.
+    /// @details
+    /// Ownership: Returns an owned schedule that is invalidated when the plugin list changes.
+    /// Thread Safety: Not thread-safe; call from the main thread.
+    TBX_API PluginUpdateSchedule build_plugin_update_schedule(
+        const std::vector<LoadedPlugin>& loaded_plugins,
+        bool is_fixed_update);
+
+    /// @brief
+    /// Purpose: Runs a plugin update schedule, spreading multi-plugin waves across the job system.
+    /// @details
+    /// Ownership: Does not take ownership of plugin instances or the job system.
+    /// Thread Safety: Call from the main thread. Waits for every plugin of a wave before starting
+    /// the next one and rethrows the first exception raised by a wave. Runs serially when
+    /// `job_system` is null.
+    TBX_API void run_plugin_update_schedule(
+        std::vector<LoadedPlugin>& loaded_plugins,
+        const PluginUpdateSchedule& schedule,
+        const DeltaTime& dt,
+        bool is_fixed_update,
+        JobSystem* job_system = nullptr);
 }
@@ -2,26 +2,55 @@
 #include "tbx/files/events.h"
 #include "tbx/files/ops.h"
 #include "tbx/files/watcher.h"
+#include "tbx/messages/dispatch_stats.h"
 #include "tbx/plugin_api/loaded_plugin.h"
+#include "tbx/plugin_api/plugin_loader.h"
 #include "tbx/plugin_api/service_provider.h"
 #include "tbx/tbx_api.h"
 #include "tbx/time/delta_time.h"
 #include <chrono>
+#include <atomic>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 namespace tbx
 {
+    /// @brief
+    /// Purpose: Names an attached plugin that opted in to thread-safe messages.
+    /// @details
+    /// Ownership: Non-owning; the plugin instance is owned by the manager's loaded plugin list.
+    /// Thread Safety: Guarded by the owning PluginManager's receiver lock.
+    struct TBX_API PluginMessageReceiver
+    {
+        std::string name = {};
+        Plugin* plugin = nullptr;
+    };
+
+    /// @brief
+    /// Purpose: Time one plugin spent handling routed messages.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API PluginMessageStats
+    {
+        std::string plugin_name = {};
+        MessageDispatchStats dispatch = {};
+    };
+
     /// @brief
     /// Purpose: Owns loaded plugins for an application and manages their runtime lifecycle.
     /// @details
     /// Ownership: Owns all loaded plugin containers while using the provider for attachment and
     /// resource registration.
-    /// Thread Safety: Not thread-safe; call from the main thread.
+    /// Thread Safety: Not thread-safe; call from the main thread. The one exception is
+    /// receive_message() for messages whose dispatch policy is thread-safe, which may run on job
+    /// workers while the main thread loads or unloads plugins.
     class TBX_API PluginManager
     {
       public:
@@ -92,12 +121,50 @@ namespace tbx
         /// @brief
         /// Purpose: Routes a dispatched message to all loaded plugins.
         /// @details
+        /// Messages whose dispatch policy is thread-safe only reach plugins whose metadata opts in
+        /// to thread-safe messages; every other message reaches all attached plugins.
         /// Ownership: Does not take ownership of the message.
-        /// Thread Safety: Not thread-safe; call from the main thread.
+        /// Thread Safety: Thread-safe for thread-safe messages, which are routed through a
+        /// receiver list that load and unload update under an exclusive lock. Other messages must
+        /// be routed from the main thread.
         void receive_message(Message& msg);
 
+        /// @brief
+        /// Purpose: Enables or disables timing each plugin's message handling.
+        /// @details
+        /// Ownership: Does not transfer ownership.
+        /// Thread Safety: Thread-safe. Disabled instrumentation costs one branch per message.
+        void set_message_instrumentation_enabled(bool enabled);
+
+        /// @brief
+        /// Purpose: Returns whether per-plugin message timing is currently recording.
+        /// @details
+        /// Ownership: Returns a value copy.
+        /// Thread Safety: Thread-safe.
+        bool is_message_instrumentation_enabled() const;
+
+        /// @brief
+        /// Purpose: Returns the per-plugin message timing recorded while instrumentation was on.
+        /// @details
+        /// Ownership: Returns a snapshot owned by the caller, sorted by total time, slowest first.
+        /// Thread Safety: Thread-safe.
+        std::vector<PluginMessageStats> get_message_stats() const;
+
+        /// @brief
+        /// Purpose: Clears all recorded per-plugin message timing.
+        /// @details
+        /// Ownership: Does not transfer ownership.
+        /// Thread Safety: Thread-safe.
+        void reset_message_stats();
+
       private:
         bool should_load_plugin(const std::string& plugin_name) const;
+        void receive_message_instrumented(Message& msg);
+        void record_plugin_dispatch(
+            const std::string& plugin_name,
+            std::chrono::nanoseconds elapsed);
+        void rebuild_update_schedules();
+        void remove_thread_safe_receivers(const std::unordered_set<std::string>& lowered_names);
         void process_pending_file_changes();
         bool try_parse_plugin_meta(const std::filesystem::path& manifest_path, PluginMeta& out_meta)
             const;
@@ -109,6 +176,14 @@ namespace tbx
         std::mutex _pending_file_changes_mutex = {};
         std::vector<FileWatchChange> _pending_file_changes = {};
         std::vector<LoadedPlugin> _loaded = {};
+        std::shared_mutex _thread_safe_receivers_mutex = {};
+        std::vector<PluginMessageReceiver> _thread_safe_receivers = {};
+        std::atomic<bool> _is_message_instrumented = false;
+        mutable std::mutex _message_stats_mutex = {};
+        std::unordered_map<std::string, PluginMessageStats> _message_stats = {};
+        PluginUpdateSchedule _update_schedule = {};
+        PluginUpdateSchedule _fixed_update_schedule = {};
+        bool _is_update_schedule_dirty = true;
         std::vector<std::string> _requested_plugins = {};
 
         std::filesystem::path _directory = {};
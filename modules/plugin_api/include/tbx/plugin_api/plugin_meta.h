@@ -63,6 +63,26 @@ namespace tbx
         // Explicit update priority within the update category (lower values update first).
         uint32 priority = 0;
 
+        // Opts in to running `on_update`/`on_fixed_update` on a job worker alongside other
+        // opted-in plugins. Such plugins must only touch the state declared below and should
+        // post rather than send messages. Plugins that do not opt in always update alone.
+        bool is_concurrent_update = false;
+
+        // Services or shared resources the plugin reads during updates (e.g. "EntityRegistry").
+        std::vector<std::string> update_reads;
+
+        // Services or shared resources the plugin mutates during updates. A plugin never
+        // updates concurrently with another plugin that reads or writes the same name.
+        std::vector<std::string> update_writes;
+
+        // Plugins that must finish their update before this plugin's update starts.
+        std::vector<std::string> update_after;
+
+        // Opts in to receiving messages whose dispatch policy is thread-safe. Those messages may
+        // be handled on job workers, concurrently with each other, so only plugins whose handlers
+        // are safe to run that way see them. Other plugins never receive them.
+        bool is_thread_safe_messages = false;
+
         PluginLinkage linkage = PluginLinkage::DYNAMIC;
 
         // Path to the manifest file that produced this metadata.
@@ -7,7 +7,9 @@
 #include <algorithm>
 #include <chrono>
 #include <deque>
+#include <exception>
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -574,6 +576,65 @@ namespace tbx
         }
     }
 
+    // Moves plugins behind the plugins named in their `update_after` lists while otherwise
+    // keeping the category/priority order. Leaves the order untouched on a cycle.
+    static void apply_update_after_constraints(
+        const std::vector<LoadedPlugin>& loaded_plugins,
+        std::vector<size>& ordered_indices)
+    {
+        const size plugin_count = static_cast<size>(loaded_plugins.size());
+        auto name_to_index = std::unordered_map<std::string, size> {};
+        name_to_index.reserve(plugin_count);
+        for (size index = 0; index < plugin_count; ++index)
+            name_to_index.emplace(to_lower(loaded_plugins[index].meta.name), index);
+
+        auto successors = std::vector<std::vector<size>>(plugin_count);
+        auto pending_predecessors = std::vector<size>(plugin_count, size {0});
+        bool has_constraints = false;
+        for (size index = 0; index < plugin_count; ++index)
+        {
+            for (const std::string& predecessor : loaded_plugins[index].meta.update_after)
+            {
+                auto predecessor_it = name_to_index.find(to_lower(trim(predecessor)));
+                if (predecessor_it == name_to_index.end() || predecessor_it->second == index)
+                    continue;
+
+                successors[predecessor_it->second].push_back(index);
+                ++pending_predecessors[index];
+                has_constraints = true;
+            }
+        }
+
+        if (!has_constraints)
+            return;
+
+        auto constrained_order = std::vector<size> {};
+        constrained_order.reserve(plugin_count);
+        auto is_placed = std::vector<bool>(plugin_count, false);
+        while (constrained_order.size() < ordered_indices.size())
+        {
+            auto ready_it = std::ranges::find_if(
+                ordered_indices,
+                [&](size index)
+                {
+                    return !is_placed[index] && pending_predecessors[index] == 0U;
+                });
+            if (ready_it == ordered_indices.end())
+            {
+                TBX_TRACE_WARNING(
+                    "Plugin update_after constraints form a cycle. Using category/priority order.");
+                return;
+            }
+
+            is_placed[*ready_it] = true;
+            constrained_order.push_back(*ready_it);
+            for (size successor : successors[*ready_it])
+                --pending_predecessors[successor];
+        }
+
+        ordered_indices = std::move(constrained_order);
+    }
+
     static std::vector<size> build_update_order(
         const std::vector<LoadedPlugin>& loaded_plugins,
         bool is_fixed_update)
@@ -600,9 +661,46 @@ namespace tbx
                 return to_lower(left.name) < to_lower(right.name);
             });
 
+        apply_update_after_constraints(loaded_plugins, ordered_indices);
         return ordered_indices;
     }
 
+    static bool contains_any_name(
+        const std::vector<std::string>& names,
+        const std::vector<std::string>& candidates)
+    {
+        for (const auto& name : names)
+        {
+            const auto lowered_name = to_lower(trim(name));
+            for (const auto& candidate : candidates)
+            {
+                if (to_lower(trim(candidate)) == lowered_name)
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool has_update_conflict(const PluginMeta& left, const PluginMeta& right)
+    {
+        if (contains_any_name(left.update_writes, right.update_writes)
+            || contains_any_name(left.update_writes, right.update_reads)
+            || contains_any_name(right.update_writes, left.update_reads))
+            return true;
+
+        return contains_any_name({left.name}, right.update_after)
+               || contains_any_name({right.name}, left.update_after);
+    }
+
+    static void update_plugin(LoadedPlugin& plugin, const DeltaTime& dt, bool is_fixed_update)
+    {
+        if (is_fixed_update)
+            plugin.instance->fixed_update(dt);
+        else
+            plugin.instance->update(dt);
+    }
+
     void update_plugins(std::vector<LoadedPlugin>& loaded_plugins, const DeltaTime& dt)
     {
         auto ordered_indices = build_update_order(loaded_plugins, false);
@@ -629,6 +727,108 @@ namespace tbx
         }
     }
 
+    PluginUpdateSchedule build_plugin_update_schedule(
+        const std::vector<LoadedPlugin>& loaded_plugins,
+        bool is_fixed_update)
+    {
+        auto schedule = PluginUpdateSchedule {};
+        auto concurrent_wave = std::vector<size> {};
+        auto close_concurrent_wave = [&]()
+        {
+            if (concurrent_wave.empty())
+                return;
+
+            schedule.waves.push_back(std::move(concurrent_wave));
+            concurrent_wave.clear();
+        };
+
+        for (size index : build_update_order(loaded_plugins, is_fixed_update))
+        {
+            const auto& plugin = loaded_plugins[index];
+            if (!plugin.instance)
+                continue;
+
+            if (!plugin.meta.is_concurrent_update)
+            {
+                close_concurrent_wave();
+                schedule.waves.push_back({index});
+                continue;
+            }
+
+            const bool conflicts_with_wave = std::ranges::any_of(
+                concurrent_wave,
+                [&](size wave_index)
+                {
+                    return has_update_conflict(loaded_plugins[wave_index].meta, plugin.meta);
+                });
+            if (conflicts_with_wave)
+                close_concurrent_wave();
+
+            concurrent_wave.push_back(index);
+        }
+
+        close_concurrent_wave();
+        return schedule;
+    }
+
+    void run_plugin_update_schedule(
+        std::vector<LoadedPlugin>& loaded_plugins,
+        const PluginUpdateSchedule& schedule,
+        const DeltaTime& dt,
+        bool is_fixed_update,
+        JobSystem* job_system)
+    {
+        for (const auto& wave : schedule.waves)
+        {
+            if (wave.size() == 1U || !job_system || job_system->get_worker_count() == 0U)
+            {
+                for (size index : wave)
+                    update_plugin(loaded_plugins[index], dt, is_fixed_update);
+                continue;
+            }
+
+            auto pending_updates = std::vector<std::future<void>> {};
+            pending_updates.reserve(wave.size() - 1U);
+            for (size wave_index = 1; wave_index < wave.size(); ++wave_index)
+            {
+                auto& plugin = loaded_plugins[wave[wave_index]];
+                pending_updates.push_back(job_system->schedule_with_future(
+                    [&plugin, dt, is_fixed_update]()
+                    {
+                        update_plugin(plugin, dt, is_fixed_update);
+                    }));
+            }
+
+            // The main thread takes the first plugin, then every job must finish before the next
+            // wave starts, even when an update throws.
+            auto first_error = std::exception_ptr {};
+            try
+            {
+                update_plugin(loaded_plugins[wave.front()], dt, is_fixed_update);
+            }
+            catch (...)
+            {
+                first_error = std::current_exception();
+            }
+
+            for (auto& pending_update : pending_updates)
+            {
+                try
+                {
+                    pending_update.get();
+                }
+                catch (...)
+                {
+                    if (!first_error)
+                        first_error = std::current_exception();
+                }
+            }
+
+            if (first_error)
+                std::rethrow_exception(first_error);
+        }
+    }
+
     void unload_plugins(
         std::vector<LoadedPlugin>& loaded_plugins,
         IMessageCoordinator* coordinator)
@@ -4,6 +4,7 @@
 #include "tbx/common/typedefs.h"
 #include "tbx/files/ops.h"
 #include "tbx/plugin_api/plugin_loader.h"
+#include "tbx/profiling/macros.h"
 #include <algorithm>
 #include <ctime>
 #include <limits>
@@ -104,7 +105,19 @@ namespace tbx
 #endif
 
         _loaded.push_back(std::move(loaded_plugin));
-        _loaded.back().attach(_service_provider);
+        auto& added_plugin = _loaded.back();
+        added_plugin.attach(_service_provider);
+        _is_update_schedule_dirty = true;
+
+        if (added_plugin.meta.is_thread_safe_messages)
+        {
+            auto receivers_lock = std::unique_lock<std::shared_mutex>(_thread_safe_receivers_mutex);
+            _thread_safe_receivers.push_back(
+                PluginMessageReceiver {
+                    .name = added_plugin.meta.name,
+                    .plugin = added_plugin.instance.get(),
+                });
+        }
     }
 
     bool PluginManager::load(const PluginMeta& meta)
@@ -125,14 +138,27 @@ namespace tbx
 
     void PluginManager::update(const DeltaTime& dt)
     {
+        TBX_PROFILE_SCOPE("PluginManager::update");
         process_pending_file_changes();
-        update_plugins(_loaded, dt);
+        rebuild_update_schedules();
+        run_plugin_update_schedule(
+            _loaded,
+            _update_schedule,
+            dt,
+            false,
+            _service_provider.try_get_service<JobSystem>());
     }
 
     void PluginManager::fixed_update(const DeltaTime& dt)
     {
         process_pending_file_changes();
-        update_plugins_fixed(_loaded, dt);
+        rebuild_update_schedules();
+        run_plugin_update_schedule(
+            _loaded,
+            _fixed_update_schedule,
+            dt,
+            true,
+            _service_provider.try_get_service<JobSystem>());
     }
 
     bool PluginManager::unload(const std::string& plugin_name)
@@ -173,6 +199,7 @@ namespace tbx
         retained_plugins.reserve(_loaded.size());
         unloaded_plugins.reserve(_loaded.size());
 
+        _is_update_schedule_dirty = true;
         for (auto& plugin : _loaded)
         {
             if (names_to_unload.contains(to_lower(plugin.meta.name)))
@@ -187,6 +214,10 @@ namespace tbx
             return false;
         }
 
+        // Stop routing worker messages to the plugins before they detach. The exclusive lock waits
+        // for in-flight handlers, and is released before detach so plugins can still flush.
+        remove_thread_safe_receivers(names_to_unload);
+
         _loaded = std::move(unloaded_plugins);
         unload_plugins(_loaded, &_service_provider.get_service<IMessageCoordinator>());
         _loaded = std::move(retained_plugins);
@@ -201,7 +232,12 @@ namespace tbx
         }
 
         _watcher.reset();
+        {
+            auto receivers_lock = std::unique_lock<std::shared_mutex>(_thread_safe_receivers_mutex);
+            _thread_safe_receivers.clear();
+        }
         unload_plugins(_loaded, &_service_provider.get_service<IMessageCoordinator>());
+        _is_update_schedule_dirty = true;
 
         _directory = std::filesystem::path {};
         _working_directory = std::filesystem::path {};
@@ -211,8 +247,112 @@ namespace tbx
 
     void PluginManager::receive_message(Message& msg)
     {
+        if (_is_message_instrumented.load(std::memory_order_relaxed))
+        {
+            receive_message_instrumented(msg);
+            return;
+        }
+
+        if (msg.dispatch_policy.is_thread_safe)
+        {
+            auto receivers_lock = std::shared_lock<std::shared_mutex>(_thread_safe_receivers_mutex);
+            for (const auto& receiver : _thread_safe_receivers)
+                receiver.plugin->receive_message(msg);
+            return;
+        }
+
+        for (auto& plugin : _loaded)
+            plugin.receive_message(msg);
+    }
+
+    void PluginManager::receive_message_instrumented(Message& msg)
+    {
+        if (msg.dispatch_policy.is_thread_safe)
+        {
+            auto receivers_lock = std::shared_lock<std::shared_mutex>(_thread_safe_receivers_mutex);
+            for (const auto& receiver : _thread_safe_receivers)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                receiver.plugin->receive_message(msg);
+                record_plugin_dispatch(receiver.name, std::chrono::steady_clock::now() - start);
+            }
+            return;
+        }
+
         for (auto& plugin : _loaded)
+        {
+            const auto start = std::chrono::steady_clock::now();
             plugin.receive_message(msg);
+            record_plugin_dispatch(plugin.meta.name, std::chrono::steady_clock::now() - start);
+        }
+    }
+
+    void PluginManager::set_message_instrumentation_enabled(bool enabled)
+    {
+        _is_message_instrumented.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool PluginManager::is_message_instrumentation_enabled() const
+    {
+        return _is_message_instrumented.load(std::memory_order_relaxed);
+    }
+
+    std::vector<PluginMessageStats> PluginManager::get_message_stats() const
+    {
+        auto stats = std::vector<PluginMessageStats>();
+        {
+            auto stats_lock = std::lock_guard<std::mutex>(_message_stats_mutex);
+            stats.reserve(_message_stats.size());
+            for (const auto& [plugin_name, plugin_stats] : _message_stats)
+                stats.push_back(plugin_stats);
+        }
+
+        std::ranges::sort(
+            stats,
+            [](const PluginMessageStats& left, const PluginMessageStats& right)
+            {
+                return left.dispatch.total_time > right.dispatch.total_time;
+            });
+        return stats;
+    }
+
+    void PluginManager::reset_message_stats()
+    {
+        auto stats_lock = std::lock_guard<std::mutex>(_message_stats_mutex);
+        _message_stats.clear();
+    }
+
+    void PluginManager::record_plugin_dispatch(
+        const std::string& plugin_name,
+        std::chrono::nanoseconds elapsed)
+    {
+        auto stats_lock = std::lock_guard<std::mutex>(_message_stats_mutex);
+        auto [entry, inserted] = _message_stats.try_emplace(plugin_name);
+        if (inserted)
+            entry->second.plugin_name = plugin_name;
+        record_dispatch_time(entry->second.dispatch, elapsed);
+    }
+
+    void PluginManager::remove_thread_safe_receivers(
+        const std::unordered_set<std::string>& lowered_names)
+    {
+        auto receivers_lock = std::unique_lock<std::shared_mutex>(_thread_safe_receivers_mutex);
+        std::erase_if(
+            _thread_safe_receivers,
+            [&lowered_names](const PluginMessageReceiver& receiver)
+            {
+                return lowered_names.contains(to_lower(receiver.name));
+            });
+    }
+
+    void PluginManager::rebuild_update_schedules()
+    {
+        if (!_is_update_schedule_dirty)
+            return;
+
+        _update_schedule = build_plugin_update_schedule(_loaded, false);
+        _fixed_update_schedule = build_plugin_update_schedule(_loaded, true);
+        _is_update_schedule_dirty = false;
     }
 
     bool PluginManager::should_load_plugin(const std::string& plugin_name) const
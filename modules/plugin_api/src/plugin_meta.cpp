@@ -181,6 +181,12 @@ namespace tbx
             meta.priority = static_cast<uint32>(priority);
         }
 
+        data.try_get<bool>("concurrent_update", meta.is_concurrent_update);
+        assign_string_list(data, "update_reads", meta.update_reads);
+        assign_string_list(data, "update_writes", meta.update_writes);
+        assign_string_list(data, "update_after", meta.update_after);
+        data.try_get<bool>("thread_safe_messages", meta.is_thread_safe_messages);
+
         bool is_static = false;
         if (data.try_get<bool>("static", is_static) && is_static)
             return false;
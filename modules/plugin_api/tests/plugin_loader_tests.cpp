@@ -1,6 +1,10 @@
 #include "pch.h"
+#include "tbx/async/job_system.h"
 #include "tbx/plugin_api/plugin_loader.h"
+#include <atomic>
 #include <filesystem>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace tbx::tests::plugin_loader
@@ -16,6 +20,47 @@ namespace tbx::tests::plugin_loader
         return meta;
     }
 
+    class CountingPlugin final : public Plugin
+    {
+      public:
+        CountingPlugin(std::atomic<int>& update_count)
+            : _update_count(update_count)
+        {
+        }
+
+      protected:
+        void on_attach(ServiceProvider&) override {}
+
+        void on_update(const DeltaTime&) override
+        {
+            ++_update_count;
+        }
+
+      private:
+        std::atomic<int>& _update_count;
+    };
+
+    static LoadedPlugin make_counting_plugin(
+        const std::string& name,
+        std::atomic<int>& update_count,
+        bool is_concurrent_update,
+        std::vector<std::string> update_writes = {})
+    {
+        auto meta = make_dynamic_meta();
+        meta.name = name;
+        meta.category = PluginCategory::GAMEPLAY;
+        meta.is_concurrent_update = is_concurrent_update;
+        meta.update_writes = std::move(update_writes);
+
+        auto instance = std::unique_ptr<Plugin, PluginDeleter>(
+            new CountingPlugin(update_count),
+            [](Plugin* plugin)
+            {
+                delete plugin;
+            });
+        return LoadedPlugin(meta, {}, std::move(instance));
+    }
+
     TEST(plugin_loader, returns_empty_when_no_metadata_is_provided)
     {
         // Arrange
@@ -54,4 +99,65 @@ namespace tbx::tests::plugin_loader
         // Assert
         ASSERT_TRUE(loaded.empty());
     }
+
+    TEST(plugin_update_schedule, groups_independent_concurrent_plugins_into_one_wave)
+    {
+        // Arrange
+        auto update_count = std::atomic<int>(0);
+        auto plugins = std::vector<LoadedPlugin> {};
+        plugins.push_back(make_counting_plugin("Ai", update_count, true, {"Blackboard"}));
+        plugins.push_back(make_counting_plugin("Audio", update_count, true));
+        plugins.push_back(make_counting_plugin("Camera", update_count, false));
+        plugins.push_back(make_counting_plugin("Director", update_count, true, {"blackboard"}));
+
+        // Act
+        const auto schedule = build_plugin_update_schedule(plugins, false);
+
+        // Assert
+        ASSERT_EQ(schedule.waves.size(), 3U);
+        EXPECT_EQ(schedule.waves[0], (std::vector<size> {0, 1}));
+        EXPECT_EQ(schedule.waves[1], (std::vector<size> {2}));
+        EXPECT_EQ(schedule.waves[2], (std::vector<size> {3}));
+    }
+
+    TEST(plugin_update_schedule, splits_waves_on_write_conflicts_and_update_after)
+    {
+        // Arrange
+        auto update_count = std::atomic<int>(0);
+        auto plugins = std::vector<LoadedPlugin> {};
+        plugins.push_back(make_counting_plugin("Ai", update_count, true, {"Blackboard"}));
+        plugins.push_back(make_counting_plugin("Behaviour", update_count, true));
+        plugins.back().meta.update_reads = {"BLACKBOARD"};
+        plugins.push_back(make_counting_plugin("Crowd", update_count, true));
+        plugins.push_back(make_counting_plugin("Animation", update_count, true));
+        plugins.back().meta.update_after = {"Crowd"};
+
+        // Act
+        const auto schedule = build_plugin_update_schedule(plugins, false);
+
+        // Assert
+        ASSERT_EQ(schedule.waves.size(), 3U);
+        EXPECT_EQ(schedule.waves[0], (std::vector<size> {0}));
+        EXPECT_EQ(schedule.waves[1], (std::vector<size> {1, 2}));
+        EXPECT_EQ(schedule.waves[2], (std::vector<size> {3}));
+    }
+
+    TEST(plugin_update_schedule, runs_every_plugin_once_on_the_job_system)
+    {
+        // Arrange
+        auto update_count = std::atomic<int>(0);
+        auto plugins = std::vector<LoadedPlugin> {};
+        for (int index = 0; index < 8; ++index)
+            plugins.push_back(
+                make_counting_plugin("Plugin" + std::to_string(index), update_count, true));
+        auto job_system = JobSystem(JobSystemConfiguration {.worker_count = 4});
+        const auto schedule = build_plugin_update_schedule(plugins, false);
+
+        // Act
+        run_plugin_update_schedule(plugins, schedule, DeltaTime {}, false, &job_system);
+
+        // Assert
+        ASSERT_EQ(schedule.waves.size(), 1U);
+        EXPECT_EQ(update_count.load(), 8);
+    }
 }
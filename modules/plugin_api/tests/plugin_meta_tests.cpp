@@ -42,6 +42,32 @@ namespace tbx::tests::plugin_api
         EXPECT_EQ(meta.library_path, manifest_path.parent_path() / "bin/logger.so");
         EXPECT_EQ(meta.linkage, PluginLinkage::DYNAMIC);
     }
+    TEST(plugin_meta_parse_test, reads_concurrent_update_declarations)
+    {
+        // Arrange
+        constexpr const char* manifest_text = R"JSON({
+                "name": "Example.Ai",
+                "version": "1.0.0",
+                "concurrent_update": true,
+                "update_reads": ["EntityRegistry", " "],
+                "update_writes": ["AiBlackboard"],
+                "update_after": ["Example.Input"],
+                "thread_safe_messages": true
+            })JSON";
+
+        PluginMeta meta;
+        PluginMetaParser parser;
+
+        // Act
+        ASSERT_TRUE(parser.try_parse_from_source(manifest_text, "plugin.meta", meta));
+
+        // Assert
+        EXPECT_TRUE(meta.is_concurrent_update);
+        EXPECT_EQ(meta.update_reads, std::vector<std::string> {"EntityRegistry"});
+        EXPECT_EQ(meta.update_writes, std::vector<std::string> {"AiBlackboard"});
+        EXPECT_EQ(meta.update_after, std::vector<std::string> {"Example.Input"});
+        EXPECT_TRUE(meta.is_thread_safe_messages);
+    }
     TEST(plugin_meta_parse_test, resolves_relative_module_paths)
     {
         // Arrange
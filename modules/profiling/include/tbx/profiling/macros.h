@@ -0,0 +1,18 @@
+#pragma once
+#include "tbx/profiling/profiler.h"
+
+#define TBX_PROFILE_CONCAT_INNER(a, b) a##b
+#define TBX_PROFILE_CONCAT(a, b) TBX_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef TBX_PROFILING_ENABLED
+    // Records a zone named `name` (a string literal) from here to the end of the enclosing scope.
+    #define TBX_PROFILE_SCOPE(name)                                                                \
+        const ::tbx::ProfileScope TBX_PROFILE_CONCAT(tbx_profile_scope_, __LINE__)(name)
+
+    // Names the calling thread in exported traces.
+    #define TBX_PROFILE_THREAD(name) ::tbx::Profiler::set_thread_name(name)
+#else
+    // Profiling is compiled out; arguments are only named in an unevaluated context.
+    #define TBX_PROFILE_SCOPE(name) static_cast<void>(sizeof(name))
+    #define TBX_PROFILE_THREAD(name) static_cast<void>(sizeof(name))
+#endif
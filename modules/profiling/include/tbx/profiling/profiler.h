@@ -0,0 +1,97 @@
+#pragma once
+#include "tbx/common/result.h"
+#include "tbx/common/typedefs.h"
+#include "tbx/tbx_api.h"
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tbx
+{
+    // Completed zones each thread can hold before further zones are dropped until the next reset.
+    inline constexpr size ProfileZoneCapacityPerThread = 32768;
+
+    // Deepest zone nesting tracked per thread; deeper zones are dropped.
+    inline constexpr size ProfileMaxZoneDepth = 64;
+
+    /// @brief
+    /// Purpose: One completed profiling zone.
+    /// @details
+    /// Ownership: Value type. `name` is non-owning and must point at a string with static storage
+    /// duration, such as a literal.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API ProfileZone
+    {
+        const char* name = nullptr;
+        uint64 start_ns = 0;
+        uint64 duration_ns = 0;
+        uint32 depth = 0;
+    };
+
+    /// @brief
+    /// Purpose: Zones recorded by one thread since the last reset.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API ProfileThreadCapture
+    {
+        uint64 thread_index = 0;
+        std::string thread_name = {};
+        std::vector<ProfileZone> zones = {};
+        uint64 dropped_count = 0;
+    };
+
+    /// @brief
+    /// Purpose: Process-wide hierarchical CPU profiler that records nested zones per thread and
+    /// exports them as Chrome trace / Perfetto JSON.
+    /// @details
+    /// Ownership: Owns one fixed-size zone buffer per thread that has recorded a zone. Buffers
+    /// outlive their threads so captures include finished workers.
+    /// Thread Safety: `begin_zone`, `end_zone`, and `set_thread_name` may be called from any
+    /// thread; recording never takes a lock once a thread's buffer exists. `capture`, `reset`,
+    /// and the export functions may run while other threads record, but must not run
+    /// concurrently with each other.
+    class TBX_API Profiler final
+    {
+      public:
+        Profiler() = delete;
+
+      public:
+        // Names the calling thread in exported traces.
+        static void set_thread_name(std::string_view name);
+
+        // Opens a zone on the calling thread. `name` must have static storage duration.
+        static void begin_zone(const char* name);
+
+        // Closes the innermost open zone on the calling thread.
+        static void end_zone();
+
+        // Copies every zone recorded since the last reset, grouped by thread.
+        static std::vector<ProfileThreadCapture> capture();
+
+        // Discards all recorded zones. Zones still open on other threads are kept when they close.
+        static void reset();
+
+        // Formats a capture as Chrome trace event JSON, loadable by chrome://tracing and Perfetto.
+        static std::string to_chrome_trace(const std::vector<ProfileThreadCapture>& captures);
+
+        // Captures all recorded zones and writes them to `path` as Chrome trace event JSON.
+        static Result write_chrome_trace(const std::filesystem::path& path);
+    };
+
+    /// @brief
+    /// Purpose: Records one profiling zone covering the lifetime of the scope.
+    /// @details
+    /// Ownership: Non-owning; `name` must have static storage duration.
+    /// Thread Safety: Must be destroyed on the thread that created it.
+    class TBX_API ProfileScope final
+    {
+      public:
+        ProfileScope(const char* name);
+        ~ProfileScope() noexcept;
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+    };
+}
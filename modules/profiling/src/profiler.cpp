@@ -0,0 +1,290 @@
+#include "tbx/profiling/profiler.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace tbx
+{
+    namespace
+    {
+        // Written by its owning thread and read by `capture`. Zones below `zone_count` are
+        // immutable until the buffer adopts a newer epoch, which only happens after a reset.
+        struct ProfileThreadBuffer
+        {
+            uint64 thread_index = 0;
+            std::string thread_name = {};
+            std::unique_ptr<ProfileZone[]> zones =
+                std::make_unique<ProfileZone[]>(ProfileZoneCapacityPerThread);
+            std::atomic<size> zone_count = 0;
+            std::atomic<uint64> dropped_count = 0;
+            std::atomic<uint64> epoch = 0;
+
+            // Only touched by the owning thread.
+            std::array<ProfileZone, ProfileMaxZoneDepth> open_zones = {};
+            uint32 open_zone_count = 0;
+            uint32 overflow_depth = 0;
+        };
+
+        struct ProfileRegistry
+        {
+            std::mutex mutex = {};
+            std::vector<std::unique_ptr<ProfileThreadBuffer>> buffers = {};
+            std::atomic<uint64> epoch = 0;
+            std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+        };
+
+        // Intentionally leaked so threads that outlive static destruction can still record.
+        ProfileRegistry& get_registry()
+        {
+            static auto* registry = new ProfileRegistry();
+            return *registry;
+        }
+
+        thread_local ProfileThreadBuffer* current_buffer = nullptr;
+
+        ProfileThreadBuffer& get_thread_buffer()
+        {
+            if (current_buffer)
+                return *current_buffer;
+
+            auto& registry = get_registry();
+            auto lock = std::scoped_lock(registry.mutex);
+            auto buffer = std::make_unique<ProfileThreadBuffer>();
+            buffer->thread_index = static_cast<uint64>(registry.buffers.size());
+            buffer->thread_name = "thread " + std::to_string(buffer->thread_index);
+            buffer->epoch.store(registry.epoch.load(std::memory_order_acquire), std::memory_order_release);
+            current_buffer = buffer.get();
+            registry.buffers.push_back(std::move(buffer));
+            return *current_buffer;
+        }
+
+        uint64 get_elapsed_nanoseconds()
+        {
+            return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           std::chrono::steady_clock::now() - get_registry().origin)
+                                           .count());
+        }
+
+        void append_json_string(std::string& out, std::string_view text)
+        {
+            constexpr auto hex_digits = std::string_view("0123456789abcdef");
+
+            out += '"';
+            for (const char character : text)
+            {
+                switch (character)
+                {
+                    case '"':
+                        out += "\\\"";
+                        break;
+                    case '\\':
+                        out += "\\\\";
+                        break;
+                    case '\n':
+                        out += "\\n";
+                        break;
+                    case '\r':
+                        out += "\\r";
+                        break;
+                    case '\t':
+                        out += "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(character) < 0x20U)
+                        {
+                            out += "\\u00";
+                            out += hex_digits[(static_cast<unsigned char>(character) >> 4U) & 0xFU];
+                            out += hex_digits[static_cast<unsigned char>(character) & 0xFU];
+                        }
+                        else
+                        {
+                            out += character;
+                        }
+                        break;
+                }
+            }
+            out += '"';
+        }
+
+        // Trace timestamps are microseconds; keep nanosecond precision as three decimals.
+        void append_microseconds(std::string& out, uint64 nanoseconds)
+        {
+            const auto remainder = nanoseconds % 1000U;
+            out += std::to_string(nanoseconds / 1000U);
+            out += '.';
+            if (remainder < 100U)
+                out += '0';
+            if (remainder < 10U)
+                out += '0';
+            out += std::to_string(remainder);
+        }
+    }
+
+    void Profiler::set_thread_name(std::string_view name)
+    {
+        auto& buffer = get_thread_buffer();
+        auto lock = std::scoped_lock(get_registry().mutex);
+        buffer.thread_name = std::string(name);
+    }
+
+    void Profiler::begin_zone(const char* name)
+    {
+        auto& buffer = get_thread_buffer();
+        if (buffer.open_zone_count >= ProfileMaxZoneDepth)
+        {
+            buffer.overflow_depth += 1;
+            return;
+        }
+
+        buffer.open_zones[buffer.open_zone_count] = ProfileZone {
+            .name = name,
+            .start_ns = get_elapsed_nanoseconds(),
+            .depth = buffer.open_zone_count,
+        };
+        buffer.open_zone_count += 1;
+    }
+
+    void Profiler::end_zone()
+    {
+        if (!current_buffer)
+            return;
+
+        auto& buffer = *current_buffer;
+        if (buffer.overflow_depth > 0)
+        {
+            buffer.overflow_depth -= 1;
+            buffer.dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (buffer.open_zone_count == 0)
+            return;
+
+        buffer.open_zone_count -= 1;
+        auto zone = buffer.open_zones[buffer.open_zone_count];
+        zone.duration_ns = get_elapsed_nanoseconds() - zone.start_ns;
+
+        const auto epoch = get_registry().epoch.load(std::memory_order_acquire);
+        if (buffer.epoch.load(std::memory_order_relaxed) != epoch)
+        {
+            buffer.zone_count.store(0, std::memory_order_relaxed);
+            buffer.dropped_count.store(0, std::memory_order_relaxed);
+            buffer.epoch.store(epoch, std::memory_order_release);
+        }
+
+        const auto index = buffer.zone_count.load(std::memory_order_relaxed);
+        if (index >= ProfileZoneCapacityPerThread)
+        {
+            buffer.dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        buffer.zones[index] = zone;
+        buffer.zone_count.store(index + 1, std::memory_order_release);
+    }
+
+    std::vector<ProfileThreadCapture> Profiler::capture()
+    {
+        auto& registry = get_registry();
+        auto lock = std::scoped_lock(registry.mutex);
+        const auto epoch = registry.epoch.load(std::memory_order_acquire);
+
+        auto captures = std::vector<ProfileThreadCapture>();
+        captures.reserve(registry.buffers.size());
+        for (const auto& buffer : registry.buffers)
+        {
+            // Buffers still on an older epoch have nothing recorded since the last reset.
+            if (buffer->epoch.load(std::memory_order_acquire) != epoch)
+                continue;
+
+            const auto zone_count = buffer->zone_count.load(std::memory_order_acquire);
+            auto& capture = captures.emplace_back(
+                ProfileThreadCapture {
+                    .thread_index = buffer->thread_index,
+                    .thread_name = buffer->thread_name,
+                    .dropped_count = buffer->dropped_count.load(std::memory_order_relaxed),
+                });
+            capture.zones.assign(buffer->zones.get(), buffer->zones.get() + zone_count);
+        }
+
+        return captures;
+    }
+
+    void Profiler::reset()
+    {
+        get_registry().epoch.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::string Profiler::to_chrome_trace(const std::vector<ProfileThreadCapture>& captures)
+    {
+        auto trace = std::string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        auto is_first_event = true;
+        auto begin_event = [&trace, &is_first_event]()
+        {
+            if (!is_first_event)
+                trace += ',';
+            is_first_event = false;
+        };
+
+        for (const auto& capture : captures)
+        {
+            const auto thread_id = std::to_string(capture.thread_index);
+
+            begin_event();
+            trace += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+            trace += thread_id;
+            trace += ",\"args\":{\"name\":";
+            append_json_string(trace, capture.thread_name);
+            trace += "}}";
+
+            for (const auto& zone : capture.zones)
+            {
+                begin_event();
+                trace += "{\"name\":";
+                append_json_string(trace, zone.name ? zone.name : "");
+                trace += ",\"cat\":\"tbx\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+                trace += thread_id;
+                trace += ",\"ts\":";
+                append_microseconds(trace, zone.start_ns);
+                trace += ",\"dur\":";
+                append_microseconds(trace, zone.duration_ns);
+                trace += '}';
+            }
+        }
+
+        trace += "]}";
+        return trace;
+    }
+
+    Result Profiler::write_chrome_trace(const std::filesystem::path& path)
+    {
+        if (path.has_parent_path())
+        {
+            auto error = std::error_code();
+            std::filesystem::create_directories(path.parent_path(), error);
+        }
+
+        auto stream = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        if (!stream)
+            return Result(false, "Failed to open profile trace file: " + path.string());
+
+        stream << to_chrome_trace(capture());
+        if (!stream)
+            return Result(false, "Failed to write profile trace file: " + path.string());
+
+        return {};
+    }
+
+    ProfileScope::ProfileScope(const char* name)
+    {
+        Profiler::begin_zone(name);
+    }
+
+    ProfileScope::~ProfileScope() noexcept
+    {
+        Profiler::end_zone();
+    }
+}
@@ -0,0 +1,131 @@
+#include "pch.h"
+#include "tbx/profiling/profiler.h"
+#include <algorithm>
+#include <thread>
+
+namespace tbx::tests::profiling
+{
+    namespace
+    {
+        const ProfileThreadCapture* find_thread(
+            const std::vector<ProfileThreadCapture>& captures,
+            std::string_view thread_name)
+        {
+            auto it = std::ranges::find(captures, thread_name, &ProfileThreadCapture::thread_name);
+            return it == captures.end() ? nullptr : &*it;
+        }
+
+        const ProfileZone* find_zone(const ProfileThreadCapture& capture, std::string_view name)
+        {
+            auto it = std::ranges::find_if(
+                capture.zones,
+                [name](const ProfileZone& zone)
+                {
+                    return std::string_view(zone.name) == name;
+                });
+            return it == capture.zones.end() ? nullptr : &*it;
+        }
+    }
+
+    TEST(profiler_scope, records_nested_zones_with_depth)
+    {
+        // Arrange
+        Profiler::reset();
+        Profiler::set_thread_name("nested test");
+
+        // Act
+        {
+            ProfileScope outer("outer");
+            {
+                ProfileScope inner("inner");
+            }
+        }
+        const auto captures = Profiler::capture();
+
+        // Assert
+        const auto* thread = find_thread(captures, "nested test");
+        ASSERT_NE(thread, nullptr);
+        const auto* outer = find_zone(*thread, "outer");
+        const auto* inner = find_zone(*thread, "inner");
+        ASSERT_NE(outer, nullptr);
+        ASSERT_NE(inner, nullptr);
+        EXPECT_EQ(outer->depth, 0U);
+        EXPECT_EQ(inner->depth, 1U);
+        EXPECT_GE(inner->start_ns, outer->start_ns);
+        EXPECT_LE(inner->start_ns + inner->duration_ns, outer->start_ns + outer->duration_ns);
+    }
+
+    TEST(profiler_reset, discards_recorded_zones)
+    {
+        // Arrange
+        Profiler::set_thread_name("reset test");
+        {
+            ProfileScope zone("before reset");
+        }
+
+        // Act
+        Profiler::reset();
+        {
+            ProfileScope zone("after reset");
+        }
+        const auto captures = Profiler::capture();
+
+        // Assert
+        const auto* thread = find_thread(captures, "reset test");
+        ASSERT_NE(thread, nullptr);
+        EXPECT_EQ(find_zone(*thread, "before reset"), nullptr);
+        EXPECT_NE(find_zone(*thread, "after reset"), nullptr);
+    }
+
+    TEST(profiler_threads, records_each_thread_separately)
+    {
+        // Arrange
+        Profiler::reset();
+
+        // Act
+        auto worker = std::thread(
+            []()
+            {
+                Profiler::set_thread_name("profiler worker");
+                ProfileScope zone("worker zone");
+            });
+        worker.join();
+        const auto captures = Profiler::capture();
+
+        // Assert
+        const auto* thread = find_thread(captures, "profiler worker");
+        ASSERT_NE(thread, nullptr);
+        ASSERT_EQ(thread->zones.size(), 1U);
+        EXPECT_STREQ(thread->zones.front().name, "worker zone");
+    }
+
+    TEST(profiler_chrome_trace, emits_complete_and_thread_name_events)
+    {
+        // Arrange
+        auto capture = ProfileThreadCapture {
+            .thread_index = 3,
+            .thread_name = "render \"lane\"",
+        };
+        capture.zones.push_back(
+            ProfileZone {
+                .name = "geometry pass",
+                .start_ns = 1500,
+                .duration_ns = 2000042,
+                .depth = 0,
+            });
+
+        // Act
+        const auto trace = Profiler::to_chrome_trace({capture});
+
+        // Assert
+        EXPECT_NE(trace.find("\"traceEvents\":["), std::string::npos);
+        EXPECT_NE(
+            trace.find("\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":3,"
+                       "\"args\":{\"name\":\"render \\\"lane\\\"\"}"),
+            std::string::npos);
+        EXPECT_NE(
+            trace.find("\"name\":\"geometry pass\",\"cat\":\"tbx\",\"ph\":\"X\",\"pid\":1,"
+                       "\"tid\":3,\"ts\":1.500,\"dur\":2000.042"),
+            std::string::npos);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "tbx/common/typedefs.h"
+#include "tbx/tbx_api.h"
+#include <chrono>
+
+namespace tbx
+{
+    /// @brief
+    /// Purpose: Reports how closely a frame limiter has hit its deadlines.
+    /// @details
+    /// Ownership: Value type owned by the caller.
+    /// Thread Safety: Safe to copy between threads.
+    struct TBX_API FramePacingStats
+    {
+        uint64 frame_count = 0;
+
+        // Distance between the moment a wait returned and its deadline.
+        std::chrono::nanoseconds average_jitter = {};
+        std::chrono::nanoseconds max_jitter = {};
+
+        // How much longer than requested the OS sleep took.
+        std::chrono::nanoseconds average_sleep_overshoot = {};
+
+        // Frames that were already past their deadline when the wait started.
+        uint64 late_frame_count = 0;
+    };
+
+    /// @brief
+    /// Purpose: Caps the main loop at a target frame rate by sleeping until shortly before each
+    /// deadline and spinning for the remainder.
+    /// @details
+    /// Ownership: Value type; owns only its timing state.
+    /// Thread Safety: Not thread-safe; call from the thread that runs the loop.
+    /// In adaptive mode the spin window follows the measured sleep overshoot, so the limiter
+    /// sleeps as long as the OS timer allows and spins only as much as needed, never more than 2 ms.
+    /// On Windows sleeps use a high-resolution waitable timer so short sleeps stay accurate.
+    class TBX_API FrameLimiter
+    {
+      public:
+        FrameLimiter(double target_frame_rate = 0.0, bool is_adaptive = true);
+
+      public:
+        // Frames per second to pace to. Zero or less disables limiting.
+        double get_target_frame_rate() const;
+        void set_target_frame_rate(double target_frame_rate);
+
+        bool is_adaptive() const;
+        void set_adaptive(bool is_adaptive);
+
+        // Time before a deadline at which the limiter stops sleeping and starts spinning.
+        // Setting it explicitly is only useful when adaptive mode is off.
+        std::chrono::nanoseconds get_spin_threshold() const;
+        void set_spin_threshold(std::chrono::nanoseconds spin_threshold);
+
+        // Blocks until the next frame deadline and returns how long it waited.
+        // The first call after construction, reset, or a rate change only starts the schedule.
+        // A frame that runs more than one period late restarts the schedule instead of
+        // letting the following frames run back to back to catch up.
+        std::chrono::nanoseconds wait_for_next_frame();
+
+        FramePacingStats get_stats() const;
+        void reset_stats();
+
+        // Restarts the deadline schedule and clears statistics.
+        void reset();
+
+      private:
+        void record_frame(std::chrono::nanoseconds jitter, bool is_late);
+        void record_sleep_overshoot(std::chrono::nanoseconds overshoot);
+
+      private:
+        double _target_frame_rate = 0.0;
+        bool _is_adaptive = true;
+        std::chrono::nanoseconds _spin_threshold = {};
+        std::chrono::nanoseconds _average_sleep_overshoot = {};
+
+        bool _has_deadline = false;
+        std::chrono::steady_clock::time_point _next_deadline = {};
+
+        uint64 _frame_count = 0;
+        uint64 _sleep_count = 0;
+        uint64 _late_frame_count = 0;
+        std::chrono::nanoseconds _total_jitter = {};
+        std::chrono::nanoseconds _max_jitter = {};
+        std::chrono::nanoseconds _total_sleep_overshoot = {};
+    };
+}
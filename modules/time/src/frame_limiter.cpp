@@ -0,0 +1,228 @@
+#include "tbx/time/frame_limiter.h"
+#include <algorithm>
+#include <thread>
+#if defined(TBX_PLATFORM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif
+#endif
+
+namespace tbx
+{
+    namespace
+    {
+        constexpr auto DefaultSpinThreshold = std::chrono::nanoseconds(std::chrono::milliseconds(2));
+        constexpr auto MinSpinThreshold = std::chrono::nanoseconds(std::chrono::microseconds(100));
+        // Spinning burns a core, so the window stays small even when the OS sleeps coarsely.
+        constexpr auto MaxSpinThreshold = std::chrono::nanoseconds(std::chrono::milliseconds(2));
+
+        // Weight of the newest sample in the adaptive overshoot average.
+        constexpr int64 OvershootSmoothing = 8;
+
+#if defined(TBX_PLATFORM_WINDOWS)
+        // Owns a per-thread high-resolution waitable timer. Sleep() is tied to the ~15.6 ms system
+        // tick, which would leave the capped spin window far too small.
+        struct HighResolutionTimer
+        {
+            HighResolutionTimer()
+                : handle(CreateWaitableTimerExW(
+                      nullptr,
+                      nullptr,
+                      CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                      TIMER_ALL_ACCESS))
+            {
+            }
+
+            ~HighResolutionTimer()
+            {
+                if (handle != nullptr)
+                    CloseHandle(handle);
+            }
+
+            HighResolutionTimer(const HighResolutionTimer&) = delete;
+            HighResolutionTimer& operator=(const HighResolutionTimer&) = delete;
+
+            HANDLE handle = nullptr;
+        };
+#endif
+
+        void sleep_precise(std::chrono::nanoseconds duration)
+        {
+#if defined(TBX_PLATFORM_WINDOWS)
+            thread_local auto timer = HighResolutionTimer();
+            if (timer.handle != nullptr)
+            {
+                // Negative due times are relative, in 100 ns units.
+                auto due_time = LARGE_INTEGER {};
+                due_time.QuadPart = -std::max<LONGLONG>(duration.count() / 100, 1);
+                if (SetWaitableTimerEx(timer.handle, &due_time, 0, nullptr, nullptr, nullptr, 0))
+                {
+                    WaitForSingleObject(timer.handle, INFINITE);
+                    return;
+                }
+            }
+#endif
+            std::this_thread::sleep_for(duration);
+        }
+    }
+
+    FrameLimiter::FrameLimiter(double target_frame_rate, bool is_adaptive)
+        : _target_frame_rate(target_frame_rate)
+        , _is_adaptive(is_adaptive)
+        , _spin_threshold(DefaultSpinThreshold)
+        , _average_sleep_overshoot(DefaultSpinThreshold / 2)
+    {
+    }
+
+    double FrameLimiter::get_target_frame_rate() const
+    {
+        return _target_frame_rate;
+    }
+
+    void FrameLimiter::set_target_frame_rate(double target_frame_rate)
+    {
+        if (_target_frame_rate == target_frame_rate)
+            return;
+
+        _target_frame_rate = target_frame_rate;
+        _has_deadline = false;
+    }
+
+    bool FrameLimiter::is_adaptive() const
+    {
+        return _is_adaptive;
+    }
+
+    void FrameLimiter::set_adaptive(bool is_adaptive)
+    {
+        _is_adaptive = is_adaptive;
+    }
+
+    std::chrono::nanoseconds FrameLimiter::get_spin_threshold() const
+    {
+        return _spin_threshold;
+    }
+
+    void FrameLimiter::set_spin_threshold(std::chrono::nanoseconds spin_threshold)
+    {
+        _spin_threshold = std::max(spin_threshold, std::chrono::nanoseconds {});
+    }
+
+    std::chrono::nanoseconds FrameLimiter::wait_for_next_frame()
+    {
+        if (_target_frame_rate <= 0.0)
+        {
+            _has_deadline = false;
+            return {};
+        }
+
+        const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double>(1.0 / _target_frame_rate));
+        const auto wait_start = std::chrono::steady_clock::now();
+        if (!_has_deadline)
+        {
+            _next_deadline = wait_start + period;
+            _has_deadline = true;
+            return {};
+        }
+
+        const auto deadline = _next_deadline;
+        if (wait_start >= deadline)
+        {
+            record_frame({}, true);
+            _next_deadline = wait_start - deadline > period ? wait_start + period : deadline + period;
+            return {};
+        }
+
+        const auto remaining = deadline - wait_start;
+        if (remaining > _spin_threshold)
+        {
+            const auto requested_sleep = remaining - _spin_threshold;
+            sleep_precise(requested_sleep);
+            const auto actual_sleep = std::chrono::steady_clock::now() - wait_start;
+            record_sleep_overshoot(std::max(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(actual_sleep - requested_sleep),
+                std::chrono::nanoseconds {}));
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        while (now < deadline)
+        {
+            std::this_thread::yield();
+            now = std::chrono::steady_clock::now();
+        }
+
+        record_frame(std::chrono::duration_cast<std::chrono::nanoseconds>(now - deadline), false);
+        _next_deadline = deadline + period;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(now - wait_start);
+    }
+
+    FramePacingStats FrameLimiter::get_stats() const
+    {
+        auto stats = FramePacingStats {
+            .frame_count = _frame_count,
+            .max_jitter = _max_jitter,
+            .late_frame_count = _late_frame_count,
+        };
+
+        const auto on_time_count = _frame_count - _late_frame_count;
+        if (on_time_count > 0)
+            stats.average_jitter = _total_jitter / static_cast<int64>(on_time_count);
+        if (_sleep_count > 0)
+            stats.average_sleep_overshoot = _total_sleep_overshoot / static_cast<int64>(_sleep_count);
+
+        return stats;
+    }
+
+    void FrameLimiter::reset_stats()
+    {
+        _frame_count = 0;
+        _sleep_count = 0;
+        _late_frame_count = 0;
+        _total_jitter = {};
+        _max_jitter = {};
+        _total_sleep_overshoot = {};
+    }
+
+    void FrameLimiter::reset()
+    {
+        _has_deadline = false;
+        reset_stats();
+    }
+
+    void FrameLimiter::record_frame(std::chrono::nanoseconds jitter, bool is_late)
+    {
+        ++_frame_count;
+        if (is_late)
+        {
+            ++_late_frame_count;
+            return;
+        }
+
+        _total_jitter += jitter;
+        _max_jitter = std::max(_max_jitter, jitter);
+    }
+
+    void FrameLimiter::record_sleep_overshoot(std::chrono::nanoseconds overshoot)
+    {
+        ++_sleep_count;
+        _total_sleep_overshoot += overshoot;
+        if (!_is_adaptive)
+            return;
+
+        // Grow at once when a sleep overshoots the spin window, shrink gradually as sleeps settle.
+        _average_sleep_overshoot += (overshoot - _average_sleep_overshoot) / OvershootSmoothing;
+        auto spin_threshold = std::max(
+            _average_sleep_overshoot * 2,
+            _spin_threshold - _spin_threshold / OvershootSmoothing);
+        spin_threshold = std::max(spin_threshold, overshoot);
+        _spin_threshold = std::clamp(spin_threshold, MinSpinThreshold, MaxSpinThreshold);
+    }
+}
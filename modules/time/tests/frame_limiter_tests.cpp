@@ -0,0 +1,73 @@
+#include "pch.h"
+#include "tbx/time/frame_limiter.h"
+#include <chrono>
+#include <thread>
+
+namespace tbx::tests::time
+{
+    using namespace std::chrono_literals;
+
+    TEST(frame_limiter_pacing, holds_frames_to_target_period)
+    {
+        // Arrange
+        auto limiter = FrameLimiter(200.0);
+        limiter.wait_for_next_frame();
+        const auto start = std::chrono::steady_clock::now();
+
+        // Act
+        for (int frame = 0; frame < 10; ++frame)
+            limiter.wait_for_next_frame();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        // Assert
+        EXPECT_GE(elapsed, 49ms);
+        EXPECT_EQ(limiter.get_stats().frame_count, 10U);
+    }
+
+    TEST(frame_limiter_pacing, returns_immediately_when_disabled)
+    {
+        // Arrange
+        auto limiter = FrameLimiter();
+
+        // Act
+        const auto waited = limiter.wait_for_next_frame();
+        const auto waited_again = limiter.wait_for_next_frame();
+
+        // Assert
+        EXPECT_EQ(waited, 0ns);
+        EXPECT_EQ(waited_again, 0ns);
+        EXPECT_EQ(limiter.get_stats().frame_count, 0U);
+    }
+
+    TEST(frame_limiter_pacing, restarts_schedule_after_long_stall)
+    {
+        // Arrange
+        auto limiter = FrameLimiter(100.0);
+        limiter.wait_for_next_frame();
+        std::this_thread::sleep_for(40ms);
+
+        // Act
+        const auto late_wait = limiter.wait_for_next_frame();
+        const auto next_wait = limiter.wait_for_next_frame();
+
+        // Assert
+        EXPECT_EQ(late_wait, 0ns);
+        EXPECT_GE(next_wait, 5ms);
+        EXPECT_EQ(limiter.get_stats().late_frame_count, 1U);
+    }
+
+    TEST(frame_limiter_adaptive, keeps_spin_threshold_within_bounds)
+    {
+        // Arrange
+        auto limiter = FrameLimiter(250.0, true);
+        limiter.wait_for_next_frame();
+
+        // Act
+        for (int frame = 0; frame < 20; ++frame)
+            limiter.wait_for_next_frame();
+
+        // Assert
+        EXPECT_GE(limiter.get_spin_threshold(), 100us);
+        EXPECT_LE(limiter.get_spin_threshold(), 2ms);
+    }
+}
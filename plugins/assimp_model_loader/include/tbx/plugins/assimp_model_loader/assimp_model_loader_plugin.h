@@ -1,7 +1,10 @@
 #pragma once
+#include "tbx/assets/cooked_cache.h"
 #include "tbx/assets/requests.h"
+#include "tbx/files/ops.h"
 #include "tbx/plugin_api/plugin.h"
 #include "tbx/plugin_api/plugin_export.h"
+#include <memory>
 
 namespace assimp_model_loader
 {
@@ -13,6 +16,9 @@ namespace assimp_model_loader
         void on_recieve_message(tbx::Message& msg) override;
 
       private:
-        static void on_load_model_request(tbx::LoadModelRequest& request);
+        void on_load_model_request(tbx::LoadModelRequest& request) const;
+
+        std::shared_ptr<tbx::IFileOps> _file_ops = {};
+        std::unique_ptr<tbx::CookedAssetCache> _cooked_cache = {};
     };
 }
@@ -1,6 +1,9 @@
 #include "tbx/plugins/assimp_model_loader/assimp_model_loader_plugin.h"
+#include "tbx/app/settings.h"
+#include "tbx/assets/manager.h"
 #include "tbx/assets/requests.h"
 #include "tbx/common/string_utils.h"
+#include "tbx/debugging/macros.h"
 #include "tbx/graphics/material.h"
 #include "tbx/graphics/mesh.h"
 #include "tbx/graphics/model.h"
@@ -16,6 +19,11 @@
 
 namespace assimp_model_loader
 {
+    // Configure Assimp post-processing for engine-friendly meshes.
+    static constexpr unsigned int ImportFlags =
+        aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_CalcTangentSpace
+        | aiProcess_JoinIdenticalVertices | aiProcess_FlipUVs;
+
     static std::string build_load_failure_message(
         const std::filesystem::path& path,
         const char* reason)
@@ -183,9 +191,18 @@ namespace assimp_model_loader
         }
     }
 
-    void AssimpModelLoaderPlugin::on_attach(tbx::ServiceProvider&) {}
+    void AssimpModelLoaderPlugin::on_attach(tbx::ServiceProvider& service_provider)
+    {
+        const auto& paths = service_provider.get_service<tbx::AppSettings>().paths;
+        if (!_file_ops)
+            _file_ops = service_provider.get_service<tbx::AssetManager>().get_file_ops();
+        _cooked_cache = std::make_unique<tbx::CookedAssetCache>(paths.cooked_assets_directory);
+    }
 
-    void AssimpModelLoaderPlugin::on_detach() {}
+    void AssimpModelLoaderPlugin::on_detach()
+    {
+        _cooked_cache.reset();
+    }
 
     void AssimpModelLoaderPlugin::on_recieve_message(tbx::Message& msg)
     {
@@ -198,7 +215,7 @@ namespace assimp_model_loader
         on_load_model_request(*request);
     }
 
-    void AssimpModelLoaderPlugin::on_load_model_request(tbx::LoadModelRequest& request)
+    void AssimpModelLoaderPlugin::on_load_model_request(tbx::LoadModelRequest& request) const
     {
         // Validate request payload before attempting to import.
         auto* asset = request.asset;
@@ -217,13 +234,38 @@ namespace assimp_model_loader
             return;
         }
 
+        // Reuse a cooked copy of this exact source file when one exists.
+        const auto source_data = _file_ops ? _file_ops->map_file(request.path) : tbx::FileView();
+        auto cooked_key = tbx::CookedAssetKey();
+        const bool has_source_data = source_data.is_valid();
+        const bool can_cook = _cooked_cache && has_source_data;
+        if (can_cook)
+        {
+            cooked_key = tbx::CookedAssetCache::make_key(
+                source_data.get_data(),
+                "assimp:" + std::to_string(ImportFlags));
+            if (_cooked_cache->try_read(cooked_key, *asset))
+            {
+                request.state = tbx::MessageState::HANDLED;
+                return;
+            }
+        }
+
         Assimp::Importer importer;
-        // Configure Assimp post-processing for engine-friendly meshes.
-        unsigned int flags = aiProcess_Triangulate | aiProcess_GenNormals
-                             | aiProcess_CalcTangentSpace | aiProcess_JoinIdenticalVertices
-                             | aiProcess_FlipUVs;
         // Load the scene with Assimp.
-        const aiScene* scene = importer.ReadFile(request.path.string(), flags);
+        const aiScene* scene = importer.ReadFile(request.path.string(), ImportFlags);
+
+        // Archived models have no loose file, so import the bytes read through the file ops.
+        // Formats that reference sibling files still need those siblings on disk.
+        if (!scene && has_source_data)
+        {
+            const auto extension = request.path.extension().string();
+            scene = importer.ReadFileFromMemory(
+                source_data.get_data().data(),
+                source_data.get_size(),
+                ImportFlags,
+                extension.empty() ? "" : extension.c_str() + 1);
+        }
         if (!scene || !scene->HasMeshes())
         {
             request.state = tbx::MessageState::ERROR;
@@ -362,6 +404,13 @@ namespace assimp_model_loader
         model.meshes = std::move(meshes);
         model.materials = std::move(materials);
         model.parts = std::move(parts);
+
+        if (can_cook)
+        {
+            if (const auto cook_result = _cooked_cache->write(cooked_key, model); !cook_result)
+                TBX_TRACE_WARNING("Failed to cook model: {}", cook_result.get_report());
+        }
+
         *asset = std::move(model);
 
         // Mark the request as handled on success.
@@ -21,6 +21,6 @@ namespace glsl_shader_loader
 
         tbx::AssetManager* _asset_manager = nullptr;
         std::filesystem::path _working_directory = {};
-        std::unique_ptr<tbx::IFileOps> _file_ops = {};
+        std::shared_ptr<tbx::IFileOps> _file_ops = {};
     };
 }
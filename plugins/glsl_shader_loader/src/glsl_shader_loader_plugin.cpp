@@ -311,7 +311,7 @@ namespace glsl_shader_loader
         _asset_manager = &service_provider.get_service<tbx::AssetManager>();
         _working_directory = service_provider.get_service<tbx::AppSettings>().paths.working_directory;
         if (!_file_ops)
-            _file_ops = std::make_unique<tbx::FileOperator>(_working_directory);
+            _file_ops = service_provider.get_service<tbx::AssetManager>().get_file_ops();
     }
 
     void GlslShaderLoaderPlugin::on_detach()
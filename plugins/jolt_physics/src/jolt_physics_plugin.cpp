@@ -13,6 +13,7 @@
 #include "tbx/math/transform.h"
 #include "tbx/physics/collider.h"
 #include "tbx/physics/physics.h"
+#include "tbx/profiling/macros.h"
 #include <Jolt/Core/JobSystemThreadPool.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Jolt.h>
@@ -705,6 +706,8 @@ namespace jolt_physics
                     get_object_vs_broad_phase_layer_filter(),
                     get_object_layer_pair_filter());
 
+                // Fixed steps no longer re-apply settings, so the values current at attach are
+                // applied here once; later changes arrive as property change events.
                 apply_world_settings();
                 _is_ready = true;
             });
@@ -736,15 +739,18 @@ namespace jolt_physics
                 if (!_is_ready || !_temp_allocator || !_job_system)
                     return;
 
-                apply_world_settings();
                 process_pending_mesh_collider_refreshes();
                 sync_entities_to_world(static_cast<float>(dt.seconds));
 
-                JPH::EPhysicsUpdateError update_error = _physics_system.Update(
-                    static_cast<float>(std::max(0.0001, dt.seconds)),
-                    1,
-                    _temp_allocator.get(),
-                    _job_system.get());
+                auto update_error = JPH::EPhysicsUpdateError::None;
+                {
+                    TBX_PROFILE_SCOPE("JPH::PhysicsSystem::Update");
+                    update_error = _physics_system.Update(
+                        static_cast<float>(std::max(0.0001, dt.seconds)),
+                        1,
+                        _temp_allocator.get(),
+                        _job_system.get());
+                }
                 if (update_error != JPH::EPhysicsUpdateError::None)
                     TBX_TRACE_WARNING(
                         "Jolt physics update reported error flags: {}",
@@ -771,6 +777,21 @@ namespace jolt_physics
             return;
         }
 
+        // Batched settings changes arrive as one event, so the world is reconfigured once.
+        if (tbx::handle_property_changed<&tbx::PhysicsSettings::gravity>(msg)
+            || tbx::handle_property_changed<&tbx::PhysicsSettings::solver_velocity_iterations>(msg)
+            || tbx::handle_property_changed<&tbx::PhysicsSettings::solver_position_iterations>(
+                msg))
+        {
+            run_on_physics_lane_and_wait(
+                [this]()
+                {
+                    if (_is_ready)
+                        apply_world_settings();
+                });
+            return;
+        }
+
         if (auto* raycast_request = handle_message<tbx::RaycastRequest>(msg))
         {
             run_on_physics_lane_and_wait(
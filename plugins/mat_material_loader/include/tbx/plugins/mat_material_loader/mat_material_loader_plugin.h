@@ -1,4 +1,5 @@
 #pragma once
+#include "tbx/assets/cooked_cache.h"
 #include "tbx/assets/manager.h"
 #include "tbx/assets/requests.h"
 #include "tbx/files/ops.h"
@@ -36,5 +37,6 @@ namespace mat_material_loader
 
         std::filesystem::path _working_directory = {};
         std::shared_ptr<tbx::IFileOps> _file_ops = {};
+        std::unique_ptr<tbx::CookedAssetCache> _cooked_cache = {};
     };
 }
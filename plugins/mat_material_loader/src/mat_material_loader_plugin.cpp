@@ -1,6 +1,8 @@
 #include "tbx/plugins/mat_material_loader/mat_material_loader_plugin.h"
 #include "tbx/app/settings.h"
+#include "tbx/assets/manager.h"
 #include "tbx/common/string_utils.h"
+#include "tbx/debugging/macros.h"
 #include "tbx/files/ops.h"
 #include "tbx/files/json.h"
 #include "tbx/graphics/material.h"
@@ -576,15 +578,17 @@ namespace mat_material_loader
 
     void MatMaterialLoaderPlugin::on_attach(tbx::ServiceProvider& service_provider)
     {
-        _working_directory =
-            service_provider.get_service<tbx::AppSettings>().paths.working_directory;
+        const auto& paths = service_provider.get_service<tbx::AppSettings>().paths;
+        _working_directory = paths.working_directory;
         if (!_file_ops)
-            _file_ops = std::make_shared<tbx::FileOperator>(_working_directory);
+            _file_ops = service_provider.get_service<tbx::AssetManager>().get_file_ops();
+        _cooked_cache = std::make_unique<tbx::CookedAssetCache>(paths.cooked_assets_directory);
     }
 
     void MatMaterialLoaderPlugin::on_detach()
     {
         _working_directory = std::filesystem::path();
+        _cooked_cache.reset();
     }
 
     void MatMaterialLoaderPlugin::set_file_ops(std::shared_ptr<tbx::IFileOps> file_ops)
@@ -643,6 +647,13 @@ namespace mat_material_loader
             return;
         }
 
+        const auto cooked_key = tbx::CookedAssetCache::make_key(file_data, "mat");
+        if (_cooked_cache && _cooked_cache->try_read(cooked_key, *asset))
+        {
+            request.state = tbx::MessageState::HANDLED;
+            return;
+        }
+
         tbx::Material parsed_material;
         std::string parse_error;
         if (!try_parse_material(file_data, parsed_material, parse_error))
@@ -652,6 +663,13 @@ namespace mat_material_loader
             return;
         }
 
+        if (_cooked_cache)
+        {
+            if (const auto cook_result = _cooked_cache->write(cooked_key, parsed_material);
+                !cook_result)
+                TBX_TRACE_WARNING("Failed to cook material: {}", cook_result.get_report());
+        }
+
         *asset = std::move(parsed_material);
 
         request.state = tbx::MessageState::HANDLED;
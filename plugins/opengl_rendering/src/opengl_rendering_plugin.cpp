@@ -1,7 +1,9 @@
 #include "tbx/plugins/opengl_rendering/opengl_rendering_plugin.h"
 #include "opengl_renderer.h"
+#include "tbx/app/settings.h"
 #include "tbx/assets/manager.h"
 #include "tbx/async/job_system.h"
+#include "tbx/debugging/macros.h"
 
 namespace opengl_rendering
 {
@@ -10,6 +12,11 @@ namespace opengl_rendering
     void OpenGlRenderingPlugin::on_attach(tbx::ServiceProvider& service_provider)
     {
         _service_provider = &service_provider;
+        if (service_provider.get_service<tbx::AppSettings>().run.is_headless)
+        {
+            TBX_TRACE_INFO("Skipping OpenGL renderer because the application is headless.");
+            return;
+        }
 
         auto& asset_manager = service_provider.get_service<tbx::AssetManager>();
         auto& job_system = service_provider.get_service<tbx::JobSystem>();
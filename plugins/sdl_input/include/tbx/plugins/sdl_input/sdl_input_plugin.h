@@ -28,5 +28,6 @@ namespace sdl_input
         tbx::ServiceProvider* _service_provider = nullptr;
         SdlInputManager* _input_manager = nullptr;
         bool _owns_gamepad_subsystem = false;
+        bool _is_headless = false;
     };
 }
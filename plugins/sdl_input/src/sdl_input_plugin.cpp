@@ -1,5 +1,6 @@
 #include "tbx/plugins/sdl_input/sdl_input_plugin.h"
 #include "sdl_input_manager.h"
+#include "tbx/app/settings.h"
 #include "tbx/debugging/macros.h"
 #include <memory>
 
@@ -17,6 +18,14 @@ namespace sdl_input
         _input_manager =
             static_cast<SdlInputManager*>(service_provider.try_get_service<tbx::IInputManager>());
 
+        // Headless runs keep the service so gameplay can query it, but never poll SDL devices.
+        if (service_provider.get_service<tbx::AppSettings>().run.is_headless)
+        {
+            TBX_TRACE_INFO("Skipping SDL input devices because the application is headless.");
+            _is_headless = true;
+            return;
+        }
+
         if ((SDL_WasInit(GamepadSubsystemMask) & GamepadSubsystemMask) == GamepadSubsystemMask)
         {
             _owns_gamepad_subsystem = false;
@@ -38,13 +47,15 @@ namespace sdl_input
 
     void SdlInputPlugin::on_detach()
     {
-        SDL_RemoveEventWatch(accumulate_wheel_delta, this);
+        if (!_is_headless)
+            SDL_RemoveEventWatch(accumulate_wheel_delta, this);
 
         if (_service_provider && _service_provider->has_service<tbx::IInputManager>())
             _service_provider->deregister_service<tbx::IInputManager>();
 
         _input_manager = nullptr;
         _service_provider = nullptr;
+        _is_headless = false;
 
         if (_owns_gamepad_subsystem)
             SDL_QuitSubSystem(GamepadSubsystemMask);
@@ -53,7 +64,7 @@ namespace sdl_input
 
     void SdlInputPlugin::on_update(const tbx::DeltaTime&)
     {
-        if (_input_manager)
+        if (_input_manager && !_is_headless)
             _input_manager->update_backend_state();
     }
 
@@ -25,8 +25,14 @@ namespace sdl_opengl_adapter
     void SdlOpenGlAdapterPlugin::on_attach(tbx::ServiceProvider& service_provider)
     {
         _service_provider = &service_provider;
-        _window_manager = service_provider.try_get_service<tbx::IWindowManager>();
         auto& settings = service_provider.get_service<tbx::AppSettings>();
+        if (settings.run.is_headless)
+        {
+            TBX_TRACE_INFO("Skipping SDL OpenGL adapter because the application is headless.");
+            return;
+        }
+
+        _window_manager = service_provider.try_get_service<tbx::IWindowManager>();
         _use_opengl = settings.graphics.graphics_api == tbx::GraphicsApi::OPEN_GL;
         _vsync_enabled = settings.graphics.vsync_enabled;
 
@@ -72,7 +78,6 @@ namespace sdl_opengl_adapter
         {
             _vsync_enabled = vsync_event->current;
             _open_gl_adapter->set_vsync(to_vsync_mode(_vsync_enabled));
-            return;
         }
 
         if (const auto* graphics_event =
@@ -179,6 +179,7 @@ namespace sdl_windowing
             return true;
 
         auto previous_handle = static_cast<tbx::NativeWindowHandle>(record->sdl_window);
+        send_native_handle_releasing(record->id, previous_handle);
         SDL_DestroyWindow(record->sdl_window);
         record->sdl_window = nullptr;
         record->is_open = false;
@@ -386,9 +387,13 @@ namespace sdl_windowing
         _pending_close_window_ids.clear();
         for (auto& [window_id, record] : _windows)
         {
-            (void)window_id;
             if (record.sdl_window)
+            {
+                send_native_handle_releasing(
+                    window_id,
+                    static_cast<tbx::NativeWindowHandle>(record.sdl_window));
                 SDL_DestroyWindow(record.sdl_window);
+            }
             record.sdl_window = nullptr;
             record.is_open = false;
         }
@@ -434,6 +439,7 @@ namespace sdl_windowing
                 continue;
 
             auto previous_handle = static_cast<tbx::NativeWindowHandle>(record.sdl_window);
+            send_native_handle_releasing(window_id, previous_handle);
             SDL_DestroyWindow(record.sdl_window);
             record.sdl_window = create_sdl_window(record);
             if (record.sdl_window)
@@ -540,6 +546,14 @@ namespace sdl_windowing
                 current_handle);
     }
 
+    void SdlWindowManager::send_native_handle_releasing(
+        const tbx::Window& window,
+        tbx::NativeWindowHandle handle) const
+    {
+        if (_dispatcher)
+            _dispatcher->send<tbx::WindowNativeHandleReleasingEvent>(window, handle);
+    }
+
     void SdlWindowManager::send_window_closed(const tbx::Window& window) const
     {
         if (_dispatcher)
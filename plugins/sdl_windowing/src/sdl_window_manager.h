@@ -58,6 +58,9 @@ namespace sdl_windowing
             const tbx::Window& window,
             tbx::NativeWindowHandle previous_handle,
             tbx::NativeWindowHandle current_handle) const;
+        void send_native_handle_releasing(
+            const tbx::Window& window,
+            tbx::NativeWindowHandle handle) const;
         void send_window_closed(const tbx::Window& window) const;
         void send_window_mode_changed(
             const tbx::Window& window,
@@ -46,6 +46,12 @@ namespace sdl_windowing
     {
         _service_provider = &service_provider;
 
+        if (service_provider.get_service<tbx::AppSettings>().run.is_headless)
+        {
+            TBX_TRACE_INFO("Skipping SDL video subsystem because the application is headless.");
+            return;
+        }
+
         if (!SDL_InitSubSystem(SDL_INIT_VIDEO))
         {
             TBX_TRACE_ERROR("Failed to initialize SDL video subsystem. Error: {}", SDL_GetError());
@@ -1,4 +1,5 @@
 #pragma once
+#include "tbx/assets/cooked_cache.h"
 #include "tbx/assets/requests.h"
 #include "tbx/files/ops.h"
 #include "tbx/plugin_api/plugin.h"
@@ -11,8 +12,8 @@ namespace stb_image_loader
     /// Purpose: Loads texture assets into tbx::Texture payloads using stb_image.
     /// @details
     /// Ownership: tbx::Plugin lifetime is owned by the host; it keeps non-owning references to the
-    /// host. Thread Safety: Handles asset messages on the dispatcher thread; no internal
-    /// synchronization.
+    /// host. Thread Safety: Texture load requests may arrive concurrently on job workers. Loads
+    /// only read plugin state that is set in on_attach, and the stb flip flag is set there once.
     class TBX_PLUGIN_API StbImageLoaderPlugin final : public tbx::Plugin
     {
       public:
@@ -23,13 +24,14 @@ namespace stb_image_loader
         /// Purpose: Receives texture load requests and dispatches stb image loads.
         /// @details
         /// Ownership: Does not take ownership of messages or asset payloads.
-        /// Thread Safety: Executes on the dispatcher thread; relies on tbx::Texture payload
-        /// synchronization.
+        /// Thread Safety: May run concurrently on job workers; each request decodes into its own
+        /// tbx::Texture payload.
         void on_recieve_message(tbx::Message& msg) override;
 
       private:
         void on_load_texture_request(tbx::LoadTextureRequest& request) const;
 
-        std::unique_ptr<tbx::IFileOps> _file_ops = {};
+        std::shared_ptr<tbx::IFileOps> _file_ops = {};
+        std::unique_ptr<tbx::CookedAssetCache> _cooked_cache = {};
     };
 }
@@ -1,5 +1,6 @@
 #include "tbx/plugins/stb_image_loader/stb_image_loader_plugin.h"
 #include "tbx/app/settings.h"
+#include "tbx/assets/manager.h"
 #include "tbx/assets/requests.h"
 #include "tbx/files/ops.h"
 #include "tbx/files/json.h"
@@ -7,6 +8,7 @@
 #include <memory>
 #include <stb_image.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace stb_image_loader
@@ -29,6 +31,18 @@ namespace stb_image_loader
         return true;
     }
 
+    // Encodes every setting that changes the decoded pixels, so cooked textures are keyed by them.
+    static std::string build_cook_parameters(const tbx::TextureSettings& settings)
+    {
+        auto parameters = std::string("stb_image:flip:");
+        parameters.push_back(static_cast<char>(settings.wrap));
+        parameters.push_back(static_cast<char>(settings.filter));
+        parameters.push_back(static_cast<char>(settings.format));
+        parameters.push_back(static_cast<char>(settings.mipmaps));
+        parameters.push_back(static_cast<char>(settings.compression));
+        return parameters;
+    }
+
     static std::string build_load_failure_message(
         const std::filesystem::path& path,
         const char* reason)
@@ -46,13 +60,20 @@ namespace stb_image_loader
 
     void StbImageLoaderPlugin::on_attach(tbx::ServiceProvider& service_provider)
     {
+        // The flip flag is process-global in this stb_image version, so it is set once here rather
+        // than per load, where concurrent decodes on job workers would race on it.
+        stbi_set_flip_vertically_on_load(true);
+
+        const auto& paths = service_provider.get_service<tbx::AppSettings>().paths;
         if (!_file_ops)
-            _file_ops =
-                std::make_unique<tbx::FileOperator>(
-                    service_provider.get_service<tbx::AppSettings>().paths.working_directory);
+            _file_ops = service_provider.get_service<tbx::AssetManager>().get_file_ops();
+        _cooked_cache = std::make_unique<tbx::CookedAssetCache>(paths.cooked_assets_directory);
     }
 
-    void StbImageLoaderPlugin::on_detach() {}
+    void StbImageLoaderPlugin::on_detach()
+    {
+        _cooked_cache.reset();
+    }
 
     void StbImageLoaderPlugin::on_recieve_message(tbx::Message& msg)
     {
@@ -120,8 +141,9 @@ namespace stb_image_loader
             }
         }
 
-        std::string encoded_image;
-        if (!_file_ops->read_file(request.path, tbx::FileDataFormat::BINARY, encoded_image))
+        // Decode straight from the mapped file rather than a copy of it.
+        const auto encoded_image = _file_ops->map_file(request.path);
+        if (!encoded_image.is_valid())
         {
             request.state = tbx::MessageState::ERROR;
             request.result.flag_failure(
@@ -129,13 +151,21 @@ namespace stb_image_loader
             return;
         }
 
-        stbi_set_flip_vertically_on_load(true);
+        const auto cooked_key = tbx::CookedAssetCache::make_key(
+            encoded_image.get_data(),
+            build_cook_parameters(load_settings));
+        if (_cooked_cache && _cooked_cache->try_read(cooked_key, *asset))
+        {
+            request.state = tbx::MessageState::HANDLED;
+            return;
+        }
+
         int width = 0;
         int height = 0;
         const int desired_channels = load_settings.format == tbx::TextureFormat::RGB ? 3 : 4;
         stbi_uc* raw_data = stbi_load_from_memory(
-            reinterpret_cast<const stbi_uc*>(encoded_image.data()),
-            static_cast<int>(encoded_image.size()),
+            reinterpret_cast<const stbi_uc*>(encoded_image.get_data().data()),
+            static_cast<int>(encoded_image.get_size()),
             &width,
             &height,
             nullptr,
@@ -148,23 +178,28 @@ namespace stb_image_loader
             return;
         }
 
-        const auto pixel_count = static_cast<size_t>(width) * static_cast<size_t>(height)
-                                 * static_cast<size_t>(desired_channels);
-        const std::vector pixels(raw_data, raw_data + pixel_count);
+        const auto pixel_count = static_cast<size>(width) * static_cast<size>(height)
+                                 * static_cast<size>(desired_channels);
+        auto pixels = std::vector<tbx::Pixel>(raw_data, raw_data + pixel_count);
         stbi_image_free(raw_data);
 
         const tbx::Size resolution = {
             static_cast<uint32>(width),
             static_cast<uint32>(height)};
-        const tbx::Texture texture(
+        *asset = tbx::Texture(
             resolution,
             load_settings.wrap,
             load_settings.filter,
             load_settings.format,
             load_settings.mipmaps,
             load_settings.compression,
-            pixels);
-        *asset = texture;
+            std::move(pixels));
+
+        if (_cooked_cache)
+        {
+            if (const auto cook_result = _cooked_cache->write(cooked_key, *asset); !cook_result)
+                TBX_TRACE_WARNING("Failed to cook texture: {}", cook_result.get_report());
+        }
 
         request.state = tbx::MessageState::HANDLED;
     }